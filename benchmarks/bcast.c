@@ -0,0 +1,84 @@
+/*!
+ * @file bcast.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Measure handing every record to several readers, on bp_bcast against copying it
+ * into a bp_ring per reader.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include "bench.h"
+#include "bp_bcast.h"
+#include "bp_ring.h"
+
+#define CAPACITY 1024U
+#define MAX_READERS 8U
+#define BATCH 16U
+#define RECORDS 4000000U
+
+struct record {
+    uint64_t seq;
+    uint64_t payload[7];
+};
+
+static struct record rings_buffer[MAX_READERS][CAPACITY];
+static BP_BCAST_BUFFER(struct record, CAPACITY, MAX_READERS) buffer;
+
+int main(void)
+{
+    struct record batch[BATCH] = {0};
+    struct record out[BATCH];
+    bp_ring_t rings[MAX_READERS];
+    uint64_t start;
+    uint64_t acc = 0;
+    double rings_ns;
+    double bcast_ns;
+
+    printf("%-10s %16s %16s\n", "readers", "bp_ring (ns)", "bp_bcast (ns)");
+    for (size_t readers = 1; readers <= MAX_READERS; readers *= 2) {
+        bp_bcast_t bcast = BP_BCAST_INIT(buffer, false);
+
+        bcast._nreaders = readers;
+        for (size_t r = 0; r < readers; ++r) {
+            rings[r] = (bp_ring_t){(uint8_t *) rings_buffer[r], sizeof(struct record),
+                                   CAPACITY, 0, 0, 0};
+            buffer.cursors[r]._seq = 0;
+        }
+
+        start = bench_now_ns();
+        for (uint64_t seq = 0; seq < RECORDS; seq += BATCH) {
+            batch[0].seq = seq;
+            for (size_t r = 0; r < readers; ++r) {
+                bp_ring_push_back_n(&rings[r], batch, BATCH);
+            }
+            for (size_t r = 0; r < readers; ++r) {
+                bp_ring_pop_front_n(&rings[r], out, BATCH);
+                acc += out[0].seq;
+            }
+        }
+        rings_ns = (double) (bench_now_ns() - start) / RECORDS;
+
+        start = bench_now_ns();
+        for (uint64_t seq = 0; seq < RECORDS; seq += BATCH) {
+            bp_bcast_batch_t claimed;
+
+            batch[0].seq = seq;
+            bp_bcast_publish(&bcast, batch, BATCH);
+            for (size_t r = 0; r < readers; ++r) {
+                bp_bcast_claim(&bcast, r, BATCH, &claimed);
+                acc += ((struct record *) claimed.els)[0].seq;
+                bp_bcast_release(&bcast, r, &claimed);
+            }
+        }
+        bcast_ns = (double) (bench_now_ns() - start) / RECORDS;
+
+        printf("%-10zu %16.1f %16.1f\n", readers, rings_ns, bcast_ns);
+    }
+    bench_keep(acc);
+
+    return 0;
+}
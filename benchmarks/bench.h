@@ -0,0 +1,59 @@
+/*!
+ * @file bench.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Helpers shared by the benchmarks.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_BENCH_H
+#define BACKPACK_BENCH_H
+
+#include <stdint.h>
+#include <time.h>
+
+/*!
+ * Get a monotonic timestamp.
+ * @return The current time, in nanoseconds.
+ */
+static inline uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t) ts.tv_sec * 1000000000U + (uint64_t) ts.tv_nsec;
+}
+
+/*!
+ * Generate a pseudo-random number (xorshift64).
+ * @param state [in,out] Generator state. Must be different of zero.
+ * @return The next pseudo-random number.
+ */
+static inline uint64_t bench_rand(uint64_t *state)
+{
+    uint64_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+
+    return x;
+}
+
+/*!
+ * Prevent the compiler from discarding a computed value.
+ * @param value The value to be kept.
+ */
+static inline void bench_keep(uint64_t value)
+{
+    static volatile uint64_t sink;
+
+    sink = value;
+    (void) sink;
+}
+
+#endif  // BACKPACK_BENCH_H
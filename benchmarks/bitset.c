@@ -0,0 +1,98 @@
+/*!
+ * @file bitset.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Measure the scan of sparse flags and the intersection of two flag sets with
+ * bp_bitset, against a bp_array of bool.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include "bench.h"
+#include "bp_array.h"
+#include "bp_bitset.h"
+
+#define FLAGS 65536U
+#define ROUNDS 200U
+
+static bool flags_a[FLAGS];
+static bool flags_b[FLAGS];
+static uint64_t words_a[BP_BITSET_WORDS(FLAGS)];
+static uint64_t words_b[BP_BITSET_WORDS(FLAGS)];
+
+int main(void)
+{
+    bp_array_t array_a = BP_ARRAY_INIT(flags_a);
+    bp_array_t array_b = BP_ARRAY_INIT(flags_b);
+    bp_bitset_t set_a  = BP_BITSET_INIT(words_a, FLAGS);
+    bp_bitset_t set_b  = BP_BITSET_INIT(words_b, FLAGS);
+    uint64_t state     = 42;
+    uint64_t start;
+    uint64_t array_scan_ns;
+    uint64_t bitset_scan_ns;
+    uint64_t array_and_ns;
+    uint64_t bitset_and_ns;
+    uint64_t sum = 0;
+
+    /* About 1% of the flags are set. */
+    for (size_t i = 0; i < FLAGS; ++i) {
+        bool a = bench_rand(&state) % 100U == 0;
+        bool b = bench_rand(&state) % 2U == 0;
+        bp_array_push(&array_a, &a);
+        bp_array_push(&array_b, &b);
+        if (a) {
+            bp_bitset_set(&set_a, i);
+        }
+        if (b) {
+            bp_bitset_set(&set_b, i);
+        }
+    }
+
+    start = bench_now_ns();
+    for (size_t r = 0; r < ROUNDS; ++r) {
+        for (size_t i = 0; i < FLAGS; ++i) {
+            if (*(bool *) bp_array_get(&array_a, i)) {
+                sum += i;
+            }
+        }
+    }
+    array_scan_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+    for (size_t r = 0; r < ROUNDS; ++r) {
+        for (size_t i = bp_bitset_find_first(&set_a); i < FLAGS;
+             i = bp_bitset_find_next(&set_a, i + 1)) {
+            sum += i;
+        }
+    }
+    bitset_scan_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+    for (size_t r = 0; r < ROUNDS; ++r) {
+        for (size_t i = 0; i < FLAGS; ++i) {
+            flags_b[i] = flags_b[i] && flags_a[i];
+        }
+        sum += flags_b[r];
+    }
+    array_and_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+    for (size_t r = 0; r < ROUNDS; ++r) {
+        bp_bitset_and(&set_b, &set_a);
+        sum += words_b[r];
+    }
+    bitset_and_ns = bench_now_ns() - start;
+    bench_keep(sum);
+
+    printf("%u flags, about 1%% set\n", FLAGS);
+    printf("%-18s %10.1f us/scan\n", "bp_array of bool", (double) array_scan_ns / ROUNDS / 1e3);
+    printf("%-18s %10.1f us/scan\n", "bp_bitset", (double) bitset_scan_ns / ROUNDS / 1e3);
+    printf("%-18s %10.1f us/and\n", "bp_array of bool", (double) array_and_ns / ROUNDS / 1e3);
+    printf("%-18s %10.1f us/and\n", "bp_bitset", (double) bitset_and_ns / ROUNDS / 1e3);
+    printf("memory: %zu bytes vs %zu bytes\n", sizeof(flags_a), sizeof(words_a));
+
+    return 0;
+}
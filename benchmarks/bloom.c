@@ -0,0 +1,80 @@
+/*!
+ * @file bloom.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Compare bp_array_find against bp_bloom_array_find, when most keys are missing.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include "bench.h"
+#include "bp_bloom.h"
+
+#define RECORDS 10000U
+#define LOOKUPS 20000U
+#define MISS_PERCENT 70U
+
+struct record {
+    uint32_t key;
+    uint32_t value;
+};
+
+static struct record records[RECORDS];
+static bp_bloom_block_t blocks[RECORDS / 16U];
+static uint32_t keys[LOOKUPS];
+
+static bool cmp_key(void *el, void *param)
+{
+    return ((struct record *) el)->key == *(uint32_t *) param;
+}
+
+int main(void)
+{
+    bp_array_t array = BP_ARRAY_INIT(records);
+    bp_bloom_t bloom = BP_BLOOM_INIT(blocks);
+    uint64_t state   = 42;
+    uint64_t start;
+    uint64_t find_ns;
+    uint64_t bloom_ns;
+    size_t found;
+
+    for (uint32_t i = 0; i < RECORDS; ++i) {
+        /* Even keys are stored, odd keys are never found. */
+        struct record r = {.key = (uint32_t) bench_rand(&state) & ~1U, .value = i};
+        bp_bloom_array_push(&bloom, &array, &r, offsetof(struct record, key), sizeof(r.key));
+    }
+    for (size_t k = 0; k < LOOKUPS; ++k) {
+        uint64_t r = bench_rand(&state);
+        keys[k]    = ((r >> 32) % 100U < MISS_PERCENT) ? ((uint32_t) r | 1U)
+                                                       : records[r % RECORDS].key;
+    }
+
+    found = 0;
+    start = bench_now_ns();
+    for (size_t k = 0; k < LOOKUPS; ++k) {
+        found += bp_array_find(&array, &keys[k], cmp_key) != NULL;
+    }
+    find_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+    for (size_t k = 0; k < LOOKUPS; ++k) {
+        found -= bp_bloom_array_find(&bloom, &array, &keys[k], offsetof(struct record, key),
+                                     sizeof(uint32_t)) != NULL;
+    }
+    bloom_ns = bench_now_ns() - start;
+
+    if (found != 0) {
+        printf("bp_bloom_array_find failed\n");
+        return -1;
+    }
+
+    printf("%u records, %u lookups, %u%% missing\n", RECORDS, LOOKUPS, MISS_PERCENT);
+    printf("%-22s %10.2f ms\n", "bp_array_find", find_ns / 1e6);
+    printf("%-22s %10.2f ms (%.1fx)\n", "bp_bloom_array_find", bloom_ns / 1e6,
+           (double) find_ns / (double) bloom_ns);
+
+    return 0;
+}
@@ -0,0 +1,93 @@
+/*!
+ * @file btree.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Measure random inserts and range queries with bp_btree, against a sorted array
+ * kept with memmove on each insert.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <string.h>
+#include "bench.h"
+#include "bp_btree.h"
+
+#define RECORDS 1000000U
+#define ARRAY_RECORDS 100000U
+#define QUERIES 10000U
+#define SPAN 1000000U
+
+static BP_BTREE_POOL(nodes, RECORDS / 6U);
+static uint64_t sorted[ARRAY_RECORDS];
+static uint64_t keys[RECORDS];
+
+static void sorted_insert(size_t size, uint64_t key)
+{
+    size_t lo = 0;
+    size_t hi = size;
+
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2U;
+        if (sorted[mid] < key) {
+            lo = mid + 1U;
+        } else {
+            hi = mid;
+        }
+    }
+    memmove(&sorted[lo + 1U], &sorted[lo], (size - lo) * sizeof(uint64_t));
+    sorted[lo] = key;
+}
+
+int main(void)
+{
+    bp_btree_t tree = BP_BTREE_INIT(nodes);
+    uint64_t state  = 42;
+    uint64_t start;
+    uint64_t array_ns;
+    uint64_t tree_ns;
+    uint64_t range_ns;
+    uint64_t sum = 0;
+
+    for (size_t i = 0; i < RECORDS; ++i) {
+        keys[i] = bench_rand(&state);
+    }
+
+    /* The sorted array moves half of it on each insert, so it takes fewer records. */
+    start = bench_now_ns();
+    for (size_t i = 0; i < ARRAY_RECORDS; ++i) {
+        sorted_insert(i, keys[i]);
+    }
+    array_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+    for (size_t i = 0; i < RECORDS; ++i) {
+        bp_btree_insert(&tree, keys[i], i);
+    }
+    tree_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+    for (size_t q = 0; q < QUERIES; ++q) {
+        uint64_t lo            = bench_rand(&state);
+        bp_btree_range_t range = {&tree, lo, lo + (UINT64_MAX / RECORDS) * SPAN / 1000U};
+        bp_iterator_t it       = bp_btree_range_iterator(&range);
+        BP_FOREACH_FOWARD(uint64_t, value, &it)
+        {
+            sum += *value;
+        }
+    }
+    range_ns = bench_now_ns() - start;
+    bench_keep(sum);
+
+    printf("%-28s %10.1f ns/insert (%u records)\n", "sorted array + memmove",
+           (double) array_ns / ARRAY_RECORDS, ARRAY_RECORDS);
+    printf("%-28s %10.1f ns/insert (%u records)\n", "bp_btree", (double) tree_ns / RECORDS,
+           RECORDS);
+    printf("%-28s %10.1f ns/query (about 1000 records each)\n", "bp_btree range",
+           (double) range_ns / QUERIES);
+    printf("size %zu, height %zu, %zu nodes\n", bp_btree_size(&tree), tree._height, tree._live);
+
+    return 0;
+}
@@ -0,0 +1,96 @@
+/*!
+ * @file cache.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Measure the latency of cache hits with bp_cache (LRU and CLOCK), against a LRU
+ * cache built over a bp_array, which moves the hit element to the end.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include "bench.h"
+#include "bp_array.h"
+#include "bp_cache.h"
+
+#define ENTRIES 1024U
+#define HITS 1000000U
+
+struct entry {
+    uint32_t key;
+    uint32_t value;
+};
+
+static struct entry entries[ENTRIES];
+static BP_CACHE_BUFFER(struct entry, ENTRIES, ENTRIES) lru_buffer;
+static BP_CACHE_BUFFER(struct entry, ENTRIES, ENTRIES) clock_buffer;
+static uint32_t keys[HITS];
+
+static bool cmp_key(void *el, void *param)
+{
+    return ((struct entry *) el)->key == *(uint32_t *) param;
+}
+
+static uint32_t array_get(bp_array_t *array, uint32_t key)
+{
+    size_t idx = bp_array_find_idx(array, &key, cmp_key);
+    struct entry hit;
+
+    memcpy(&hit, bp_array_get(array, idx), sizeof(hit));
+    bp_array_del(array, idx);
+    bp_array_push(array, &hit);
+
+    return hit.value;
+}
+
+int main(void)
+{
+    bp_array_t array = BP_ARRAY_INIT(entries);
+    bp_cache_t lru   = BP_LRU_CACHE_INIT(lru_buffer, sizeof(uint32_t));
+    bp_cache_t clock = BP_CLOCK_CACHE_INIT(clock_buffer, sizeof(uint32_t));
+    uint64_t state   = 42;
+    uint64_t start;
+    uint64_t array_ns;
+    uint64_t lru_ns;
+    uint64_t clock_ns;
+    uint64_t sum = 0;
+
+    for (uint32_t i = 0; i < ENTRIES; ++i) {
+        struct entry e = {.key = i * 2654435761U, .value = i};
+        bp_array_push(&array, &e);
+        bp_cache_put(&lru, &e, NULL);
+        bp_cache_put(&clock, &e, NULL);
+    }
+    for (size_t k = 0; k < HITS; ++k) {
+        keys[k] = (uint32_t) (bench_rand(&state) % ENTRIES) * 2654435761U;
+    }
+
+    /* The array version is O(n) per hit, so it runs fewer hits. */
+    start = bench_now_ns();
+    for (size_t k = 0; k < HITS / 100U; ++k) {
+        sum += array_get(&array, keys[k]);
+    }
+    array_ns = (bench_now_ns() - start) * 100U;
+
+    start = bench_now_ns();
+    for (size_t k = 0; k < HITS; ++k) {
+        sum += ((struct entry *) bp_cache_get(&lru, &keys[k]))->value;
+    }
+    lru_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+    for (size_t k = 0; k < HITS; ++k) {
+        sum += ((struct entry *) bp_cache_get(&clock, &keys[k]))->value;
+    }
+    clock_ns = bench_now_ns() - start;
+    bench_keep(sum);
+
+    printf("%u entries, all lookups hit\n", ENTRIES);
+    printf("%-18s %10.1f ns/hit\n", "bp_array LRU", (double) array_ns / HITS);
+    printf("%-18s %10.1f ns/hit\n", "bp_cache LRU", (double) lru_ns / HITS);
+    printf("%-18s %10.1f ns/hit\n", "bp_cache CLOCK", (double) clock_ns / HITS);
+
+    return 0;
+}
@@ -0,0 +1,133 @@
+/*!
+ * @file chashmap.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Measure how bp_chashmap scales with the number of threads, for a mix of reads
+ * and writes, against a bp_hashmap guarded by a single read-write lock.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <pthread.h>
+#include <stdio.h>
+#include "bench.h"
+#include "bp_chashmap.h"
+#include "bp_thread_pool.h"
+
+#define KEYS 65536U
+#define OPS_PER_THREAD 2000000U
+#define WRITE_PERCENT 5U
+#define STRIPES 64U
+
+struct record {
+    uint64_t key;
+    uint64_t value;
+};
+
+struct bench {
+    bp_chashmap_t *cmap;
+    bp_hashmap_t *map;
+    pthread_rwlock_t *lock;
+};
+
+static BP_CHASHMAP_BUFFER(struct record, STRIPES, 2U * KEYS / STRIPES) cmap_buffer;
+static BP_HASHMAP_BUFFER(struct record, 2U * KEYS) map_buffer;
+
+static void run_chashmap(void *arg, size_t worker, size_t nworkers)
+{
+    struct bench *bench = arg;
+    uint64_t state      = 0x9E3779B97F4A7C15U * (worker + 1U);
+    uint64_t sum        = 0;
+    struct record el;
+
+    (void) nworkers;
+    for (size_t i = 0; i < OPS_PER_THREAD; ++i) {
+        uint64_t r = bench_rand(&state);
+        el.key     = r % KEYS;
+        if ((r >> 32) % 100U < WRITE_PERCENT) {
+            el.value = r;
+            bp_chashmap_put(bench->cmap, &el);
+        } else if (bp_chashmap_find(bench->cmap, &el.key, &el) == 0) {
+            sum += el.value;
+        }
+    }
+    bench_keep(sum);
+}
+
+static void run_rwlock(void *arg, size_t worker, size_t nworkers)
+{
+    struct bench *bench = arg;
+    uint64_t state      = 0x9E3779B97F4A7C15U * (worker + 1U);
+    uint64_t sum        = 0;
+    struct record el;
+    struct record *found;
+
+    (void) nworkers;
+    for (size_t i = 0; i < OPS_PER_THREAD; ++i) {
+        uint64_t r = bench_rand(&state);
+        el.key     = r % KEYS;
+        if ((r >> 32) % 100U < WRITE_PERCENT) {
+            el.value = r;
+            pthread_rwlock_wrlock(bench->lock);
+            found = bp_hashmap_find(bench->map, &el.key);
+            if (found != NULL) {
+                found->value = el.value;
+            }
+            pthread_rwlock_unlock(bench->lock);
+        } else {
+            pthread_rwlock_rdlock(bench->lock);
+            found = bp_hashmap_find(bench->map, &el.key);
+            if (found != NULL) {
+                sum += found->value;
+            }
+            pthread_rwlock_unlock(bench->lock);
+        }
+    }
+    bench_keep(sum);
+}
+
+int main(void)
+{
+    bp_chashmap_t cmap     = BP_CHASHMAP_INIT(cmap_buffer, sizeof(uint64_t));
+    bp_hashmap_t map       = BP_HASHMAP_INIT(map_buffer, sizeof(uint64_t));
+    pthread_rwlock_t lock  = PTHREAD_RWLOCK_INITIALIZER;
+    struct bench bench     = {.cmap = &cmap, .map = &map, .lock = &lock};
+    const size_t threads[] = {1, 2, 4, 8, 16};
+    bp_thread_pool_t pool;
+    uint64_t start;
+    uint64_t cmap_ns;
+    uint64_t rwlock_ns;
+
+    for (uint64_t k = 0; k < KEYS; ++k) {
+        struct record el = {.key = k, .value = k};
+        bp_chashmap_insert(&cmap, &el);
+        bp_hashmap_insert(&map, &el);
+    }
+
+    printf("%u%% writes, %u ops per thread\n", WRITE_PERCENT, OPS_PER_THREAD);
+    printf("%8s %20s %20s\n", "threads", "rwlock (Mops/s)", "chashmap (Mops/s)");
+    for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); ++t) {
+        if (bp_thread_pool_init(&pool, threads[t]) != 0) {
+            printf("could not start %zu threads\n", threads[t]);
+            return -1;
+        }
+
+        start = bench_now_ns();
+        bp_thread_pool_run(&pool, run_rwlock, &bench);
+        rwlock_ns = bench_now_ns() - start;
+
+        start = bench_now_ns();
+        bp_thread_pool_run(&pool, run_chashmap, &bench);
+        cmap_ns = bench_now_ns() - start;
+
+        bp_thread_pool_deinit(&pool);
+
+        double ops = (double) OPS_PER_THREAD * (double) threads[t];
+        printf("%8zu %20.1f %20.1f\n", threads[t], ops / (double) rwlock_ns * 1e3,
+               ops / (double) cmap_ns * 1e3);
+    }
+
+    return 0;
+}
@@ -0,0 +1,74 @@
+/*!
+ * @file find_many.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Compare bp_array_find_many against one bp_array_find_idx call for each key.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include "bench.h"
+#include "bp_array.h"
+
+#define RECORDS 100000U
+#define MAX_KEYS 1000U
+
+struct record {
+    uint32_t id;
+    uint32_t value;
+};
+
+static struct record records[RECORDS];
+static uint32_t keys[MAX_KEYS];
+static size_t out_idx[MAX_KEYS];
+
+static bool cmp_id(void *el, void *param)
+{
+    return ((struct record *) el)->id == *(uint32_t *) param;
+}
+
+int main(void)
+{
+    bp_array_t array    = BP_ARRAY_START(records, RECORDS);
+    uint64_t state      = 42;
+    const size_t nkeys[] = {1, 10, 100, 1000};
+    uint64_t start;
+    uint64_t single_ns;
+    uint64_t many_ns;
+    size_t found;
+
+    for (uint32_t i = 0; i < RECORDS; ++i) {
+        records[i].id    = (uint32_t) bench_rand(&state);
+        records[i].value = i;
+    }
+
+    printf("%8s %16s %16s %8s\n", "keys", "find_idx (us)", "find_many (us)", "speedup");
+    for (size_t n = 0; n < sizeof(nkeys) / sizeof(nkeys[0]); ++n) {
+        /* Half of the keys are present, the other half miss. */
+        for (size_t k = 0; k < nkeys[n]; ++k) {
+            keys[k] = (k & 1U) ? records[bench_rand(&state) % RECORDS].id
+                               : (uint32_t) bench_rand(&state);
+        }
+
+        found = 0;
+        start = bench_now_ns();
+        for (size_t k = 0; k < nkeys[n]; ++k) {
+            found += bp_array_find_idx(&array, &keys[k], cmp_id) != BP_ARRAY_INVALID_INDEX;
+        }
+        single_ns = bench_now_ns() - start;
+
+        start = bench_now_ns();
+        found -= bp_array_find_many(&array, keys, offsetof(struct record, id),
+                                    sizeof(uint32_t), nkeys[n], out_idx);
+        many_ns = bench_now_ns() - start;
+
+        bench_keep(found);
+        printf("%8zu %16.1f %16.1f %7.1fx\n", nkeys[n], single_ns / 1e3, many_ns / 1e3,
+               (double) single_ns / (double) many_ns);
+    }
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+/*!
+ * @file hashmap.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Compare key lookups with bp_hashmap_find against bp_array_find.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include "bench.h"
+#include "bp_array.h"
+#include "bp_hashmap.h"
+
+#define MAX_RECORDS 16384U
+#define LOOKUPS 100000U
+
+struct key_value {
+    int key;
+    int value;
+};
+
+static struct key_value records[MAX_RECORDS];
+static BP_HASHMAP_BUFFER(struct key_value, 2U * MAX_RECORDS) map_buffer;
+static int keys[LOOKUPS];
+
+static bool find_in_key_value(void *el, void *param)
+{
+    return ((struct key_value *) el)->key == *(int *) param;
+}
+
+int main(void)
+{
+    const size_t sizes[] = {16, 128, 1024, 16384};
+    uint64_t state       = 42;
+    uint64_t start;
+    uint64_t array_ns;
+    uint64_t map_ns;
+    uint64_t sum;
+
+    printf("%8s %18s %18s %8s\n", "records", "array (ns/find)", "hashmap (ns/find)",
+           "speedup");
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        bp_array_t array = BP_ARRAY_INIT(records);
+        bp_hashmap_t map = BP_HASHMAP_INIT(map_buffer, sizeof(int));
+
+        bp_hashmap_clear(&map);
+        for (size_t i = 0; i < sizes[s]; ++i) {
+            struct key_value kv = {.key = (int) (bench_rand(&state) >> 33), .value = (int) i};
+            if (bp_hashmap_insert(&map, &kv) == 0) {
+                bp_array_push(&array, &kv);
+            }
+        }
+        for (size_t k = 0; k < LOOKUPS; ++k) {
+            keys[k] = records[bench_rand(&state) % bp_array_size(&array)].key;
+        }
+
+        /* The linear search gets fewer lookups, to keep the run short. */
+        size_t array_lookups = LOOKUPS / (1U + sizes[s] / 64U);
+
+        sum   = 0;
+        start = bench_now_ns();
+        for (size_t k = 0; k < array_lookups; ++k) {
+            sum += ((struct key_value *) bp_array_find(&array, &keys[k], find_in_key_value))->value;
+        }
+        array_ns = bench_now_ns() - start;
+        bench_keep(sum);
+
+        sum   = 0;
+        start = bench_now_ns();
+        for (size_t k = 0; k < LOOKUPS; ++k) {
+            sum += ((struct key_value *) bp_hashmap_find(&map, &keys[k]))->value;
+        }
+        map_ns = bench_now_ns() - start;
+        bench_keep(sum);
+
+        double array_per = (double) array_ns / (double) array_lookups;
+        double map_per   = (double) map_ns / (double) LOOKUPS;
+        printf("%8zu %18.1f %18.1f %7.1fx\n", bp_array_size(&array), array_per, map_per,
+               array_per / map_per);
+    }
+
+    return 0;
+}
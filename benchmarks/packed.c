@@ -0,0 +1,84 @@
+/*!
+ * @file packed.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Measure the memory and the scan of 12-bit codes with bp_packed, against a
+ * bp_array of uint16_t.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include "bench.h"
+#include "bp_array.h"
+#include "bp_packed.h"
+
+#define CODES 1000000U
+#define BITS 12U
+#define CHUNK 256U
+#define ROUNDS 20U
+
+static uint16_t codes[CODES];
+static uint64_t words[BP_PACKED_WORDS(CODES, BITS)];
+static uint64_t values[CODES];
+
+int main(void)
+{
+    bp_array_t array   = BP_ARRAY_INIT(codes);
+    bp_packed_t packed = BP_PACKED_INIT(words, BITS);
+    uint32_t chunk[CHUNK];
+    uint64_t state = 42;
+    uint64_t start;
+    uint64_t array_ns;
+    uint64_t get_ns;
+    uint64_t unpack_ns;
+    uint64_t sum = 0;
+
+    for (size_t i = 0; i < CODES; ++i) {
+        uint16_t code = (uint16_t) (bench_rand(&state) % (1U << BITS));
+        values[i]     = code;
+        bp_array_push(&array, &code);
+    }
+    bp_packed_append(&packed, values, CODES);
+
+    start = bench_now_ns();
+    for (size_t r = 0; r < ROUNDS; ++r) {
+        for (size_t i = 0; i < CODES; ++i) {
+            sum += *(uint16_t *) bp_array_get(&array, i);
+        }
+    }
+    array_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+    for (size_t r = 0; r < ROUNDS; ++r) {
+        for (size_t i = 0; i < CODES; ++i) {
+            sum += bp_packed_get(&packed, i);
+        }
+    }
+    get_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+    for (size_t r = 0; r < ROUNDS; ++r) {
+        for (size_t i = 0; i < CODES; i += CHUNK) {
+            size_t count = CODES - i < CHUNK ? CODES - i : CHUNK;
+            bp_packed_unpack32(&packed, i, count, chunk);
+            for (size_t k = 0; k < count; ++k) {
+                sum += chunk[k];
+            }
+        }
+    }
+    unpack_ns = bench_now_ns() - start;
+    bench_keep(sum);
+
+    printf("%u codes of %u bits\n", CODES, BITS);
+    printf("%-24s %8.2f ns/code %8zu bytes\n", "bp_array of uint16_t",
+           (double) array_ns / ROUNDS / CODES, sizeof(codes));
+    printf("%-24s %8.2f ns/code %8zu bytes\n", "bp_packed_get", (double) get_ns / ROUNDS / CODES,
+           sizeof(words));
+    printf("%-24s %8.2f ns/code %8zu bytes\n", "bp_packed_unpack32",
+           (double) unpack_ns / ROUNDS / CODES, sizeof(words));
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+/*!
+ * @file par_find.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Scaling of bp_array_par_find_idx and bp_array_par_count with the number of
+ * workers.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "bp_array_par.h"
+
+#define RECORDS (16U * 1024U * 1024U)
+#define ROUNDS 5U
+
+struct record {
+    uint64_t id;
+    uint64_t value;
+};
+
+static bool cmp_id(void *el, void *param)
+{
+    return ((struct record *) el)->id == *(uint64_t *) param;
+}
+
+int main(void)
+{
+    struct record *records = malloc(RECORDS * sizeof(struct record));
+    bp_array_t array       = {
+        ._element_size = sizeof(struct record),
+        ._capacity     = RECORDS,
+        ._size         = RECORDS,
+        ._array        = (uint8_t *) records,
+    };
+    bp_thread_pool_t pool;
+    uint64_t state = 42;
+    uint64_t missing;
+    uint64_t start;
+    uint64_t find_ns;
+    uint64_t count_ns;
+    uint64_t base_ns = 0;
+    size_t result    = 0;
+
+    if (records == NULL) {
+        return -1;
+    }
+
+    for (size_t i = 0; i < RECORDS; ++i) {
+        records[i].id    = bench_rand(&state) | 1U;
+        records[i].value = i;
+    }
+    /* Even ids are never present, so each search scans the whole array. */
+    missing = 2;
+
+    start = bench_now_ns();
+    for (size_t r = 0; r < ROUNDS; ++r) {
+        result += bp_array_find_idx(&array, &missing, cmp_id);
+    }
+    base_ns = (bench_now_ns() - start) / ROUNDS;
+    printf("bp_array_find_idx: %.2f ms\n\n", base_ns / 1e6);
+
+    printf("%8s %14s %10s %14s\n", "threads", "find (ms)", "speedup", "count (ms)");
+    for (size_t threads = 1; threads <= 32; threads *= 2) {
+        if (bp_thread_pool_init(&pool, threads) != 0) {
+            break;
+        }
+
+        start = bench_now_ns();
+        for (size_t r = 0; r < ROUNDS; ++r) {
+            result += bp_array_par_find_idx(&pool, &array, &missing, cmp_id);
+        }
+        find_ns = (bench_now_ns() - start) / ROUNDS;
+
+        start = bench_now_ns();
+        for (size_t r = 0; r < ROUNDS; ++r) {
+            result += bp_array_par_count(&pool, &array, &missing, cmp_id);
+        }
+        count_ns = (bench_now_ns() - start) / ROUNDS;
+
+        printf("%8zu %14.2f %9.1fx %14.2f\n", threads, find_ns / 1e6,
+               (double) base_ns / (double) find_ns, count_ns / 1e6);
+        bp_thread_pool_deinit(&pool);
+    }
+
+    bench_keep(result);
+    free(records);
+
+    return 0;
+}
@@ -0,0 +1,88 @@
+/*!
+ * @file par_sort.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Scaling of bp_array_par_sort from 1 to 32 workers.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "bp_array_par.h"
+
+#define RECORDS (8U * 1024U * 1024U)
+
+struct record {
+    uint64_t key;
+    uint64_t value;
+};
+
+static int cmp_key(void *left, void *right)
+{
+    uint64_t l = ((struct record *) left)->key;
+    uint64_t r = ((struct record *) right)->key;
+
+    return (l > r) - (l < r);
+}
+
+int main(void)
+{
+    struct record *records = malloc(RECORDS * sizeof(struct record));
+    struct record *scratch = malloc(RECORDS * sizeof(struct record));
+    bp_array_t array       = {
+        ._element_size = sizeof(struct record),
+        ._capacity     = RECORDS,
+        ._size         = RECORDS,
+        ._array        = (uint8_t *) records,
+    };
+    bp_thread_pool_t pool;
+    uint64_t state;
+    uint64_t start;
+    uint64_t elapsed;
+    uint64_t base = 0;
+
+    if (records == NULL || scratch == NULL) {
+        return -1;
+    }
+
+    printf("%u records of %zu bytes\n", RECORDS, sizeof(struct record));
+    printf("%8s %12s %10s\n", "threads", "time (ms)", "speedup");
+    for (size_t threads = 1; threads <= 32; threads *= 2) {
+        if (bp_thread_pool_init(&pool, threads) != 0) {
+            break;
+        }
+
+        state = 42;
+        for (size_t i = 0; i < RECORDS; ++i) {
+            records[i].key   = bench_rand(&state);
+            records[i].value = i;
+        }
+
+        start = bench_now_ns();
+        bp_array_par_sort(&pool, &array, cmp_key, scratch);
+        elapsed = bench_now_ns() - start;
+        if (threads == 1) {
+            base = elapsed;
+        }
+
+        for (size_t i = 1; i < RECORDS; ++i) {
+            if (records[i - 1].key > records[i].key) {
+                printf("bp_array_par_sort failed\n");
+                return -1;
+            }
+        }
+
+        printf("%8zu %12.2f %9.1fx\n", threads, elapsed / 1e6,
+               (double) base / (double) elapsed);
+        bp_thread_pool_deinit(&pool);
+    }
+
+    free(records);
+    free(scratch);
+
+    return 0;
+}
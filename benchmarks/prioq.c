@@ -0,0 +1,95 @@
+/*!
+ * @file prioq.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Measure push and pop with 32 priority levels, on bp_prioq against a bp_heap
+ * ordered by the level.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include "bench.h"
+#include "bp_heap.h"
+#include "bp_prioq.h"
+
+#define LEVELS 32U
+#define PER_LEVEL 1024U
+#define QUEUED 4096U
+#define ROUNDS 4000000U
+
+struct task {
+    uint32_t level;
+    uint32_t id;
+};
+
+static struct task buffers[LEVELS][PER_LEVEL];
+static struct task heap_buffer[LEVELS * PER_LEVEL];
+static uint32_t levels_of[ROUNDS];
+
+static int cmp_level(void *left, void *right)
+{
+    uint32_t l = ((struct task *) left)->level;
+    uint32_t r = ((struct task *) right)->level;
+
+    return (l > r) - (l < r);
+}
+
+int main(void)
+{
+    bp_ring_t levels[LEVELS];
+    bp_prioq_t queue = BP_PRIOQ_INIT(levels);
+    bp_heap_t heap   = BP_MIN_HEAP_INIT(heap_buffer, cmp_level);
+    struct task task;
+    uint64_t state = 42;
+    uint64_t start;
+    uint64_t sum = 0;
+    double prioq_ns;
+    double heap_ns;
+
+    for (size_t i = 0; i < LEVELS; ++i) {
+        bp_ring_t ring = BP_RING_INIT(buffers[i]);
+        levels[i]      = ring;
+    }
+    for (size_t i = 0; i < ROUNDS; ++i) {
+        levels_of[i] = (uint32_t) (bench_rand(&state) % LEVELS);
+    }
+
+    /* Keep QUEUED tasks in the queue, and push one for each one popped. */
+    for (uint32_t i = 0; i < QUEUED; ++i) {
+        task.level = levels_of[i];
+        task.id    = i;
+        bp_prioq_push(&queue, task.level, &task);
+        bp_heap_push(&heap, &task);
+    }
+
+    start = bench_now_ns();
+    for (uint32_t i = QUEUED; i < ROUNDS; ++i) {
+        bp_prioq_pop(&queue, &task, NULL);
+        sum += task.id;
+        task.level = levels_of[i];
+        task.id    = i;
+        bp_prioq_push(&queue, task.level, &task);
+    }
+    prioq_ns = (double) (bench_now_ns() - start) / (ROUNDS - QUEUED);
+
+    start = bench_now_ns();
+    for (uint32_t i = QUEUED; i < ROUNDS; ++i) {
+        bp_heap_pop(&heap, &task);
+        sum += task.id;
+        task.level = levels_of[i];
+        task.id    = i;
+        bp_heap_push(&heap, &task);
+    }
+    heap_ns = (double) (bench_now_ns() - start) / (ROUNDS - QUEUED);
+    bench_keep(sum);
+
+    printf("%u levels, %u queued tasks\n", LEVELS, QUEUED);
+    printf("%-18s %10s\n", "", "ns/op");
+    printf("%-18s %10.1f\n", "bp_prioq", prioq_ns);
+    printf("%-18s %10.1f\n", "bp_heap", heap_ns);
+
+    return 0;
+}
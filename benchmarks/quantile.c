@@ -0,0 +1,85 @@
+/*!
+ * @file quantile.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Measure a push followed by a p50/p95/p99 query, on bp_quantile against copying
+ * the bp_ring window and selecting with bp_array_percentiles.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include "bench.h"
+#include "bp_array.h"
+#include "bp_quantile.h"
+
+#define MAX_WINDOW 16384U
+#define BUCKETS 4096U
+#define PUSHES 20000U
+
+static double samples[MAX_WINDOW];
+static double copy[MAX_WINDOW];
+static BP_QUANTILE_BUFFER(MAX_WINDOW, BUCKETS) buffer;
+
+static int cmp_double(void *left, void *right)
+{
+    double l = *(double *) left;
+    double r = *(double *) right;
+
+    return (l > r) - (l < r);
+}
+
+int main(void)
+{
+    const double qs[] = {0.5, 0.95, 0.99};
+    double out[3];
+    void *refs[3];
+    uint64_t state = 42;
+    uint64_t start;
+    double acc = 0.0;
+    double copy_ns;
+    double quantile_ns;
+
+    printf("%-10s %16s %16s\n", "window", "percentiles (ns)", "bp_quantile (ns)");
+    for (size_t size = 64; size <= MAX_WINDOW; size *= 4) {
+        bp_ring_t ring         = {(uint8_t *) samples, sizeof(double), size, 0, 0, 0};
+        bp_quantile_t quantile = BP_QUANTILE_INIT(buffer, 0.0, 1000.0);
+
+        /* Shrink the window to the size being measured. */
+        quantile._samples._capacity = size;
+        bp_quantile_clear(&quantile);
+        if (bp_quantile_check(&quantile) != 0) {
+            return 1;
+        }
+
+        start = bench_now_ns();
+        for (size_t i = 0; i < PUSHES; ++i) {
+            double x = (double) (bench_rand(&state) % 1000U);
+            bp_ring_push(&ring, &x);
+
+            bp_array_t array = {sizeof(double), size, ring._size, (uint8_t *) copy};
+            for (size_t j = 0; j < ring._size; ++j) {
+                copy[j] = *(double *) bp_ring_get(&ring, j);
+            }
+            bp_array_percentiles(&array, cmp_double, qs, 3, refs);
+            acc += *(double *) refs[2];
+        }
+        copy_ns = (double) (bench_now_ns() - start) / PUSHES;
+
+        start = bench_now_ns();
+        for (size_t i = 0; i < PUSHES; ++i) {
+            double x = (double) (bench_rand(&state) % 1000U);
+            bp_quantile_push(&quantile, x);
+            bp_quantile_query(&quantile, qs, 3, out);
+            acc += out[2];
+        }
+        quantile_ns = (double) (bench_now_ns() - start) / PUSHES;
+
+        printf("%-10zu %16.1f %16.1f\n", size, copy_ns, quantile_ns);
+    }
+    bench_keep((uint64_t) acc);
+
+    return 0;
+}
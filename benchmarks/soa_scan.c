@@ -0,0 +1,121 @@
+/*!
+ * @file soa_scan.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Compare single-field scans over a bp_array of records and over a bp_soa.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include "bench.h"
+#include "bp_soa.h"
+
+#define RECORDS (4U * 1024U * 1024U)
+#define ROUNDS 8U
+
+struct record {
+    uint64_t id;
+    uint64_t ts;
+    double value;
+    uint32_t flags;
+};
+
+enum { FIELD_ID, FIELD_TS, FIELD_VALUE, FIELD_FLAGS };
+
+static struct record records[RECORDS];
+static uint64_t ids[RECORDS];
+static uint64_t tss[RECORDS];
+static double values[RECORDS];
+static uint32_t flags[RECORDS];
+
+static bool cmp_record_ts(void *el, void *param)
+{
+    return ((struct record *) el)->ts == *(uint64_t *) param;
+}
+
+static bool cmp_ts(void *el, void *param)
+{
+    return *(uint64_t *) el == *(uint64_t *) param;
+}
+
+static void sum_value(void *acc, void *el)
+{
+    *(double *) acc += *(double *) el;
+}
+
+int main(void)
+{
+    static const bp_soa_field_t fields[] = {
+        BP_SOA_FIELD(struct record, id),
+        BP_SOA_FIELD(struct record, ts),
+        BP_SOA_FIELD(struct record, value),
+        BP_SOA_FIELD(struct record, flags),
+    };
+    static void *const columns[] = {ids, tss, values, flags};
+    bp_array_t array = BP_ARRAY_INIT(records);
+    bp_soa_t soa     = BP_SOA_INIT(struct record, fields, columns, RECORDS);
+    uint64_t seed    = 42;
+    uint64_t start;
+    uint64_t aos_find_ns = 0;
+    uint64_t soa_find_ns = 0;
+    uint64_t aos_sum_ns  = 0;
+    uint64_t soa_sum_ns  = 0;
+
+    if (bp_soa_check(&soa) != 0) {
+        return 1;
+    }
+
+    for (uint32_t i = 0; i < RECORDS; ++i) {
+        struct record r = {
+            .id    = i,
+            .ts    = bench_rand(&seed),
+            .value = (double) (i & 0xFFU),
+            .flags = i & 0x3U,
+        };
+        bp_array_push(&array, &r);
+        bp_soa_push(&soa, &r);
+    }
+
+    for (uint32_t round = 0; round < ROUNDS; ++round) {
+        /* Search for a record near the end, to scan almost the whole collection. */
+        uint64_t target = ((struct record *) bp_array_get(&array, RECORDS - 1 - round))->ts;
+
+        start = bench_now_ns();
+        bench_keep(bp_array_find_idx(&array, &target, cmp_record_ts));
+        aos_find_ns += bench_now_ns() - start;
+
+        start = bench_now_ns();
+        bench_keep(bp_soa_find_idx(&soa, FIELD_TS, &target, cmp_ts));
+        soa_find_ns += bench_now_ns() - start;
+
+        double aos_sum = 0.0;
+        start          = bench_now_ns();
+        for (size_t i = 0; i < RECORDS; ++i) {
+            aos_sum += ((struct record *) bp_array_get(&array, i))->value;
+        }
+        aos_sum_ns += bench_now_ns() - start;
+
+        double soa_sum = 0.0;
+        start          = bench_now_ns();
+        bp_soa_reduce(&soa, FIELD_VALUE, &soa_sum, sum_value);
+        soa_sum_ns += bench_now_ns() - start;
+
+        if (aos_sum != soa_sum) {
+            printf("bp_soa_reduce failed\n");
+            return -1;
+        }
+    }
+
+    printf("%u records of %zu bytes, %u rounds\n", RECORDS, sizeof(struct record), ROUNDS);
+    printf("%-26s %10.2f ms\n", "bp_array_find_idx (ts)", aos_find_ns / 1e6);
+    printf("%-26s %10.2f ms (%.1fx)\n", "bp_soa_find_idx (ts)", soa_find_ns / 1e6,
+           (double) aos_find_ns / (double) soa_find_ns);
+    printf("%-26s %10.2f ms\n", "bp_array sum (value)", aos_sum_ns / 1e6);
+    printf("%-26s %10.2f ms (%.1fx)\n", "bp_soa_reduce (value)", soa_sum_ns / 1e6,
+           (double) aos_sum_ns / (double) soa_sum_ns);
+
+    return 0;
+}
@@ -0,0 +1,99 @@
+/*!
+ * @file sort.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Compare bp_array_sort and bp_array_radix_sort_key against qsort.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "bp_array.h"
+
+#define RECORDS (1024U * 1024U)
+
+struct record {
+    uint32_t key;
+    uint32_t value;
+};
+
+static struct record records[RECORDS];
+static struct record scratch[RECORDS];
+
+static int cmp_key(const void *left, const void *right)
+{
+    uint32_t l = ((const struct record *) left)->key;
+    uint32_t r = ((const struct record *) right)->key;
+
+    return (l > r) - (l < r);
+}
+
+static int cmp_key_bp(void *left, void *right)
+{
+    return cmp_key(left, right);
+}
+
+static void fill(uint64_t seed)
+{
+    for (uint32_t i = 0; i < RECORDS; ++i) {
+        records[i].key   = (uint32_t) bench_rand(&seed);
+        records[i].value = i;
+    }
+}
+
+static bool is_sorted(void)
+{
+    for (size_t i = 1; i < RECORDS; ++i) {
+        if (records[i - 1].key > records[i].key) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(void)
+{
+    bp_array_t array = BP_ARRAY_START(records, RECORDS);
+    uint64_t start;
+    uint64_t qsort_ns;
+    uint64_t sort_ns;
+    uint64_t radix_ns;
+
+    fill(42);
+    start = bench_now_ns();
+    qsort(records, RECORDS, sizeof(struct record), cmp_key);
+    qsort_ns = bench_now_ns() - start;
+
+    fill(42);
+    start = bench_now_ns();
+    bp_array_sort(&array, cmp_key_bp);
+    sort_ns = bench_now_ns() - start;
+    if (!is_sorted()) {
+        printf("bp_array_sort failed\n");
+        return -1;
+    }
+
+    fill(42);
+    start = bench_now_ns();
+    bp_array_radix_sort_key(&array, offsetof(struct record, key), sizeof(uint32_t),
+                            scratch);
+    radix_ns = bench_now_ns() - start;
+    if (!is_sorted()) {
+        printf("bp_array_radix_sort_key failed\n");
+        return -1;
+    }
+
+    printf("%u records of %zu bytes\n", RECORDS, sizeof(struct record));
+    printf("%-26s %10.2f ms\n", "qsort", qsort_ns / 1e6);
+    printf("%-26s %10.2f ms (%.1fx)\n", "bp_array_sort", sort_ns / 1e6,
+           (double) qsort_ns / (double) sort_ns);
+    printf("%-26s %10.2f ms (%.1fx)\n", "bp_array_radix_sort_key", radix_ns / 1e6,
+           (double) qsort_ns / (double) radix_ns);
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+/*!
+ * @file window.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Measure a push followed by a query of mean, variance, min and max, on bp_window
+ * against walking the whole bp_ring on each push.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include "bench.h"
+#include "bp_window.h"
+
+#define MAX_WINDOW 16384U
+#define PUSHES 200000U
+
+static double samples[MAX_WINDOW];
+static BP_WINDOW_BUFFER(MAX_WINDOW) buffer;
+
+static double scan(bp_ring_t *ring)
+{
+    double sum = 0.0;
+    double sq  = 0.0;
+    double min = *(double *) bp_ring_get(ring, 0);
+    double max = min;
+
+    for (size_t i = 0; i < ring->_size; ++i) {
+        double x = *(double *) bp_ring_get(ring, i);
+        sum += x;
+        sq += x * x;
+        min = x < min ? x : min;
+        max = x > max ? x : max;
+    }
+
+    return sum + sq + min + max;
+}
+
+int main(void)
+{
+    bp_window_stats_t stats;
+    uint64_t state = 42;
+    uint64_t start;
+    double acc = 0.0;
+    double ring_ns;
+    double window_ns;
+
+    printf("%-10s %14s %14s\n", "window", "bp_ring (ns)", "bp_window (ns)");
+    for (size_t size = 64; size <= MAX_WINDOW; size *= 4) {
+        bp_ring_t ring     = {(uint8_t *) samples, sizeof(double), size, 0, 0, 0};
+        bp_window_t window = BP_WINDOW_INIT(buffer);
+
+        /* Shrink the window to the size being measured. */
+        window._samples._capacity = size;
+        window._mins._capacity    = size;
+        window._maxs._capacity    = size;
+
+        start = bench_now_ns();
+        for (size_t i = 0; i < PUSHES; ++i) {
+            double x = (double) (bench_rand(&state) % 1000U);
+            bp_ring_push(&ring, &x);
+            acc += scan(&ring);
+        }
+        ring_ns = (double) (bench_now_ns() - start) / PUSHES;
+
+        start = bench_now_ns();
+        for (size_t i = 0; i < PUSHES; ++i) {
+            double x = (double) (bench_rand(&state) % 1000U);
+            bp_window_push(&window, x);
+            bp_window_stats(&window, &stats);
+            acc += stats.mean + stats.variance + stats.min + stats.max;
+        }
+        window_ns = (double) (bench_now_ns() - start) / PUSHES;
+
+        printf("%-10zu %14.1f %14.1f\n", size, ring_ns, window_ns);
+    }
+    bench_keep((uint64_t) acc);
+
+    return 0;
+}
@@ -0,0 +1,162 @@
+/*!
+ * @file ws_sort.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Fork-join quicksort of a bp_array on bp_ws_pool, from 1 to 32 workers, against
+ * bp_array_par_sort.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "bp_array_par.h"
+#include "bp_ws_pool.h"
+
+#define RECORDS (8U * 1024U * 1024U)
+#define CUTOFF 8192U
+
+static int cmp_u64(void *left, void *right)
+{
+    uint64_t l = *(uint64_t *) left;
+    uint64_t r = *(uint64_t *) right;
+
+    return (l > r) - (l < r);
+}
+
+static void swap(uint64_t *a, uint64_t *b)
+{
+    uint64_t t = *a;
+
+    *a = *b;
+    *b = t;
+}
+
+static void quicksort(bp_ws_worker_t *worker, void *arg)
+{
+    bp_array_t *array = arg;
+    uint64_t *keys    = (uint64_t *) array->_array;
+    size_t size       = array->_size;
+
+    if (size <= CUTOFF) {
+        bp_array_sort(array, cmp_u64);
+        return;
+    }
+
+    /* Median of three, then a Hoare partition. */
+    size_t mid = size / 2U;
+    if (keys[mid] < keys[0]) {
+        swap(&keys[mid], &keys[0]);
+    }
+    if (keys[size - 1U] < keys[0]) {
+        swap(&keys[size - 1U], &keys[0]);
+    }
+    if (keys[size - 1U] < keys[mid]) {
+        swap(&keys[size - 1U], &keys[mid]);
+    }
+
+    uint64_t pivot = keys[mid];
+    size_t i       = 0;
+    size_t j       = size - 1U;
+    for (;;) {
+        while (keys[i] < pivot) {
+            i += 1;
+        }
+        while (keys[j] > pivot) {
+            j -= 1;
+        }
+        if (i >= j) {
+            break;
+        }
+        swap(&keys[i++], &keys[j--]);
+    }
+
+    bp_array_t left  = {sizeof(uint64_t), j + 1U, j + 1U, (uint8_t *) keys};
+    bp_array_t right = {sizeof(uint64_t), size - j - 1U, size - j - 1U,
+                        (uint8_t *) &keys[j + 1U]};
+    bp_ws_group_t group = BP_WS_GROUP_INIT;
+    bp_ws_task_t task   = {.fn = quicksort, .arg = &left};
+
+    bp_ws_spawn(worker, &group, &task);
+    quicksort(worker, &right);
+    bp_ws_wait(worker, &group);
+}
+
+static void fill(uint64_t *keys)
+{
+    uint64_t state = 42;
+
+    for (size_t i = 0; i < RECORDS; ++i) {
+        keys[i] = bench_rand(&state);
+    }
+}
+
+static int check(uint64_t *keys, const char *name)
+{
+    for (size_t i = 1; i < RECORDS; ++i) {
+        if (keys[i - 1] > keys[i]) {
+            printf("%s failed\n", name);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    uint64_t *keys    = malloc(RECORDS * sizeof(uint64_t));
+    uint64_t *scratch = malloc(RECORDS * sizeof(uint64_t));
+    bp_array_t array  = {sizeof(uint64_t), RECORDS, RECORDS, NULL};
+    bp_thread_pool_t pool;
+    static bp_ws_pool_t ws;
+    uint64_t start;
+    uint64_t ws_time;
+    uint64_t par_time;
+    uint64_t base = 0;
+
+    if (keys == NULL || scratch == NULL) {
+        return -1;
+    }
+    array._array = (uint8_t *) keys;
+
+    printf("%u keys of %zu bytes\n", RECORDS, sizeof(uint64_t));
+    printf("%8s %14s %10s %14s\n", "threads", "ws qsort (ms)", "speedup", "par_sort (ms)");
+    for (size_t threads = 1; threads <= 32; threads *= 2) {
+        if (bp_thread_pool_init(&pool, threads) != 0) {
+            break;
+        }
+        bp_ws_pool_init(&ws, &pool);
+
+        fill(keys);
+        start = bench_now_ns();
+        bp_ws_pool_run(&ws, quicksort, &array);
+        ws_time = bench_now_ns() - start;
+        if (check(keys, "ws quicksort") != 0) {
+            return -1;
+        }
+        if (threads == 1) {
+            base = ws_time;
+        }
+
+        fill(keys);
+        start = bench_now_ns();
+        bp_array_par_sort(&pool, &array, cmp_u64, scratch);
+        par_time = bench_now_ns() - start;
+        if (check(keys, "bp_array_par_sort") != 0) {
+            return -1;
+        }
+
+        printf("%8zu %14.2f %9.1fx %14.2f\n", threads, ws_time / 1e6,
+               (double) base / (double) ws_time, par_time / 1e6);
+        bp_thread_pool_deinit(&pool);
+    }
+
+    free(keys);
+    free(scratch);
+
+    return 0;
+}
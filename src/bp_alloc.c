@@ -0,0 +1,76 @@
+/*!
+ * @file bp_alloc.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Implement the allocator based on the C library.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#include "bp_alloc.h"
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Allocate a block with malloc.
+ * @param ctx Not used.
+ * @param size Size (in bytes) of the block.
+ * @return Reference to the block, or NULL on failure.
+ */
+static void *bp_libc_alloc(void *ctx, size_t size);
+
+/*!
+ * Resize a block with realloc.
+ * @param ctx Not used.
+ * @param ptr Reference to the block.
+ * @param old_size Not used.
+ * @param new_size New size (in bytes) of the block.
+ * @return Reference to the resized block, or NULL on failure.
+ */
+static void *bp_libc_realloc(void *ctx, void *ptr, size_t old_size, size_t new_size);
+
+/*!
+ * Free a block with free.
+ * @param ctx Not used.
+ * @param ptr Reference to the block.
+ * @param size Not used.
+ */
+static void bp_libc_free(void *ctx, void *ptr, size_t size);
+
+const bp_allocator_t bp_libc_allocator = {
+    .alloc   = bp_libc_alloc,
+    .realloc = bp_libc_realloc,
+    .free    = bp_libc_free,
+    .ctx     = NULL,
+};
+
+static void *bp_libc_alloc(void *ctx, size_t size)
+{
+    (void) ctx;
+
+    return malloc(size);
+}
+
+static void *bp_libc_realloc(void *ctx, void *ptr, size_t old_size, size_t new_size)
+{
+    (void) ctx;
+    (void) old_size;
+
+    return realloc(ptr, new_size);
+}
+
+static void bp_libc_free(void *ctx, void *ptr, size_t size)
+{
+    (void) ctx;
+    (void) size;
+
+    free(ptr);
+}
+
+#ifdef __cplusplus
+}
+#endif
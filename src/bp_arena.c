@@ -0,0 +1,307 @@
+/*!
+ * @file bp_arena.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Implement the arena structure.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#define _GNU_SOURCE
+#include "bp_arena.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#define BP_ARENA_HAS_MMAP
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Allocate a block with the default alignment. Used by the arena allocator.
+ * @param ctx Reference to bp_arena.
+ * @param size Size (in bytes) of the block.
+ * @return Reference to the block, or NULL if the arena is full.
+ */
+static void *bp_arena_allocator_alloc(void *ctx, size_t size);
+
+/*!
+ * Resize a block. The last block is resized in place, the other ones are moved to a new
+ * block. Used by the arena allocator.
+ * @param ctx Reference to bp_arena.
+ * @param ptr Reference to the block.
+ * @param old_size Current size (in bytes) of the block.
+ * @param new_size New size (in bytes) of the block.
+ * @return Reference to the resized block, or NULL if the arena is full.
+ */
+static void *bp_arena_allocator_realloc(void *ctx, void *ptr, size_t old_size,
+                                        size_t new_size);
+
+/*!
+ * Release a block. Only the last block goes back to the arena. Used by the arena
+ * allocator.
+ * @param ctx Reference to bp_arena.
+ * @param ptr Reference to the block.
+ * @param size Size (in bytes) of the block.
+ */
+static void bp_arena_allocator_free(void *ctx, void *ptr, size_t size);
+
+void *bp_arena_alloc(bp_arena_t *arena, size_t size, size_t align)
+{
+    if (arena == NULL) {
+        return NULL;
+    }
+
+    if (align == 0 || (align & (align - 1U)) != 0) {
+        return NULL;
+    }
+
+    uintptr_t addr  = (uintptr_t) arena->_buffer + arena->_offset;
+    size_t padding  = (size_t) ((align - (addr & (align - 1U))) & (align - 1U));
+    size_t free_len = arena->_capacity - arena->_offset;
+
+    if (padding > free_len || size > free_len - padding) {
+        return NULL;
+    }
+
+    arena->_offset += padding + size;
+
+    return (void *) (addr + padding);
+}
+
+size_t bp_arena_mark(bp_arena_t *arena)
+{
+    if (arena == NULL) {
+        return 0;
+    }
+
+    return arena->_offset;
+}
+
+int bp_arena_reset(bp_arena_t *arena, size_t mark)
+{
+    if (arena == NULL) {
+        return -ENODEV;
+    }
+
+    if (mark > arena->_offset) {
+        return -EINVAL;
+    }
+
+    arena->_offset = mark;
+
+    return 0;
+}
+
+size_t bp_arena_used(bp_arena_t *arena)
+{
+    if (arena == NULL) {
+        return 0;
+    }
+
+    return arena->_offset;
+}
+
+int bp_arena_map(bp_arena_t *arena, size_t size)
+{
+    if (arena == NULL) {
+        return -ENODEV;
+    }
+
+    /* Mapping again would leak the current mapping. */
+    if (arena->_mapped != 0) {
+        return -EBUSY;
+    }
+
+#ifdef BP_ARENA_HAS_MMAP
+    void *ptr = MAP_FAILED;
+
+    if (size >= BP_ARENA_HUGE_PAGE_SIZE) {
+        size = (size + BP_ARENA_HUGE_PAGE_SIZE - 1U) & ~((size_t) BP_ARENA_HUGE_PAGE_SIZE - 1U);
+#ifdef MAP_HUGETLB
+        ptr = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+    }
+
+    if (ptr == MAP_FAILED) {
+        ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED) {
+            return -ENOMEM;
+        }
+#ifdef MADV_HUGEPAGE
+        /* Without reserved huge pages, ask for transparent huge pages. */
+        if (size >= BP_ARENA_HUGE_PAGE_SIZE) {
+            madvise(ptr, size, MADV_HUGEPAGE);
+        }
+#endif
+    }
+
+    arena->_buffer   = ptr;
+    arena->_capacity = size;
+    arena->_offset   = 0;
+    arena->_mapped   = size;
+
+    return 0;
+#else
+    (void) size;
+
+    return -ENOTSUP;
+#endif
+}
+
+int bp_arena_unmap(bp_arena_t *arena)
+{
+    if (arena == NULL) {
+        return -ENODEV;
+    }
+
+    if (arena->_mapped == 0) {
+        return -EINVAL;
+    }
+
+#ifdef BP_ARENA_HAS_MMAP
+    munmap(arena->_buffer, arena->_mapped);
+#endif
+
+    arena->_buffer   = NULL;
+    arena->_capacity = 0;
+    arena->_offset   = 0;
+    arena->_mapped   = 0;
+
+    return 0;
+}
+
+bp_allocator_t bp_arena_allocator(bp_arena_t *arena)
+{
+    bp_allocator_t allocator = {
+        .alloc   = bp_arena_allocator_alloc,
+        .realloc = bp_arena_allocator_realloc,
+        .free    = bp_arena_allocator_free,
+        .ctx     = arena,
+    };
+
+    return allocator;
+}
+
+int bp_arena_array_init(bp_arena_t *arena, bp_array_t *array, size_t element_size,
+                        size_t capacity)
+{
+    if (arena == NULL || array == NULL) {
+        return -ENODEV;
+    }
+
+    if (element_size != 0 && capacity > SIZE_MAX / element_size) {
+        return -ENOMEM;
+    }
+
+    uint8_t *buffer = bp_arena_alloc(arena, element_size * capacity, BP_ARENA_ALIGN);
+    if (buffer == NULL) {
+        return -ENOMEM;
+    }
+
+    array->_element_size = element_size;
+    array->_capacity     = capacity;
+    array->_size         = 0;
+    array->_array        = buffer;
+
+    return 0;
+}
+
+int bp_arena_stack_init(bp_arena_t *arena, bp_stack_t *stack, size_t element_size,
+                        size_t capacity)
+{
+    if (arena == NULL || stack == NULL) {
+        return -ENODEV;
+    }
+
+    if (element_size != 0 && capacity > SIZE_MAX / element_size) {
+        return -ENOMEM;
+    }
+
+    uint8_t *buffer = bp_arena_alloc(arena, element_size * capacity, BP_ARENA_ALIGN);
+    if (buffer == NULL) {
+        return -ENOMEM;
+    }
+
+    stack->_element_size = element_size;
+    stack->_capacity     = capacity;
+    stack->_size         = 0;
+    stack->_buffer       = buffer;
+
+    return 0;
+}
+
+int bp_arena_ring_init(bp_arena_t *arena, bp_ring_t *ring, size_t element_size,
+                       size_t capacity)
+{
+    if (arena == NULL || ring == NULL) {
+        return -ENODEV;
+    }
+
+    if (element_size != 0 && capacity > SIZE_MAX / element_size) {
+        return -ENOMEM;
+    }
+
+    uint8_t *buffer = bp_arena_alloc(arena, element_size * capacity, BP_ARENA_ALIGN);
+    if (buffer == NULL) {
+        return -ENOMEM;
+    }
+
+    ring->_array        = buffer;
+    ring->_element_size = element_size;
+    ring->_capacity     = capacity;
+    ring->_size         = 0;
+    ring->_head         = 0;
+    ring->_tail         = 0;
+
+    return 0;
+}
+
+static void *bp_arena_allocator_alloc(void *ctx, size_t size)
+{
+    return bp_arena_alloc(ctx, size, BP_ARENA_ALIGN);
+}
+
+static void *bp_arena_allocator_realloc(void *ctx, void *ptr, size_t old_size,
+                                        size_t new_size)
+{
+    bp_arena_t *arena = ctx;
+    uint8_t *block    = ptr;
+    uint8_t *end      = arena->_buffer + arena->_offset;
+
+    /* The last block could grow (or shrink) without moving. */
+    if (block + old_size == end) {
+        size_t start = (size_t) (block - arena->_buffer);
+        if (new_size > arena->_capacity - start) {
+            return NULL;
+        }
+        arena->_offset = start + new_size;
+        return block;
+    }
+
+    uint8_t *new_block = bp_arena_alloc(arena, new_size, BP_ARENA_ALIGN);
+    if (new_block == NULL) {
+        return NULL;
+    }
+    memcpy(new_block, block, (old_size < new_size) ? old_size : new_size);
+
+    return new_block;
+}
+
+static void bp_arena_allocator_free(void *ctx, void *ptr, size_t size)
+{
+    bp_arena_t *arena = ctx;
+    uint8_t *block    = ptr;
+
+    if (block + size == arena->_buffer + arena->_offset) {
+        arena->_offset = (size_t) (block - arena->_buffer);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -9,11 +9,16 @@
  *
  */
 #include "bp_array.h"
+#include "bp_bits.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#ifdef _MSC_VER
+#include <malloc.h>
+#endif
+
 /*!
  * Fallback function for compare elements. It's used when the user doesn't provide an
  * function for compare. This function will compare the two elements byte by byte.
@@ -25,6 +30,160 @@ extern "C" {
  */
 static bool bp_array_default_cmp(void *left, void *right, size_t el_size);
 
+/*!
+ * Fallback function for compare a block of elements. It's used when the user doesn't
+ * provide a block predicate. This function will compare each element with the parameter
+ * byte by byte.
+ * @param els Reference to the first element of the block.
+ * @param count Number of elements in the block.
+ * @param param Reference to the parameter used to compare elements.
+ * @param el_size Size of each element.
+ * @return A mask where the i-th bit is set if the i-th element is equal to the parameter.
+ */
+static uint64_t bp_array_default_block_cmp(uint8_t *els, size_t count, void *param,
+                                           size_t el_size);
+
+/*!
+ * Number of slots in the hash set used by bp_array_find_many. It must be a power of two,
+ * greater than BP_ARRAY_FIND_MANY_BATCH, so the probe sequences stay short.
+ */
+#define BP_ARRAY_FIND_MANY_SLOTS (2U * BP_ARRAY_FIND_MANY_BATCH)
+
+/*!
+ * Hash a key, reading it in words of 8 bytes.
+ * @param key Reference to the key.
+ * @param key_size Size (in bytes) of the key.
+ * @return The hash of the key.
+ */
+static inline size_t bp_array_hash_key(const uint8_t *key, size_t key_size);
+
+/*!
+ * Compare two keys byte by byte.
+ * @param left Reference to the first key.
+ * @param right Reference to the second key.
+ * @param key_size Size (in bytes) of the keys.
+ * @return true if the keys are equals.
+ * @return false if the keys are different.
+ */
+static inline bool bp_array_key_eq(const uint8_t *left, const uint8_t *right,
+                                   size_t key_size);
+
+/*!
+ * Resolve up to BP_ARRAY_FIND_MANY_BATCH keys with a single pass over the array.
+ * @param array Reference to bp_array.
+ * @param keys Buffer with the keys of the batch.
+ * @param key_offset Offset (in bytes) of the key field inside the element.
+ * @param key_size Size (in bytes) of a single key.
+ * @param nkeys Number of keys in the batch.
+ * @param out_idx [out] Buffer where the index of each key will be put.
+ * @return The number of keys found.
+ */
+static size_t bp_array_find_many_batch(bp_array_t *array, uint8_t *keys,
+                                       size_t key_offset, size_t key_size, size_t nkeys,
+                                       size_t *out_idx);
+
+/*!
+ * Maximum number of elements in a range sorted by insertion sort.
+ */
+#define BP_ARRAY_INSERTION_SORT_MAX 16U
+
+/*!
+ * Macro to get the address of an element, based on a base address.
+ * @param base Address of the first element.
+ * @param idx Element index.
+ * @param el_size Size of each element.
+ * @return The address of the element.
+ */
+#define BP_ARRAY_EL(base, idx, el_size) (&(base)[(idx) * (el_size)])
+
+/*!
+ * Swap two elements, word by word.
+ * @param left Reference to the first element.
+ * @param right Reference to the second element.
+ * @param el_size Size of each element.
+ */
+static inline void bp_array_swap(uint8_t *left, uint8_t *right, size_t el_size);
+
+/*!
+ * Sort a range with insertion sort.
+ * @param base Address of the first element of the range.
+ * @param n Number of elements in the range.
+ * @param el_size Size of each element.
+ * @param cmp Function to compare two elements.
+ * @param tmp Buffer with space for one element.
+ */
+static void bp_array_insertion_sort(uint8_t *base, size_t n, size_t el_size,
+                                    bp_array_cmp_t cmp, uint8_t *tmp);
+
+/*!
+ * Sort a range with heapsort.
+ * @param base Address of the first element of the range.
+ * @param n Number of elements in the range.
+ * @param el_size Size of each element.
+ * @param cmp Function to compare two elements.
+ */
+static void bp_array_heapsort(uint8_t *base, size_t n, size_t el_size,
+                              bp_array_cmp_t cmp);
+
+/*!
+ * Partition a range around the median of its first, middle and last elements. After
+ * the partition, the elements before the pivot are less than or equal to it, and the
+ * elements after the pivot are greater than or equal to it.
+ * @param base Address of the first element of the range.
+ * @param n Number of elements in the range. Must be at least 3.
+ * @param el_size Size of each element.
+ * @param cmp Function to compare two elements.
+ * @return The final index of the pivot.
+ */
+static size_t bp_array_partition(uint8_t *base, size_t n, size_t el_size,
+                                 bp_array_cmp_t cmp);
+
+/*!
+ * Sort a range with introsort.
+ * @param base Address of the first element of the range.
+ * @param n Number of elements in the range.
+ * @param el_size Size of each element.
+ * @param cmp Function to compare two elements.
+ * @param depth Number of partitions left before switching to heapsort.
+ * @param tmp Buffer with space for one element.
+ */
+static void bp_array_introsort(uint8_t *base, size_t n, size_t el_size,
+                               bp_array_cmp_t cmp, size_t depth, uint8_t *tmp);
+
+/*!
+ * Get the rank of a quantile.
+ * @param quantile The quantile, between 0.0 and 1.0.
+ * @param size Number of elements.
+ * @return The rank of the quantile.
+ */
+static inline size_t bp_array_quantile_rank(double quantile, size_t size);
+
+/*!
+ * Partition a range until the elements at the ranks of the given quantiles are at
+ * their sorted positions.
+ * @param base Address of the first element of the array.
+ * @param first Index of the first element of the range.
+ * @param n Number of elements in the range.
+ * @param el_size Size of each element.
+ * @param cmp Function to compare two elements.
+ * @param quantiles The quantiles whose ranks are inside the range, in ascending order.
+ * @param count Number of quantiles.
+ * @param size Number of elements in the whole array, used to compute the ranks.
+ * @param depth Number of partitions left before switching to heapsort.
+ * @param tmp Buffer with space for one element.
+ */
+static void bp_array_multiselect(uint8_t *base, size_t first, size_t n, size_t el_size,
+                                 bp_array_cmp_t cmp, const double *quantiles,
+                                 size_t count, size_t size, size_t depth, uint8_t *tmp);
+
+/*!
+ * Read an unsigned integer key.
+ * @param key Reference to the key.
+ * @param width Size (in bytes) of the key: 1, 2, 4 or 8.
+ * @return The key value.
+ */
+static inline uint64_t bp_array_read_key(const uint8_t *key, size_t width);
+
 /*!
  * Initialize iterator for bp_array.
  * @param self Reference to the iterator itself.
@@ -164,6 +323,247 @@ void *bp_array_find(bp_array_t *array, void *param, bool (*cmp)(void *, void *))
     return NULL;
 }
 
+size_t bp_array_find_block(bp_array_t *array, void *param, bp_block_cmp_t cmp)
+{
+    if (array == NULL || param == NULL) {
+        return BP_ARRAY_INVALID_INDEX;
+    }
+
+    uint64_t mask;
+    size_t count;
+    uint8_t *els;
+
+    for (size_t i = 0; i < array->_size; i += BP_BLOCK_SIZE) {
+        count = array->_size - i;
+        if (count > BP_BLOCK_SIZE) {
+            count = BP_BLOCK_SIZE;
+        }
+
+        els = &array->_array[i * array->_element_size];
+        if (cmp != NULL) {
+            mask = cmp(els, count, param) & bp_mask64((unsigned int) count);
+        } else {
+            mask = bp_array_default_block_cmp(els, count, param, array->_element_size);
+        }
+
+        if (mask != 0) {
+            return i + bp_ctz64(mask);
+        }
+    }
+
+    return BP_ARRAY_INVALID_INDEX;
+}
+
+size_t bp_array_find_many(bp_array_t *array, void *keys, size_t key_offset,
+                          size_t key_size, size_t nkeys, size_t *out_idx)
+{
+    if (array == NULL || keys == NULL || out_idx == NULL) {
+        return 0;
+    }
+
+    if (key_size == 0 || key_offset + key_size > array->_element_size) {
+        return 0;
+    }
+
+    size_t found = 0;
+    size_t count;
+
+    for (size_t i = 0; i < nkeys; i += count) {
+        count = nkeys - i;
+        if (count > BP_ARRAY_FIND_MANY_BATCH) {
+            count = BP_ARRAY_FIND_MANY_BATCH;
+        }
+
+        found += bp_array_find_many_batch(array, (uint8_t *) keys + i * key_size,
+                                          key_offset, key_size, count, &out_idx[i]);
+    }
+
+    return found;
+}
+
+int bp_array_sort(bp_array_t *array, bp_array_cmp_t cmp)
+{
+    if (array == NULL) {
+        return -ENODEV;
+    }
+
+    if (cmp == NULL) {
+        return -EINVAL;
+    }
+
+    if (array->_size < 2) {
+        return 0;
+    }
+
+#ifdef _MSC_VER
+    uint8_t *tmp = (uint8_t *) alloca(sizeof(uint8_t) * array->_element_size);
+#else
+    uint8_t tmp[array->_element_size];
+#endif
+    size_t depth = 2U * (63U - bp_clz64(array->_size));
+
+    bp_array_introsort(array->_array, array->_size, array->_element_size, cmp, depth,
+                       tmp);
+
+    return 0;
+}
+
+int bp_array_radix_sort_key(bp_array_t *array, size_t offset, size_t width,
+                            void *scratch)
+{
+    if (array == NULL || scratch == NULL) {
+        return -ENODEV;
+    }
+
+    if ((width != 1 && width != 2 && width != 4 && width != 8)
+        || offset + width > array->_element_size) {
+        return -EINVAL;
+    }
+
+    size_t counts[sizeof(uint64_t)][256] = {{0}};
+    size_t el_size                       = array->_element_size;
+    uint8_t *src                         = array->_array;
+    uint8_t *dst                         = scratch;
+    uint8_t *tmp;
+    uint64_t key;
+    size_t sum;
+    size_t count;
+    uint8_t digit;
+
+    /* All the histograms are built in a single pass. */
+    for (size_t i = 0; i < array->_size; ++i) {
+        key = bp_array_read_key(BP_ARRAY_EL(src, i, el_size) + offset, width);
+        for (size_t d = 0; d < width; ++d) {
+            counts[d][(key >> (8U * d)) & 0xFFU] += 1;
+        }
+    }
+
+    for (size_t d = 0; d < width && array->_size > 1; ++d) {
+        key   = bp_array_read_key(src + offset, width);
+        digit = (uint8_t) (key >> (8U * d));
+        /* All elements have the same digit, so this pass wouldn't move anything. */
+        if (counts[d][digit] == array->_size) {
+            continue;
+        }
+
+        sum = 0;
+        for (size_t b = 0; b < 256U; ++b) {
+            count        = counts[d][b];
+            counts[d][b] = sum;
+            sum += count;
+        }
+
+        for (size_t i = 0; i < array->_size; ++i) {
+            key   = bp_array_read_key(BP_ARRAY_EL(src, i, el_size) + offset, width);
+            digit = (uint8_t) (key >> (8U * d));
+            memcpy(BP_ARRAY_EL(dst, counts[d][digit], el_size), BP_ARRAY_EL(src, i, el_size),
+                   el_size);
+            counts[d][digit] += 1;
+        }
+
+        tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    if (src != array->_array) {
+        memcpy(array->_array, src, array->_size * el_size);
+    }
+
+    return 0;
+}
+
+void *bp_array_select(bp_array_t *array, size_t k, bp_array_cmp_t cmp)
+{
+    if (array == NULL || cmp == NULL) {
+        return NULL;
+    }
+
+    if (k >= array->_size) {
+        return NULL;
+    }
+
+#ifdef _MSC_VER
+    uint8_t *tmp = (uint8_t *) alloca(sizeof(uint8_t) * array->_element_size);
+#else
+    uint8_t tmp[array->_element_size];
+#endif
+    size_t el_size = array->_element_size;
+    size_t depth   = 2U * (63U - bp_clz64(array->_size));
+    size_t first   = 0;
+    size_t n       = array->_size;
+    uint8_t *range;
+    size_t pivot;
+
+    for (;;) {
+        range = BP_ARRAY_EL(array->_array, first, el_size);
+
+        if (n <= BP_ARRAY_INSERTION_SORT_MAX) {
+            bp_array_insertion_sort(range, n, el_size, cmp, tmp);
+            break;
+        }
+
+        if (depth == 0) {
+            bp_array_heapsort(range, n, el_size, cmp);
+            break;
+        }
+        depth--;
+
+        /* Keep only the side of the partition that holds the k-th element. */
+        pivot = first + bp_array_partition(range, n, el_size, cmp);
+        if (k == pivot) {
+            break;
+        } else if (k < pivot) {
+            n = pivot - first;
+        } else {
+            n -= pivot + 1U - first;
+            first = pivot + 1U;
+        }
+    }
+
+    return BP_ARRAY_EL(array->_array, k, el_size);
+}
+
+int bp_array_percentiles(bp_array_t *array, bp_array_cmp_t cmp, const double *quantiles,
+                         size_t count, void **out)
+{
+    if (array == NULL || quantiles == NULL || out == NULL) {
+        return -ENODEV;
+    }
+
+    if (cmp == NULL) {
+        return -EINVAL;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        if (!(quantiles[i] >= 0.0 && quantiles[i] <= 1.0)
+            || (i > 0 && quantiles[i] < quantiles[i - 1])) {
+            return -EINVAL;
+        }
+    }
+
+    if (array->_size == 0) {
+        return -ENOENT;
+    }
+
+#ifdef _MSC_VER
+    uint8_t *tmp = (uint8_t *) alloca(sizeof(uint8_t) * array->_element_size);
+#else
+    uint8_t tmp[array->_element_size];
+#endif
+    size_t depth = 2U * (63U - bp_clz64(array->_size));
+
+    bp_array_multiselect(array->_array, 0, array->_size, array->_element_size, cmp,
+                         quantiles, count, array->_size, depth, tmp);
+
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = BP_ARRAY_EL(array->_array, bp_array_quantile_rank(quantiles[i], array->_size),
+                             array->_element_size);
+    }
+
+    return 0;
+}
+
 int bp_array_clear(bp_array_t *array)
 {
     if (array == NULL) {
@@ -215,6 +615,358 @@ static bool bp_array_default_cmp(void *left, void *right, size_t el_size)
     return true;
 }
 
+static uint64_t bp_array_default_block_cmp(uint8_t *els, size_t count, void *param,
+                                           size_t el_size)
+{
+    uint64_t mask = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        if (bp_array_default_cmp(&els[i * el_size], param, el_size)) {
+            mask |= UINT64_C(1) << i;
+        }
+    }
+
+    return mask;
+}
+
+static inline size_t bp_array_hash_key(const uint8_t *key, size_t key_size)
+{
+    uint64_t hash = key_size;
+    uint64_t word;
+    size_t len;
+
+    /* Most keys are integers, so avoid the generic loop for them. */
+    if (key_size == sizeof(uint32_t)) {
+        uint32_t word32;
+        memcpy(&word32, key, sizeof(word32));
+        return (size_t) ((word32 * UINT64_C(0x9E3779B97F4A7C15)) >> 32);
+    }
+
+    if (key_size == sizeof(uint64_t)) {
+        memcpy(&word, key, sizeof(word));
+        return (size_t) ((word * UINT64_C(0x9E3779B97F4A7C15)) >> 32);
+    }
+
+    for (size_t i = 0; i < key_size; i += sizeof(word)) {
+        len  = (key_size - i < sizeof(word)) ? (key_size - i) : sizeof(word);
+        word = 0;
+        memcpy(&word, &key[i], len);
+        hash = (hash ^ word) * UINT64_C(0x9E3779B97F4A7C15);
+    }
+
+    return (size_t) (hash >> 32);
+}
+
+static inline bool bp_array_key_eq(const uint8_t *left, const uint8_t *right,
+                                   size_t key_size)
+{
+    if (key_size == sizeof(uint32_t)) {
+        uint32_t left32;
+        uint32_t right32;
+        memcpy(&left32, left, sizeof(left32));
+        memcpy(&right32, right, sizeof(right32));
+        return left32 == right32;
+    }
+
+    if (key_size == sizeof(uint64_t)) {
+        uint64_t left64;
+        uint64_t right64;
+        memcpy(&left64, left, sizeof(left64));
+        memcpy(&right64, right, sizeof(right64));
+        return left64 == right64;
+    }
+
+    return memcmp(left, right, key_size) == 0;
+}
+
+static size_t bp_array_find_many_batch(bp_array_t *array, uint8_t *keys,
+                                       size_t key_offset, size_t key_size, size_t nkeys,
+                                       size_t *out_idx)
+{
+    /* Each slot holds the key position plus one, so zero means an empty slot. */
+    uint16_t slots[BP_ARRAY_FIND_MANY_SLOTS] = {0};
+    /* Position of the first equal key, to resolve repeated keys at the end. */
+    uint16_t first[BP_ARRAY_FIND_MANY_BATCH];
+    size_t pending = 0;
+    size_t found   = 0;
+    size_t slot;
+    uint8_t *key;
+
+    for (size_t k = 0; k < nkeys; ++k) {
+        key        = &keys[k * key_size];
+        first[k]   = (uint16_t) k;
+        out_idx[k] = BP_ARRAY_INVALID_INDEX;
+
+        slot = bp_array_hash_key(key, key_size) & (BP_ARRAY_FIND_MANY_SLOTS - 1U);
+        while (slots[slot] != 0) {
+            if (bp_array_key_eq(&keys[(slots[slot] - 1U) * key_size], key, key_size)) {
+                first[k] = (uint16_t) (slots[slot] - 1U);
+                break;
+            }
+            slot = (slot + 1U) & (BP_ARRAY_FIND_MANY_SLOTS - 1U);
+        }
+
+        if (slots[slot] == 0) {
+            slots[slot] = (uint16_t) (k + 1U);
+            pending += 1;
+        }
+    }
+
+    uint8_t *el_key = &array->_array[key_offset];
+    size_t k;
+
+    for (size_t i = 0; i < array->_size && pending > 0; ++i) {
+        slot = bp_array_hash_key(el_key, key_size) & (BP_ARRAY_FIND_MANY_SLOTS - 1U);
+        while (slots[slot] != 0) {
+            k = slots[slot] - 1U;
+            if (bp_array_key_eq(&keys[k * key_size], el_key, key_size)) {
+                if (out_idx[k] == BP_ARRAY_INVALID_INDEX) {
+                    out_idx[k] = i;
+                    pending -= 1;
+                }
+                break;
+            }
+            slot = (slot + 1U) & (BP_ARRAY_FIND_MANY_SLOTS - 1U);
+        }
+
+        el_key += array->_element_size;
+    }
+
+    for (k = 0; k < nkeys; ++k) {
+        out_idx[k] = out_idx[first[k]];
+        if (out_idx[k] != BP_ARRAY_INVALID_INDEX) {
+            found += 1;
+        }
+    }
+
+    return found;
+}
+
+static inline void bp_array_swap(uint8_t *left, uint8_t *right, size_t el_size)
+{
+    uint64_t word;
+    uint8_t byte;
+    size_t i = 0;
+
+    for (; i + sizeof(word) <= el_size; i += sizeof(word)) {
+        memcpy(&word, &left[i], sizeof(word));
+        memcpy(&left[i], &right[i], sizeof(word));
+        memcpy(&right[i], &word, sizeof(word));
+    }
+
+    for (; i < el_size; ++i) {
+        byte     = left[i];
+        left[i]  = right[i];
+        right[i] = byte;
+    }
+}
+
+static void bp_array_insertion_sort(uint8_t *base, size_t n, size_t el_size,
+                                    bp_array_cmp_t cmp, uint8_t *tmp)
+{
+    uint8_t *el;
+    size_t j;
+
+    for (size_t i = 1; i < n; ++i) {
+        el = BP_ARRAY_EL(base, i, el_size);
+        if (cmp(el - el_size, el) <= 0) {
+            continue;
+        }
+
+        memcpy(tmp, el, el_size);
+        j = i - 1;
+        while (j > 0 && cmp(BP_ARRAY_EL(base, j - 1, el_size), tmp) > 0) {
+            j--;
+        }
+
+        memmove(BP_ARRAY_EL(base, j + 1, el_size), BP_ARRAY_EL(base, j, el_size),
+                (i - j) * el_size);
+        memcpy(BP_ARRAY_EL(base, j, el_size), tmp, el_size);
+    }
+}
+
+static void bp_array_heapsort(uint8_t *base, size_t n, size_t el_size,
+                              bp_array_cmp_t cmp)
+{
+    size_t root;
+    size_t child;
+
+    /* Build a Max-Heap and move its root to the end, one element at time. The loop
+     * with end == n builds the heap, without removing any element. */
+    for (size_t end = n, start = n / 2; end > 1;) {
+        if (start > 0) {
+            start--;
+        } else {
+            end--;
+            bp_array_swap(base, BP_ARRAY_EL(base, end, el_size), el_size);
+        }
+
+        root = start;
+        while ((child = 2U * root + 1U) < end) {
+            if (child + 1U < end
+                && cmp(BP_ARRAY_EL(base, child, el_size),
+                       BP_ARRAY_EL(base, child + 1U, el_size))
+                       < 0) {
+                child++;
+            }
+
+            if (cmp(BP_ARRAY_EL(base, root, el_size), BP_ARRAY_EL(base, child, el_size))
+                >= 0) {
+                break;
+            }
+
+            bp_array_swap(BP_ARRAY_EL(base, root, el_size),
+                          BP_ARRAY_EL(base, child, el_size), el_size);
+            root = child;
+        }
+    }
+}
+
+static size_t bp_array_partition(uint8_t *base, size_t n, size_t el_size,
+                                 bp_array_cmp_t cmp)
+{
+    uint8_t *first = base;
+    uint8_t *mid   = BP_ARRAY_EL(base, n / 2U, el_size);
+    uint8_t *last  = BP_ARRAY_EL(base, n - 1U, el_size);
+
+    /* Order the first, middle and last elements, so the last element stops the left
+     * scan and the pivot stops the right scan. */
+    if (cmp(mid, first) < 0) {
+        bp_array_swap(mid, first, el_size);
+    }
+    if (cmp(last, mid) < 0) {
+        bp_array_swap(last, mid, el_size);
+        if (cmp(mid, first) < 0) {
+            bp_array_swap(mid, first, el_size);
+        }
+    }
+    bp_array_swap(first, mid, el_size);
+
+    size_t i = 0;
+    size_t j = n;
+
+    for (;;) {
+        do {
+            i++;
+        } while (cmp(BP_ARRAY_EL(base, i, el_size), first) < 0);
+
+        do {
+            j--;
+        } while (cmp(BP_ARRAY_EL(base, j, el_size), first) > 0);
+
+        if (i >= j) {
+            break;
+        }
+
+        bp_array_swap(BP_ARRAY_EL(base, i, el_size), BP_ARRAY_EL(base, j, el_size),
+                      el_size);
+    }
+
+    bp_array_swap(first, BP_ARRAY_EL(base, j, el_size), el_size);
+
+    return j;
+}
+
+static void bp_array_introsort(uint8_t *base, size_t n, size_t el_size,
+                               bp_array_cmp_t cmp, size_t depth, uint8_t *tmp)
+{
+    size_t pivot;
+
+    while (n > BP_ARRAY_INSERTION_SORT_MAX) {
+        if (depth == 0) {
+            bp_array_heapsort(base, n, el_size, cmp);
+            return;
+        }
+        depth--;
+
+        pivot = bp_array_partition(base, n, el_size, cmp);
+
+        /* Recurse on the smaller side, so the stack depth is O(log n). */
+        if (pivot < n - pivot - 1U) {
+            bp_array_introsort(base, pivot, el_size, cmp, depth, tmp);
+            base = BP_ARRAY_EL(base, pivot + 1U, el_size);
+            n    = n - pivot - 1U;
+        } else {
+            bp_array_introsort(BP_ARRAY_EL(base, pivot + 1U, el_size), n - pivot - 1U,
+                               el_size, cmp, depth, tmp);
+            n = pivot;
+        }
+    }
+
+    bp_array_insertion_sort(base, n, el_size, cmp, tmp);
+}
+
+static inline size_t bp_array_quantile_rank(double quantile, size_t size)
+{
+    return (size_t) (quantile * (double) (size - 1U) + 0.5);
+}
+
+static void bp_array_multiselect(uint8_t *base, size_t first, size_t n, size_t el_size,
+                                 bp_array_cmp_t cmp, const double *quantiles,
+                                 size_t count, size_t size, size_t depth, uint8_t *tmp)
+{
+    uint8_t *range;
+    size_t pivot;
+    size_t left;
+
+    while (count > 0) {
+        range = BP_ARRAY_EL(base, first, el_size);
+
+        if (n <= BP_ARRAY_INSERTION_SORT_MAX) {
+            bp_array_insertion_sort(range, n, el_size, cmp, tmp);
+            return;
+        }
+
+        if (depth == 0) {
+            bp_array_heapsort(range, n, el_size, cmp);
+            return;
+        }
+        depth--;
+
+        pivot = first + bp_array_partition(range, n, el_size, cmp);
+
+        /* The ranks are ascending, so the ones before the pivot are a prefix. */
+        left = 0;
+        while (left < count && bp_array_quantile_rank(quantiles[left], size) < pivot) {
+            left++;
+        }
+        bp_array_multiselect(base, first, pivot - first, el_size, cmp, quantiles, left,
+                             size, depth, tmp);
+
+        /* Skip the ranks at the pivot, they are already in place. */
+        while (left < count && bp_array_quantile_rank(quantiles[left], size) == pivot) {
+            left++;
+        }
+        quantiles += left;
+        count -= left;
+        n -= pivot + 1U - first;
+        first = pivot + 1U;
+    }
+}
+
+static inline uint64_t bp_array_read_key(const uint8_t *key, size_t width)
+{
+    uint8_t key8;
+    uint16_t key16;
+    uint32_t key32;
+    uint64_t key64;
+
+    switch (width) {
+    case 1:
+        memcpy(&key8, key, sizeof(key8));
+        return key8;
+    case 2:
+        memcpy(&key16, key, sizeof(key16));
+        return key16;
+    case 4:
+        memcpy(&key32, key, sizeof(key32));
+        return key32;
+    default:
+        memcpy(&key64, key, sizeof(key64));
+        return key64;
+    }
+}
+
 static void *bp_array_iter_init(struct bp_iter *self)
 {
     bp_array_t *array = self->coll;
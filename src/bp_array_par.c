@@ -0,0 +1,493 @@
+/*!
+ * @file bp_array_par.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Implement the parallel algorithms over the array structure.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#include "bp_array_par.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Struct with the state shared by the workers of a parallel scan.
+ */
+typedef struct {
+    bp_array_t *array;                   /*!< Reference to the scanned array. */
+    void *param;                         /*!< Parameter used to compare elements. */
+    bool (*cmp)(void *el, void *param);  /*!< Function to compare elements. */
+    void (*fn)(void *el, void *param);   /*!< Function called for each element. */
+    size_t chunk;                        /*!< Number of elements in each chunk. */
+    size_t nchunks;                      /*!< Number of chunks in the array. */
+    size_t next_chunk;                   /*!< Next chunk to be claimed. */
+    size_t found;                        /*!< Lowest index found, or the count. */
+} bp_array_par_scan_t;
+
+/*!
+ * Struct with the state shared by the workers of a parallel sort.
+ */
+typedef struct {
+    bp_array_t *array;   /*!< Reference to the sorted array. */
+    bp_array_cmp_t cmp;  /*!< Function to compare elements. */
+    uint8_t *src;        /*!< Buffer with the runs of the current round. */
+    uint8_t *dst;        /*!< Buffer where the merged runs are written. */
+    size_t nruns;        /*!< Number of sorted runs. */
+    size_t bounds[BP_THREAD_POOL_MAX_THREADS + 1]; /*!< Start index of each run. */
+} bp_array_par_sort_t;
+
+/*!
+ * Get the number of elements in each chunk. The chunk size is a multiple of the cache
+ * line size and of the element size, close to BP_ARRAY_PAR_CHUNK_SIZE.
+ * @param element_size Size (in bytes) of a single element.
+ * @return The number of elements in each chunk.
+ */
+static size_t bp_array_par_chunk(size_t element_size);
+
+/*!
+ * Initialize the state of a parallel scan.
+ * @param scan [out] Reference to the state.
+ * @param array Reference to bp_array.
+ * @param param Parameter passed to the compare function.
+ * @param cmp Function to compare elements.
+ * @param found Initial value of the 'found' field.
+ */
+static void bp_array_par_scan_init(bp_array_par_scan_t *scan, bp_array_t *array,
+                                   void *param, bool (*cmp)(void *, void *),
+                                   size_t found);
+
+/*!
+ * Compare an element with the parameter.
+ * @param scan Reference to the scan state.
+ * @param el Reference to the element.
+ * @return true if the element matches the parameter.
+ */
+static inline bool bp_array_par_match(bp_array_par_scan_t *scan, void *el);
+
+/*!
+ * Job of bp_array_par_find_idx.
+ * @param arg Reference to the scan state.
+ * @param worker Index of the worker.
+ * @param nworkers Number of workers.
+ */
+static void bp_array_par_find_job(void *arg, size_t worker, size_t nworkers);
+
+/*!
+ * Job of bp_array_par_count.
+ * @param arg Reference to the scan state.
+ * @param worker Index of the worker.
+ * @param nworkers Number of workers.
+ */
+static void bp_array_par_count_job(void *arg, size_t worker, size_t nworkers);
+
+/*!
+ * Job of bp_array_par_for_each.
+ * @param arg Reference to the scan state.
+ * @param worker Index of the worker.
+ * @param nworkers Number of workers.
+ */
+static void bp_array_par_for_each_job(void *arg, size_t worker, size_t nworkers);
+
+/*!
+ * Job that sorts one run of the array for each worker.
+ * @param arg Reference to the sort state.
+ * @param worker Index of the worker.
+ * @param nworkers Number of workers.
+ */
+static void bp_array_par_sort_job(void *arg, size_t worker, size_t nworkers);
+
+/*!
+ * Job that merges the runs in pairs. Each worker writes an even slice of the output.
+ * @param arg Reference to the sort state.
+ * @param worker Index of the worker.
+ * @param nworkers Number of workers.
+ */
+static void bp_array_par_merge_job(void *arg, size_t worker, size_t nworkers);
+
+/*!
+ * Job that copies the sorted elements from the scratch buffer back to the array.
+ * @param arg Reference to the sort state.
+ * @param worker Index of the worker.
+ * @param nworkers Number of workers.
+ */
+static void bp_array_par_copy_job(void *arg, size_t worker, size_t nworkers);
+
+/*!
+ * Find how many elements of the run 'a' are among the first 'out' elements of the
+ * merge of the runs 'a' and 'b'. When the elements are equal, the ones from 'a' come
+ * first, so the merge is stable.
+ * @param out Number of elements in the merge output.
+ * @param a Address of the first run.
+ * @param na Number of elements in the first run.
+ * @param b Address of the second run.
+ * @param nb Number of elements in the second run.
+ * @param el_size Size of each element.
+ * @param cmp Function to compare two elements.
+ * @return The number of elements of 'a' in the output.
+ */
+static size_t bp_array_par_co_rank(size_t out, uint8_t *a, size_t na, uint8_t *b,
+                                   size_t nb, size_t el_size, bp_array_cmp_t cmp);
+
+size_t bp_array_par_find_idx(bp_thread_pool_t *pool, bp_array_t *array, void *param,
+                             bool (*cmp)(void *, void *))
+{
+    if (pool == NULL || array == NULL || param == NULL) {
+        return BP_ARRAY_INVALID_INDEX;
+    }
+
+    bp_array_par_scan_t scan;
+
+    bp_array_par_scan_init(&scan, array, param, cmp, BP_ARRAY_INVALID_INDEX);
+    bp_thread_pool_run(pool, bp_array_par_find_job, &scan);
+
+    return scan.found;
+}
+
+size_t bp_array_par_count(bp_thread_pool_t *pool, bp_array_t *array, void *param,
+                          bool (*cmp)(void *, void *))
+{
+    if (pool == NULL || array == NULL || param == NULL) {
+        return 0;
+    }
+
+    bp_array_par_scan_t scan;
+
+    bp_array_par_scan_init(&scan, array, param, cmp, 0);
+    bp_thread_pool_run(pool, bp_array_par_count_job, &scan);
+
+    return scan.found;
+}
+
+int bp_array_par_for_each(bp_thread_pool_t *pool, bp_array_t *array,
+                          void (*fn)(void *, void *), void *param)
+{
+    if (pool == NULL || array == NULL || fn == NULL) {
+        return -ENODEV;
+    }
+
+    bp_array_par_scan_t scan;
+
+    bp_array_par_scan_init(&scan, array, param, NULL, 0);
+    scan.fn = fn;
+    bp_thread_pool_run(pool, bp_array_par_for_each_job, &scan);
+
+    return 0;
+}
+
+int bp_array_par_sort(bp_thread_pool_t *pool, bp_array_t *array, bp_array_cmp_t cmp,
+                      void *scratch)
+{
+    if (pool == NULL || array == NULL || scratch == NULL) {
+        return -ENODEV;
+    }
+
+    if (cmp == NULL) {
+        return -EINVAL;
+    }
+
+    size_t nworkers = bp_thread_pool_size(pool);
+
+    if (nworkers < 2 || array->_size < BP_ARRAY_PAR_SORT_MIN) {
+        return bp_array_sort(array, cmp);
+    }
+
+    bp_array_par_sort_t sort;
+    size_t nruns;
+
+    sort.array = array;
+    sort.cmp   = cmp;
+    sort.src   = array->_array;
+    sort.dst   = scratch;
+    sort.nruns = nworkers;
+    for (size_t i = 0; i <= nworkers; ++i) {
+        sort.bounds[i] = array->_size * i / nworkers;
+    }
+
+    bp_thread_pool_run(pool, bp_array_par_sort_job, &sort);
+
+    while (sort.nruns > 1) {
+        bp_thread_pool_run(pool, bp_array_par_merge_job, &sort);
+
+        /* Each pair of runs became a single run. */
+        nruns = (sort.nruns + 1U) / 2U;
+        for (size_t i = 0; i < nruns; ++i) {
+            sort.bounds[i] = sort.bounds[2U * i];
+        }
+        sort.bounds[nruns] = array->_size;
+        sort.nruns         = nruns;
+
+        uint8_t *tmp = sort.src;
+        sort.src     = sort.dst;
+        sort.dst     = tmp;
+    }
+
+    if (sort.src != array->_array) {
+        bp_thread_pool_run(pool, bp_array_par_copy_job, &sort);
+    }
+
+    return 0;
+}
+
+static size_t bp_array_par_chunk(size_t element_size)
+{
+    size_t a = element_size;
+    size_t b = BP_CACHE_LINE_SIZE;
+    size_t tmp;
+
+    /* The smallest chunk that ends at a cache line boundary has 64 / gcd elements. */
+    while (b != 0) {
+        tmp = a % b;
+        a   = b;
+        b   = tmp;
+    }
+
+    size_t line_els = BP_CACHE_LINE_SIZE / a;
+    size_t chunk    = (BP_ARRAY_PAR_CHUNK_SIZE / element_size) / line_els * line_els;
+
+    return (chunk == 0) ? line_els : chunk;
+}
+
+static void bp_array_par_scan_init(bp_array_par_scan_t *scan, bp_array_t *array,
+                                   void *param, bool (*cmp)(void *, void *),
+                                   size_t found)
+{
+    scan->array      = array;
+    scan->param      = param;
+    scan->cmp        = cmp;
+    scan->fn         = NULL;
+    scan->chunk      = bp_array_par_chunk(array->_element_size);
+    scan->nchunks    = (array->_size + scan->chunk - 1U) / scan->chunk;
+    scan->next_chunk = 0;
+    scan->found      = found;
+}
+
+static inline bool bp_array_par_match(bp_array_par_scan_t *scan, void *el)
+{
+    if (scan->cmp != NULL) {
+        return scan->cmp(el, scan->param);
+    }
+
+    return memcmp(el, scan->param, scan->array->_element_size) == 0;
+}
+
+static void bp_array_par_find_job(void *arg, size_t worker, size_t nworkers)
+{
+    bp_array_par_scan_t *scan = arg;
+    bp_array_t *array         = scan->array;
+    size_t chunk;
+    size_t start;
+    size_t end;
+    size_t found;
+
+    (void) worker;
+    (void) nworkers;
+
+    for (;;) {
+        chunk = __atomic_fetch_add(&scan->next_chunk, 1U, __ATOMIC_RELAXED);
+        if (chunk >= scan->nchunks) {
+            return;
+        }
+
+        /* The chunks are claimed in increasing order, so after a match, all the next
+         * chunks could be skipped. */
+        start = chunk * scan->chunk;
+        found = __atomic_load_n(&scan->found, __ATOMIC_RELAXED);
+        if (start >= found) {
+            return;
+        }
+
+        end = start + scan->chunk;
+        if (end > array->_size) {
+            end = array->_size;
+        }
+
+        for (size_t i = start; i < end; ++i) {
+            if (bp_array_par_match(scan, &array->_array[i * array->_element_size])) {
+                while (i < found && !__atomic_compare_exchange_n(&scan->found, &found, i,
+                                                                 false, __ATOMIC_RELAXED,
+                                                                 __ATOMIC_RELAXED)) {
+                }
+                return;
+            }
+        }
+    }
+}
+
+static void bp_array_par_count_job(void *arg, size_t worker, size_t nworkers)
+{
+    bp_array_par_scan_t *scan = arg;
+    bp_array_t *array         = scan->array;
+    size_t count              = 0;
+    size_t chunk;
+    size_t start;
+    size_t end;
+
+    (void) worker;
+    (void) nworkers;
+
+    for (;;) {
+        chunk = __atomic_fetch_add(&scan->next_chunk, 1U, __ATOMIC_RELAXED);
+        if (chunk >= scan->nchunks) {
+            break;
+        }
+
+        start = chunk * scan->chunk;
+        end   = start + scan->chunk;
+        if (end > array->_size) {
+            end = array->_size;
+        }
+
+        for (size_t i = start; i < end; ++i) {
+            count += bp_array_par_match(scan, &array->_array[i * array->_element_size]);
+        }
+    }
+
+    __atomic_fetch_add(&scan->found, count, __ATOMIC_RELAXED);
+}
+
+static void bp_array_par_for_each_job(void *arg, size_t worker, size_t nworkers)
+{
+    bp_array_par_scan_t *scan = arg;
+    bp_array_t *array         = scan->array;
+    size_t chunk;
+    size_t start;
+    size_t end;
+
+    (void) worker;
+    (void) nworkers;
+
+    for (;;) {
+        chunk = __atomic_fetch_add(&scan->next_chunk, 1U, __ATOMIC_RELAXED);
+        if (chunk >= scan->nchunks) {
+            return;
+        }
+
+        start = chunk * scan->chunk;
+        end   = start + scan->chunk;
+        if (end > array->_size) {
+            end = array->_size;
+        }
+
+        for (size_t i = start; i < end; ++i) {
+            scan->fn(&array->_array[i * array->_element_size], scan->param);
+        }
+    }
+}
+
+static void bp_array_par_sort_job(void *arg, size_t worker, size_t nworkers)
+{
+    bp_array_par_sort_t *sort = arg;
+    size_t el_size            = sort->array->_element_size;
+    size_t start              = sort->bounds[worker];
+    size_t size               = sort->bounds[worker + 1U] - start;
+    bp_array_t run            = {
+        ._element_size = el_size,
+        ._capacity     = size,
+        ._size         = size,
+        ._array        = &sort->src[start * el_size],
+    };
+
+    (void) nworkers;
+
+    bp_array_sort(&run, sort->cmp);
+}
+
+static void bp_array_par_merge_job(void *arg, size_t worker, size_t nworkers)
+{
+    bp_array_par_sort_t *sort = arg;
+    size_t el_size            = sort->array->_element_size;
+    size_t total              = sort->array->_size;
+    size_t out_start          = total * worker / nworkers;
+    size_t out_end            = total * (worker + 1U) / nworkers;
+    size_t lo;
+    size_t mid;
+    size_t hi;
+    size_t first;
+    size_t last;
+    size_t i;
+    size_t j;
+    uint8_t *a;
+    uint8_t *b;
+    uint8_t *out;
+
+    for (size_t r = 0; r < sort->nruns; r += 2U) {
+        lo = sort->bounds[r];
+        hi = sort->bounds[(r + 2U < sort->nruns) ? (r + 2U) : sort->nruns];
+        if (hi <= out_start || lo >= out_end) {
+            continue;
+        }
+
+        /* Slice of the merge output written by this worker. */
+        first = (out_start > lo) ? out_start : lo;
+        last  = (out_end < hi) ? out_end : hi;
+        out   = &sort->dst[first * el_size];
+
+        if (r + 1U >= sort->nruns) {
+            /* The last run doesn't have a pair, so it's only copied. */
+            memcpy(out, &sort->src[first * el_size], (last - first) * el_size);
+            continue;
+        }
+
+        mid = sort->bounds[r + 1U];
+        a   = &sort->src[lo * el_size];
+        b   = &sort->src[mid * el_size];
+        i   = bp_array_par_co_rank(first - lo, a, mid - lo, b, hi - mid, el_size,
+                                   sort->cmp);
+        j   = (first - lo) - i;
+
+        for (size_t k = first; k < last; ++k) {
+            if (j >= hi - mid
+                || (i < mid - lo
+                    && sort->cmp(&a[i * el_size], &b[j * el_size]) <= 0)) {
+                memcpy(out, &a[i * el_size], el_size);
+                i++;
+            } else {
+                memcpy(out, &b[j * el_size], el_size);
+                j++;
+            }
+            out += el_size;
+        }
+    }
+}
+
+static void bp_array_par_copy_job(void *arg, size_t worker, size_t nworkers)
+{
+    bp_array_par_sort_t *sort = arg;
+    size_t el_size            = sort->array->_element_size;
+    size_t total              = sort->array->_size;
+    size_t start              = total * worker / nworkers;
+    size_t end                = total * (worker + 1U) / nworkers;
+
+    memcpy(&sort->array->_array[start * el_size], &sort->src[start * el_size],
+           (end - start) * el_size);
+}
+
+static size_t bp_array_par_co_rank(size_t out, uint8_t *a, size_t na, uint8_t *b,
+                                   size_t nb, size_t el_size, bp_array_cmp_t cmp)
+{
+    size_t lo = (out > nb) ? (out - nb) : 0;
+    size_t hi = (out < na) ? out : na;
+    size_t i;
+    size_t j;
+
+    /* Find the first 'i' where a[i] doesn't need to come before b[out - i - 1]. */
+    while (lo < hi) {
+        i = lo + (hi - lo) / 2U;
+        j = out - i;
+        if (j > 0 && cmp(&a[i * el_size], &b[(j - 1U) * el_size]) <= 0) {
+            lo = i + 1U;
+        } else {
+            hi = i;
+        }
+    }
+
+    return lo;
+}
+
+#ifdef __cplusplus
+}
+#endif
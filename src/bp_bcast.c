@@ -0,0 +1,182 @@
+/*!
+ * @file bp_bcast.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Implement the broadcast ring.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#include <string.h>
+
+#include "bp_bcast.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Get the slot of a sequence number in the buffer.
+ * @param bcast Reference to bp_bcast.
+ * @param seq The sequence number.
+ */
+#define BP_BCAST_SLOT(bcast, seq) ((size_t) (seq) & ((bcast)->_capacity - 1U))
+
+/*!
+ * Find the slowest reader cursor.
+ * @param bcast Reference to bp_bcast.
+ * @return The smallest cursor, or the published sequence if there are no readers.
+ */
+static uint64_t bp_bcast_slowest(bp_bcast_t *bcast);
+
+int bp_bcast_publish(bp_bcast_t *bcast, const void *els, size_t count)
+{
+    if (bcast == NULL || els == NULL) {
+        return -ENODEV;
+    }
+
+    if (bcast->_capacity == 0 || (bcast->_capacity & (bcast->_capacity - 1U)) != 0 ||
+        count > bcast->_capacity) {
+        return -EINVAL;
+    }
+
+    uint64_t published = bcast->_published;
+
+    if (bcast->_lossy) {
+        /* Announce the records before writing them, so a reader of the slots being
+         * overwritten can detect it, as with a seqlock. */
+        __atomic_store_n(&bcast->_claimed, published + count, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+    } else if (published + count - bcast->_gate > bcast->_capacity) {
+        /* The cursors are only read when the cached one doesn't leave enough room. */
+        bcast->_gate = bp_bcast_slowest(bcast);
+        if (published + count - bcast->_gate > bcast->_capacity) {
+            return -EAGAIN;
+        }
+    }
+
+    size_t slot  = BP_BCAST_SLOT(bcast, published);
+    size_t first = bcast->_capacity - slot;
+
+    if (first > count) {
+        first = count;
+    }
+
+    memcpy(&bcast->_array[slot * bcast->_element_size], els, first * bcast->_element_size);
+    if (count > first) {
+        memcpy(bcast->_array, (const uint8_t *) els + first * bcast->_element_size,
+               (count - first) * bcast->_element_size);
+    }
+
+    __atomic_store_n(&bcast->_published, published + count, __ATOMIC_RELEASE);
+
+    return 0;
+}
+
+int bp_bcast_claim(bp_bcast_t *bcast, size_t reader, size_t max, bp_bcast_batch_t *batch)
+{
+    if (bcast == NULL || batch == NULL) {
+        return -ENODEV;
+    }
+
+    if (reader >= bcast->_nreaders) {
+        return -EINVAL;
+    }
+
+    uint64_t seq       = __atomic_load_n(&bcast->_cursors[reader]._seq, __ATOMIC_RELAXED);
+    uint64_t published = __atomic_load_n(&bcast->_published, __ATOMIC_ACQUIRE);
+    uint64_t missed    = 0;
+
+    if (published == seq) {
+        return -ENOENT;
+    }
+
+    /* Only the lossy mode can leave a reader more than a whole buffer behind. */
+    if (published - seq > bcast->_capacity) {
+        missed = published - bcast->_capacity - seq;
+        seq    = published - bcast->_capacity;
+    }
+
+    size_t slot  = BP_BCAST_SLOT(bcast, seq);
+    size_t count = (size_t) (published - seq);
+
+    if (count > bcast->_capacity - slot) {
+        count = bcast->_capacity - slot;
+    }
+    if (max > 0 && count > max) {
+        count = max;
+    }
+
+    batch->els    = &bcast->_array[slot * bcast->_element_size];
+    batch->count  = count;
+    batch->seq    = seq;
+    batch->missed = missed;
+
+    return 0;
+}
+
+int bp_bcast_release(bp_bcast_t *bcast, size_t reader, bp_bcast_batch_t *batch)
+{
+    if (bcast == NULL || batch == NULL) {
+        return -ENODEV;
+    }
+
+    if (reader >= bcast->_nreaders) {
+        return -EINVAL;
+    }
+
+    bool stale = false;
+
+    if (bcast->_lossy) {
+        /* The record 'seq' is overwritten by the record 'seq + capacity'. */
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        uint64_t claimed = __atomic_load_n(&bcast->_claimed, __ATOMIC_RELAXED);
+        stale            = claimed > batch->seq + bcast->_capacity;
+    }
+
+    __atomic_store_n(&bcast->_cursors[reader]._seq, batch->seq + batch->count,
+                     __ATOMIC_RELEASE);
+
+    return stale ? -ESTALE : 0;
+}
+
+size_t bp_bcast_pending(bp_bcast_t *bcast, size_t reader)
+{
+    if (bcast == NULL || reader >= bcast->_nreaders) {
+        return 0;
+    }
+
+    uint64_t published = __atomic_load_n(&bcast->_published, __ATOMIC_ACQUIRE);
+    uint64_t pending =
+        published - __atomic_load_n(&bcast->_cursors[reader]._seq, __ATOMIC_RELAXED);
+
+    return (pending > bcast->_capacity) ? bcast->_capacity : (size_t) pending;
+}
+
+uint64_t bp_bcast_published(bp_bcast_t *bcast)
+{
+    if (bcast == NULL) {
+        return 0;
+    }
+
+    return __atomic_load_n(&bcast->_published, __ATOMIC_ACQUIRE);
+}
+
+static uint64_t bp_bcast_slowest(bp_bcast_t *bcast)
+{
+    uint64_t slowest = bcast->_published;
+
+    for (size_t i = 0; i < bcast->_nreaders; ++i) {
+        uint64_t seq = __atomic_load_n(&bcast->_cursors[i]._seq, __ATOMIC_ACQUIRE);
+        if (seq < slowest) {
+            slowest = seq;
+        }
+    }
+
+    return slowest;
+}
+
+#ifdef __cplusplus
+}
+#endif
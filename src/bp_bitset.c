@@ -0,0 +1,319 @@
+/*!
+ * @file bp_bitset.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Implement the bitset structure.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#include <string.h>
+
+#include "bp_bitset.h"
+#include "bp_bits.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define BP_BITSET_AVX2
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define BP_BITSET_SSE2
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Enumerate the bulk operations between two bitsets.
+ */
+typedef enum {
+    BP_BITSET_AND,
+    BP_BITSET_OR,
+    BP_BITSET_XOR,
+    BP_BITSET_ANDNOT,
+} bp_bitset_op_t;
+
+/*!
+ * Get the word of a bit.
+ * @param idx Index of the bit.
+ */
+#define BP_BITSET_WORD(idx) ((idx) / BP_BITSET_WORD_BITS)
+
+/*!
+ * Get the mask of a bit, inside its word.
+ * @param idx Index of the bit.
+ */
+#define BP_BITSET_MASK(idx) (UINT64_C(1) << ((idx) % BP_BITSET_WORD_BITS))
+
+/*!
+ * Apply a bulk operation over the words of two bitsets.
+ * @param dst Reference to the bitset with the result.
+ * @param src Reference to the other operand.
+ * @param op The operation.
+ * @return 0 on success.
+ * @return -ENODEV if any argument is NULL.
+ * @return -EINVAL if the bitsets don't have the same number of bits.
+ */
+static int bp_bitset_apply(bp_bitset_t *dst, bp_bitset_t *src, bp_bitset_op_t op);
+
+int bp_bitset_set(bp_bitset_t *bitset, size_t idx)
+{
+    if (bitset == NULL) {
+        return -ENODEV;
+    }
+
+    if (idx >= bitset->_bits) {
+        return -EINVAL;
+    }
+
+    bitset->_words[BP_BITSET_WORD(idx)] |= BP_BITSET_MASK(idx);
+
+    return 0;
+}
+
+int bp_bitset_unset(bp_bitset_t *bitset, size_t idx)
+{
+    if (bitset == NULL) {
+        return -ENODEV;
+    }
+
+    if (idx >= bitset->_bits) {
+        return -EINVAL;
+    }
+
+    bitset->_words[BP_BITSET_WORD(idx)] &= ~BP_BITSET_MASK(idx);
+
+    return 0;
+}
+
+bool bp_bitset_test(bp_bitset_t *bitset, size_t idx)
+{
+    if (bitset == NULL || idx >= bitset->_bits) {
+        return false;
+    }
+
+    return (bitset->_words[BP_BITSET_WORD(idx)] & BP_BITSET_MASK(idx)) != 0;
+}
+
+int bp_bitset_fill(bp_bitset_t *bitset)
+{
+    if (bitset == NULL) {
+        return -ENODEV;
+    }
+
+    if (bitset->_nwords == 0) {
+        return 0;
+    }
+
+    memset(bitset->_words, 0xFF, bitset->_nwords * sizeof(uint64_t));
+
+    /* The bits past the end stay cleared, so the scans and counts can ignore them. */
+    if (bitset->_bits % BP_BITSET_WORD_BITS != 0) {
+        bitset->_words[bitset->_nwords - 1U] = BP_BITSET_MASK(bitset->_bits) - 1U;
+    }
+
+    return 0;
+}
+
+int bp_bitset_clear(bp_bitset_t *bitset)
+{
+    if (bitset == NULL) {
+        return -ENODEV;
+    }
+
+    if (bitset->_nwords > 0) {
+        memset(bitset->_words, 0, bitset->_nwords * sizeof(uint64_t));
+    }
+
+    return 0;
+}
+
+size_t bp_bitset_find_first(bp_bitset_t *bitset)
+{
+    return bp_bitset_find_next(bitset, 0);
+}
+
+size_t bp_bitset_find_next(bp_bitset_t *bitset, size_t idx)
+{
+    if (bitset == NULL) {
+        return 0;
+    }
+
+    if (idx >= bitset->_bits) {
+        return bitset->_bits;
+    }
+
+    size_t w      = BP_BITSET_WORD(idx);
+    uint64_t word = bitset->_words[w] & ~(BP_BITSET_MASK(idx) - 1U);
+
+    while (word == 0) {
+        if (++w == bitset->_nwords) {
+            return bitset->_bits;
+        }
+        word = bitset->_words[w];
+    }
+
+    return w * BP_BITSET_WORD_BITS + bp_ctz64(word);
+}
+
+size_t bp_bitset_count(bp_bitset_t *bitset)
+{
+    if (bitset == NULL) {
+        return 0;
+    }
+
+    return bp_bitset_rank(bitset, bitset->_bits);
+}
+
+size_t bp_bitset_rank(bp_bitset_t *bitset, size_t idx)
+{
+    if (bitset == NULL) {
+        return 0;
+    }
+
+    if (idx > bitset->_bits) {
+        idx = bitset->_bits;
+    }
+
+    size_t count = 0;
+    size_t w     = 0;
+
+    for (; w < BP_BITSET_WORD(idx); ++w) {
+        count += bp_popcount64(bitset->_words[w]);
+    }
+    if (idx % BP_BITSET_WORD_BITS != 0) {
+        count += bp_popcount64(bitset->_words[w] & (BP_BITSET_MASK(idx) - 1U));
+    }
+
+    return count;
+}
+
+size_t bp_bitset_select(bp_bitset_t *bitset, size_t nth)
+{
+    if (bitset == NULL) {
+        return 0;
+    }
+
+    for (size_t w = 0; w < bitset->_nwords; ++w) {
+        uint64_t word = bitset->_words[w];
+        size_t count  = bp_popcount64(word);
+
+        if (nth >= count) {
+            nth -= count;
+            continue;
+        }
+
+        /* Drop the lowest set bits until the wanted one is the lowest. */
+        for (; nth > 0; --nth) {
+            word &= word - 1U;
+        }
+
+        return w * BP_BITSET_WORD_BITS + bp_ctz64(word);
+    }
+
+    return bitset->_bits;
+}
+
+int bp_bitset_and(bp_bitset_t *dst, bp_bitset_t *src)
+{
+    return bp_bitset_apply(dst, src, BP_BITSET_AND);
+}
+
+int bp_bitset_or(bp_bitset_t *dst, bp_bitset_t *src)
+{
+    return bp_bitset_apply(dst, src, BP_BITSET_OR);
+}
+
+int bp_bitset_xor(bp_bitset_t *dst, bp_bitset_t *src)
+{
+    return bp_bitset_apply(dst, src, BP_BITSET_XOR);
+}
+
+int bp_bitset_andnot(bp_bitset_t *dst, bp_bitset_t *src)
+{
+    return bp_bitset_apply(dst, src, BP_BITSET_ANDNOT);
+}
+
+static int bp_bitset_apply(bp_bitset_t *dst, bp_bitset_t *src, bp_bitset_op_t op)
+{
+    if (dst == NULL || src == NULL) {
+        return -ENODEV;
+    }
+
+    if (dst->_bits != src->_bits) {
+        return -EINVAL;
+    }
+
+    uint64_t *a       = dst->_words;
+    const uint64_t *b = src->_words;
+    size_t n          = dst->_nwords;
+    size_t i          = 0;
+
+    /* The operation is picked for each vector, but the branch always goes the same way. */
+#if defined(BP_BITSET_AVX2)
+    for (; i + 4U <= n; i += 4U) {
+        __m256i x = _mm256_loadu_si256((const __m256i *) &a[i]);
+        __m256i y = _mm256_loadu_si256((const __m256i *) &b[i]);
+        switch (op) {
+        case BP_BITSET_AND:
+            x = _mm256_and_si256(x, y);
+            break;
+        case BP_BITSET_OR:
+            x = _mm256_or_si256(x, y);
+            break;
+        case BP_BITSET_XOR:
+            x = _mm256_xor_si256(x, y);
+            break;
+        case BP_BITSET_ANDNOT:
+            x = _mm256_andnot_si256(y, x);
+            break;
+        }
+        _mm256_storeu_si256((__m256i *) &a[i], x);
+    }
+#elif defined(BP_BITSET_SSE2)
+    for (; i + 2U <= n; i += 2U) {
+        __m128i x = _mm_loadu_si128((const __m128i *) &a[i]);
+        __m128i y = _mm_loadu_si128((const __m128i *) &b[i]);
+        switch (op) {
+        case BP_BITSET_AND:
+            x = _mm_and_si128(x, y);
+            break;
+        case BP_BITSET_OR:
+            x = _mm_or_si128(x, y);
+            break;
+        case BP_BITSET_XOR:
+            x = _mm_xor_si128(x, y);
+            break;
+        case BP_BITSET_ANDNOT:
+            x = _mm_andnot_si128(y, x);
+            break;
+        }
+        _mm_storeu_si128((__m128i *) &a[i], x);
+    }
+#endif
+
+    for (; i < n; ++i) {
+        switch (op) {
+        case BP_BITSET_AND:
+            a[i] &= b[i];
+            break;
+        case BP_BITSET_OR:
+            a[i] |= b[i];
+            break;
+        case BP_BITSET_XOR:
+            a[i] ^= b[i];
+            break;
+        case BP_BITSET_ANDNOT:
+            a[i] &= ~b[i];
+            break;
+        }
+    }
+
+    return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,258 @@
+/*!
+ * @file bp_bloom.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Implement the Bloom filter structure.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#include "bp_bloom.h"
+#include "bp_hashmap.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Odd constants that spread the hash over the bits of each word of a block.
+ */
+static const uint32_t bp_bloom_salts[BP_BLOOM_BLOCK_WORDS] = {
+    0x47B6137BU, 0x44974D91U, 0x8824AD5BU, 0xA2B7289DU,
+    0x705495C7U, 0x2DF1424BU, 0x9EFC4947U, 0x5C6BFB31U,
+};
+
+/*!
+ * Get the block of a hash.
+ * @param bloom Reference to bp_bloom.
+ * @param hash The key hash.
+ * @return Reference to the block.
+ */
+static inline bp_bloom_block_t *bp_bloom_block_of(bp_bloom_t *bloom, uint64_t hash);
+
+/*!
+ * Set the bits of a hash in a block.
+ * @param block Reference to the block.
+ * @param hash The key hash.
+ */
+static inline void bp_bloom_block_set(bp_bloom_block_t *block, uint32_t hash);
+
+/*!
+ * Check if all the bits of a hash are set in a block.
+ * @param block Reference to the block.
+ * @param hash The key hash.
+ * @return true if all the bits are set, false otherwise.
+ */
+static inline bool bp_bloom_block_test(const bp_bloom_block_t *block, uint32_t hash);
+
+/*!
+ * Check if a key fits inside the elements of an array.
+ * @param array Reference to bp_array.
+ * @param key_offset Offset (in bytes) of the key inside each element.
+ * @param key_size Size (in bytes) of the key.
+ * @return true if the key fits, false otherwise.
+ */
+static inline bool bp_bloom_key_fits(bp_array_t *array, size_t key_offset, size_t key_size);
+
+int bp_bloom_add(bp_bloom_t *bloom, const void *key, size_t key_size)
+{
+    if (bloom == NULL) {
+        return -ENODEV;
+    }
+
+    if (key == NULL || bloom->_nblocks == 0) {
+        return -EINVAL;
+    }
+
+    uint64_t hash = bp_hashmap_hash(key, key_size);
+
+    bp_bloom_block_set(bp_bloom_block_of(bloom, hash), (uint32_t) hash);
+
+    return 0;
+}
+
+bool bp_bloom_contains(bp_bloom_t *bloom, const void *key, size_t key_size)
+{
+    if (bloom == NULL || key == NULL || bloom->_nblocks == 0) {
+        return true;
+    }
+
+    uint64_t hash = bp_hashmap_hash(key, key_size);
+
+    return bp_bloom_block_test(bp_bloom_block_of(bloom, hash), (uint32_t) hash);
+}
+
+int bp_bloom_clear(bp_bloom_t *bloom)
+{
+    if (bloom == NULL) {
+        return -ENODEV;
+    }
+
+    if (bloom->_blocks != NULL) {
+        memset(bloom->_blocks, 0, bloom->_nblocks * sizeof(bp_bloom_block_t));
+    }
+
+    return 0;
+}
+
+int bp_bloom_array_push(bp_bloom_t *bloom, bp_array_t *array, void *el, size_t key_offset,
+                        size_t key_size)
+{
+    if (bloom == NULL || array == NULL) {
+        return -ENODEV;
+    }
+
+    /* Check everything bp_bloom_add checks first, so an element is never stored without
+     * its key in the filter. */
+    if (el == NULL || bloom->_nblocks == 0 ||
+        !bp_bloom_key_fits(array, key_offset, key_size)) {
+        return -EINVAL;
+    }
+
+    int err = bp_array_push(array, el);
+    if (err) {
+        return err;
+    }
+
+    return bp_bloom_add(bloom, (uint8_t *) el + key_offset, key_size);
+}
+
+void *bp_bloom_array_find(bp_bloom_t *bloom, bp_array_t *array, const void *key,
+                          size_t key_offset, size_t key_size)
+{
+    if (bloom == NULL || array == NULL || key == NULL) {
+        return NULL;
+    }
+
+    if (!bp_bloom_key_fits(array, key_offset, key_size)) {
+        return NULL;
+    }
+
+    if (!bp_bloom_contains(bloom, key, key_size)) {
+        return NULL;
+    }
+
+    uint8_t *el  = &array->_array[key_offset];
+    uint8_t *end = &array->_array[array->_size * array->_element_size];
+
+    /* Integer keys are compared as words, without calling memcmp for each element. */
+    if (key_size == sizeof(uint32_t)) {
+        uint32_t word, target;
+        memcpy(&target, key, sizeof(target));
+        for (; el < end; el += array->_element_size) {
+            memcpy(&word, el, sizeof(word));
+            if (word == target) {
+                return el - key_offset;
+            }
+        }
+        return NULL;
+    }
+
+    if (key_size == sizeof(uint64_t)) {
+        uint64_t word, target;
+        memcpy(&target, key, sizeof(target));
+        for (; el < end; el += array->_element_size) {
+            memcpy(&word, el, sizeof(word));
+            if (word == target) {
+                return el - key_offset;
+            }
+        }
+        return NULL;
+    }
+
+    for (; el < end; el += array->_element_size) {
+        if (memcmp(el, key, key_size) == 0) {
+            return el - key_offset;
+        }
+    }
+
+    return NULL;
+}
+
+int bp_bloom_array_rebuild(bp_bloom_t *bloom, bp_array_t *array, size_t key_offset,
+                           size_t key_size)
+{
+    if (bloom == NULL || array == NULL) {
+        return -ENODEV;
+    }
+
+    if (!bp_bloom_key_fits(array, key_offset, key_size) || bloom->_nblocks == 0) {
+        return -EINVAL;
+    }
+
+    bp_bloom_clear(bloom);
+    for (size_t i = 0; i < array->_size; ++i) {
+        bp_bloom_add(bloom, &array->_array[i * array->_element_size + key_offset], key_size);
+    }
+
+    return 0;
+}
+
+static inline bp_bloom_block_t *bp_bloom_block_of(bp_bloom_t *bloom, uint64_t hash)
+{
+    /* Map the high half of the hash to [0, nblocks) without a division. */
+    return &bloom->_blocks[((hash >> 32) * bloom->_nblocks) >> 32];
+}
+
+#ifdef __AVX2__
+/*!
+ * Get the mask with one bit set in each word of a block, for a hash.
+ * @param hash The key hash.
+ * @return The mask.
+ */
+static inline __m256i bp_bloom_mask(uint32_t hash)
+{
+    __m256i salts = _mm256_loadu_si256((const __m256i *) bp_bloom_salts);
+    __m256i bits  = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32((int) hash), salts), 27);
+
+    return _mm256_sllv_epi32(_mm256_set1_epi32(1), bits);
+}
+
+static inline void bp_bloom_block_set(bp_bloom_block_t *block, uint32_t hash)
+{
+    __m256i words = _mm256_loadu_si256((const __m256i *) block->words);
+
+    _mm256_storeu_si256((__m256i *) block->words, _mm256_or_si256(words, bp_bloom_mask(hash)));
+}
+
+static inline bool bp_bloom_block_test(const bp_bloom_block_t *block, uint32_t hash)
+{
+    __m256i words = _mm256_loadu_si256((const __m256i *) block->words);
+
+    return _mm256_testc_si256(words, bp_bloom_mask(hash)) != 0;
+}
+#else
+static inline void bp_bloom_block_set(bp_bloom_block_t *block, uint32_t hash)
+{
+    for (size_t i = 0; i < BP_BLOOM_BLOCK_WORDS; ++i) {
+        block->words[i] |= UINT32_C(1) << ((hash * bp_bloom_salts[i]) >> 27);
+    }
+}
+
+static inline bool bp_bloom_block_test(const bp_bloom_block_t *block, uint32_t hash)
+{
+    uint32_t missing = 0;
+
+    /* No early exit, so the compiler can vectorize the loop. */
+    for (size_t i = 0; i < BP_BLOOM_BLOCK_WORDS; ++i) {
+        uint32_t bit = UINT32_C(1) << ((hash * bp_bloom_salts[i]) >> 27);
+        missing |= ~block->words[i] & bit;
+    }
+
+    return missing == 0;
+}
+#endif
+
+static inline bool bp_bloom_key_fits(bp_array_t *array, size_t key_offset, size_t key_size)
+{
+    return key_offset <= array->_element_size && key_size <= array->_element_size - key_offset;
+}
+
+#ifdef __cplusplus
+}
+#endif
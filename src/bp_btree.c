@@ -0,0 +1,866 @@
+/*!
+ * @file bp_btree.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Implement the B+tree structure.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#include <string.h>
+
+#include "bp_bits.h"
+#include "bp_btree.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Fail to compile if a node doesn't fill whole cache lines.
+ */
+typedef char
+    bp_btree_node_check_t[(sizeof(bp_btree_node_t) % BP_CACHE_LINE_SIZE == 0) ? 1 : -1];
+
+/*!
+ * Value of a link to no node.
+ */
+#define BP_BTREE_NONE 0U
+
+/*!
+ * Value of the unused keys of a node. It's never less than a searched key, so the unused
+ * keys don't change the rank of a search.
+ */
+#define BP_BTREE_EMPTY UINT64_MAX
+
+/*!
+ * Minimum number of keys in a node other than the root.
+ */
+#define BP_BTREE_MIN (BP_BTREE_KEYS / 2U)
+
+/*!
+ * Maximum number of levels. The nodes have at least 9 children, so it's never reached.
+ */
+#define BP_BTREE_MAX_HEIGHT 32U
+
+/*!
+ * Number of bits of the iterator position used by the slot in the leaf.
+ */
+#define BP_BTREE_SLOT_BITS 5U
+
+/*!
+ * Step of a path from the root to a leaf.
+ */
+typedef struct {
+    uint32_t link; /*!< Inner node plus one. */
+    uint32_t pos;  /*!< Index of the child taken. */
+} bp_btree_step_t;
+
+/*!
+ * Bounds of the elements walked by an iterator.
+ */
+typedef struct {
+    bp_btree_t *tree; /*!< Reference to the B+tree. */
+    uint64_t lo;      /*!< First key. */
+    uint64_t hi;      /*!< Key after the last one, if 'bounded' is set. */
+    bool bounded;     /*!< Set if 'hi' is a bound. */
+} bp_btree_bounds_t;
+
+/*!
+ * Get a node from its link.
+ * @param tree Reference to bp_btree.
+ * @param link Index of the node plus one.
+ * @return Reference to the node.
+ */
+static inline bp_btree_node_t *bp_btree_node(bp_btree_t *tree, uint32_t link);
+
+/*!
+ * Take a node from the pool. There must be a node available.
+ * @param tree Reference to bp_btree.
+ * @param leaf Set to take a leaf.
+ * @return Link to the node, with no keys.
+ */
+static uint32_t bp_btree_alloc(bp_btree_t *tree, bool leaf);
+
+/*!
+ * Give a node back to the pool.
+ * @param tree Reference to bp_btree.
+ * @param link Link to the node.
+ */
+static void bp_btree_release(bp_btree_t *tree, uint32_t link);
+
+/*!
+ * Count the keys of a node less than (or not greater than) a key, comparing them all at
+ * once.
+ * @param keys Keys of the node.
+ * @param key The searched key.
+ * @param upper Set to also count the keys equal to 'key'.
+ * @return The number of keys. With 'upper' set, it can include unused keys if 'key' is
+ * UINT64_MAX.
+ */
+static inline size_t bp_btree_rank(const uint64_t *keys, uint64_t key, bool upper);
+
+/*!
+ * Go from the root to the leaf that holds a key.
+ * @param tree Reference to bp_btree. It must not be empty.
+ * @param key The key.
+ * @param path [out] Inner nodes visited. It can be NULL.
+ * @param depth [out] Number of inner nodes visited. It can be NULL.
+ * @return Link to the leaf.
+ */
+static uint32_t bp_btree_descend(bp_btree_t *tree, uint64_t key, bp_btree_step_t *path,
+                                 size_t *depth);
+
+/*!
+ * Go from the root to the first or the last leaf.
+ * @param tree Reference to bp_btree. It must not be empty.
+ * @param last Set to get the last leaf.
+ * @return Link to the leaf.
+ */
+static uint32_t bp_btree_edge(bp_btree_t *tree, bool last);
+
+/*!
+ * Find the position of the first key not less than a key.
+ * @param tree Reference to bp_btree.
+ * @param key The key.
+ * @param slot [out] Index of the key in the leaf.
+ * @return Link to the leaf, or BP_BTREE_NONE if every key is less than 'key'.
+ */
+static uint32_t bp_btree_seek(bp_btree_t *tree, uint64_t key, size_t *slot);
+
+/*!
+ * Split a full leaf to insert an element.
+ * @param tree Reference to bp_btree.
+ * @param link Link to the leaf.
+ * @param pos Position of the new element.
+ * @param key The key.
+ * @param value The value.
+ * @return Link to the new leaf, on the right.
+ */
+static uint32_t bp_btree_split_leaf(bp_btree_t *tree, uint32_t link, size_t pos, uint64_t key,
+                                    uint64_t value);
+
+/*!
+ * Insert a key and its right child in an inner node, splitting it if it's full.
+ * @param tree Reference to bp_btree.
+ * @param step Inner node and position of the key.
+ * @param key [in,out] The key. If the node is split, the key moved up.
+ * @param child [in,out] The child. If the node is split, the new node on the right.
+ * @return true if the node was split, false otherwise.
+ */
+static bool bp_btree_insert_inner(bp_btree_t *tree, bp_btree_step_t step, uint64_t *key,
+                                  uint32_t *child);
+
+/*!
+ * Fix a node with fewer than the minimum keys, borrowing a key from a sibling or merging
+ * with it.
+ * @param tree Reference to bp_btree.
+ * @param step Parent node and position of the node in it.
+ * @return true if a key was removed from the parent, false otherwise.
+ */
+static bool bp_btree_rebalance(bp_btree_t *tree, bp_btree_step_t step);
+
+/*!
+ * Remove a key and its right child from an inner node.
+ * @param node Reference to the node.
+ * @param idx Index of the key.
+ */
+static void bp_btree_inner_remove(bp_btree_node_t *node, size_t idx);
+
+/*!
+ * Get the bounds of an iterator.
+ * @param self Reference to the iterator.
+ * @return The bounds.
+ */
+static bp_btree_bounds_t bp_btree_bounds(struct bp_iterator *self);
+
+/*!
+ * Move an iterator to a position, if it's inside its bounds.
+ * @param self Reference to the iterator.
+ * @param bounds Bounds of the iterator.
+ * @param link Link to the leaf, or BP_BTREE_NONE.
+ * @param slot Index of the element in the leaf.
+ * @return Reference to the value at the position, or NULL if it's out of the bounds.
+ */
+static void *bp_btree_iterator_move(struct bp_iterator *self, bp_btree_bounds_t bounds,
+                                    uint32_t link, size_t slot);
+
+static void *bp_btree_iterator_get(struct bp_iterator *self);
+
+static void *bp_btree_iterator_first(struct bp_iterator *self);
+
+static void *bp_btree_iterator_last(struct bp_iterator *self);
+
+static void *bp_btree_iterator_next(struct bp_iterator *self);
+
+static void *bp_btree_iterator_prev(struct bp_iterator *self);
+
+static struct bp_iterator_vtable bp_btree_iterator_vtable = {
+    .get   = bp_btree_iterator_get,
+    .first = bp_btree_iterator_first,
+    .last  = bp_btree_iterator_last,
+    .next  = bp_btree_iterator_next,
+    .prev  = bp_btree_iterator_prev,
+};
+
+static struct bp_iterator_vtable bp_btree_range_iterator_vtable = {
+    .get   = bp_btree_iterator_get,
+    .first = bp_btree_iterator_first,
+    .last  = bp_btree_iterator_last,
+    .next  = bp_btree_iterator_next,
+    .prev  = bp_btree_iterator_prev,
+};
+
+int bp_btree_insert(bp_btree_t *tree, uint64_t key, uint64_t value)
+{
+    if (tree == NULL) {
+        return -ENODEV;
+    }
+
+    /* In the worst case, every level is split and a new root is added. */
+    if (tree->_capacity - tree->_live < tree->_height + 1U ||
+        tree->_height >= BP_BTREE_MAX_HEIGHT) {
+        return -ENOMEM;
+    }
+
+    if (tree->_root == BP_BTREE_NONE) {
+        tree->_root   = bp_btree_alloc(tree, true);
+        tree->_height = 1;
+    }
+
+    bp_btree_step_t path[BP_BTREE_MAX_HEIGHT];
+    size_t depth;
+    uint32_t link         = bp_btree_descend(tree, key, path, &depth);
+    bp_btree_node_t *leaf = bp_btree_node(tree, link);
+    size_t pos            = bp_btree_rank(leaf->keys, key, false);
+
+    if (pos < leaf->count && leaf->keys[pos] == key) {
+        return -EEXIST;
+    }
+
+    tree->_size += 1;
+
+    if (leaf->count < BP_BTREE_KEYS) {
+        memmove(&leaf->keys[pos + 1U], &leaf->keys[pos], (leaf->count - pos) * sizeof(uint64_t));
+        memmove(&leaf->u.values[pos + 1U], &leaf->u.values[pos],
+                (leaf->count - pos) * sizeof(uint64_t));
+        leaf->keys[pos]     = key;
+        leaf->u.values[pos] = value;
+        leaf->count += 1;
+        return 0;
+    }
+
+    uint32_t child = bp_btree_split_leaf(tree, link, pos, key, value);
+    uint64_t sep   = bp_btree_node(tree, child)->keys[0];
+
+    while (depth > 0) {
+        if (!bp_btree_insert_inner(tree, path[--depth], &sep, &child)) {
+            return 0;
+        }
+    }
+
+    /* The root was split: the tree grows one level. */
+    uint32_t root         = bp_btree_alloc(tree, false);
+    bp_btree_node_t *node = bp_btree_node(tree, root);
+
+    node->keys[0]       = sep;
+    node->u.children[0] = tree->_root;
+    node->u.children[1] = child;
+    node->count         = 1;
+    tree->_root         = root;
+    tree->_height += 1;
+
+    return 0;
+}
+
+uint64_t *bp_btree_find(bp_btree_t *tree, uint64_t key)
+{
+    if (tree == NULL || tree->_root == BP_BTREE_NONE) {
+        return NULL;
+    }
+
+    bp_btree_node_t *leaf = bp_btree_node(tree, bp_btree_descend(tree, key, NULL, NULL));
+    size_t pos            = bp_btree_rank(leaf->keys, key, false);
+
+    if (pos >= leaf->count || leaf->keys[pos] != key) {
+        return NULL;
+    }
+
+    return &leaf->u.values[pos];
+}
+
+uint64_t *bp_btree_lower_bound(bp_btree_t *tree, uint64_t key, uint64_t *found)
+{
+    if (tree == NULL) {
+        return NULL;
+    }
+
+    size_t slot;
+    uint32_t link = bp_btree_seek(tree, key, &slot);
+
+    if (link == BP_BTREE_NONE) {
+        return NULL;
+    }
+
+    bp_btree_node_t *leaf = bp_btree_node(tree, link);
+
+    if (found != NULL) {
+        *found = leaf->keys[slot];
+    }
+
+    return &leaf->u.values[slot];
+}
+
+int bp_btree_erase(bp_btree_t *tree, uint64_t key)
+{
+    if (tree == NULL) {
+        return -ENODEV;
+    }
+
+    if (tree->_root == BP_BTREE_NONE) {
+        return -ENOENT;
+    }
+
+    bp_btree_step_t path[BP_BTREE_MAX_HEIGHT];
+    size_t depth;
+    bp_btree_node_t *leaf = bp_btree_node(tree, bp_btree_descend(tree, key, path, &depth));
+    size_t pos            = bp_btree_rank(leaf->keys, key, false);
+
+    if (pos >= leaf->count || leaf->keys[pos] != key) {
+        return -ENOENT;
+    }
+
+    leaf->count -= 1;
+    memmove(&leaf->keys[pos], &leaf->keys[pos + 1U], (leaf->count - pos) * sizeof(uint64_t));
+    memmove(&leaf->u.values[pos], &leaf->u.values[pos + 1U],
+            (leaf->count - pos) * sizeof(uint64_t));
+    leaf->keys[leaf->count] = BP_BTREE_EMPTY;
+    tree->_size -= 1;
+
+    /* Fix the underflows bottom-up, while each fix takes a key from the parent. */
+    while (depth > 0) {
+        bp_btree_step_t step = path[--depth];
+        bp_btree_node_t *node =
+            bp_btree_node(tree, bp_btree_node(tree, step.link)->u.children[step.pos]);
+        if (node->count >= BP_BTREE_MIN || !bp_btree_rebalance(tree, step)) {
+            break;
+        }
+    }
+
+    bp_btree_node_t *root = bp_btree_node(tree, tree->_root);
+
+    if (root->count == 0) {
+        uint32_t old  = tree->_root;
+        tree->_root   = root->leaf ? BP_BTREE_NONE : root->u.children[0];
+        tree->_height -= 1;
+        bp_btree_release(tree, old);
+    }
+
+    return 0;
+}
+
+int bp_btree_clear(bp_btree_t *tree)
+{
+    if (tree == NULL) {
+        return -ENODEV;
+    }
+
+    tree->_used   = 0;
+    tree->_live   = 0;
+    tree->_free   = BP_BTREE_NONE;
+    tree->_root   = BP_BTREE_NONE;
+    tree->_height = 0;
+    tree->_size   = 0;
+
+    return 0;
+}
+
+size_t bp_btree_size(bp_btree_t *tree)
+{
+    if (tree == NULL) {
+        return 0;
+    }
+
+    return tree->_size;
+}
+
+bp_iterator_t bp_btree_iterator(bp_btree_t *tree)
+{
+    bp_iterator_t iter = {
+        .vtable      = &bp_btree_iterator_vtable,
+        .coll        = tree,
+        .current_idx = 0U,
+    };
+
+    return iter;
+}
+
+bp_iterator_t bp_btree_range_iterator(bp_btree_range_t *range)
+{
+    bp_iterator_t iter = {
+        .vtable      = &bp_btree_range_iterator_vtable,
+        .coll        = range,
+        .current_idx = 0U,
+    };
+
+    return iter;
+}
+
+uint64_t bp_btree_iterator_key(bp_iterator_t *it)
+{
+    if (it == NULL || it->current_idx == 0) {
+        return 0;
+    }
+
+    bp_btree_bounds_t bounds = bp_btree_bounds(it);
+    uint32_t link            = (uint32_t) (it->current_idx >> BP_BTREE_SLOT_BITS);
+    size_t slot = it->current_idx & ((UINT32_C(1) << BP_BTREE_SLOT_BITS) - 1U);
+
+    return bp_btree_node(bounds.tree, link)->keys[slot];
+}
+
+static inline bp_btree_node_t *bp_btree_node(bp_btree_t *tree, uint32_t link)
+{
+    return &tree->_nodes[link - 1U];
+}
+
+static uint32_t bp_btree_alloc(bp_btree_t *tree, bool leaf)
+{
+    uint32_t link;
+
+    if (tree->_free != BP_BTREE_NONE) {
+        link        = tree->_free;
+        tree->_free = bp_btree_node(tree, link)->next;
+    } else {
+        link = (uint32_t) ++tree->_used;
+    }
+
+    bp_btree_node_t *node = bp_btree_node(tree, link);
+
+    memset(node, 0, sizeof(bp_btree_node_t));
+    for (size_t i = 0; i < BP_BTREE_KEYS; ++i) {
+        node->keys[i] = BP_BTREE_EMPTY;
+    }
+    node->leaf = leaf;
+    tree->_live += 1;
+
+    return link;
+}
+
+static void bp_btree_release(bp_btree_t *tree, uint32_t link)
+{
+    bp_btree_node(tree, link)->next = tree->_free;
+    tree->_free                     = link;
+    tree->_live -= 1;
+}
+
+static inline size_t bp_btree_rank(const uint64_t *keys, uint64_t key, bool upper)
+{
+#ifdef __AVX2__
+    /* AVX2 only compares signed integers: flip the sign bits to compare them unsigned. */
+    const __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+    __m256i target     = _mm256_xor_si256(_mm256_set1_epi64x((int64_t) key), sign);
+    unsigned mask      = 0;
+
+    for (size_t i = 0; i < BP_BTREE_KEYS; i += 4U) {
+        __m256i block = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *) &keys[i]), sign);
+        __m256i less  = _mm256_cmpgt_epi64(target, block);
+        if (upper) {
+            less = _mm256_or_si256(less, _mm256_cmpeq_epi64(target, block));
+        }
+        mask |= (unsigned) _mm256_movemask_pd(_mm256_castsi256_pd(less)) << i;
+    }
+
+    return bp_popcount64(mask);
+#else
+    size_t count = 0;
+
+    /* No early exit, so the compiler can vectorize the loop. */
+    for (size_t i = 0; i < BP_BTREE_KEYS; ++i) {
+        count += upper ? keys[i] <= key : keys[i] < key;
+    }
+
+    return count;
+#endif
+}
+
+static uint32_t bp_btree_descend(bp_btree_t *tree, uint64_t key, bp_btree_step_t *path,
+                                 size_t *depth)
+{
+    uint32_t link         = tree->_root;
+    bp_btree_node_t *node = bp_btree_node(tree, link);
+    size_t d              = 0;
+
+    /* The keys equal to a separator are in its right child. */
+    while (!node->leaf) {
+        size_t pos = bp_btree_rank(node->keys, key, true);
+        if (pos > node->count) {
+            pos = node->count;
+        }
+        if (path != NULL) {
+            path[d].link = link;
+            path[d].pos  = (uint32_t) pos;
+        }
+        d += 1;
+        link = node->u.children[pos];
+        node = bp_btree_node(tree, link);
+    }
+
+    if (depth != NULL) {
+        *depth = d;
+    }
+
+    return link;
+}
+
+static uint32_t bp_btree_edge(bp_btree_t *tree, bool last)
+{
+    uint32_t link         = tree->_root;
+    bp_btree_node_t *node = bp_btree_node(tree, link);
+
+    while (!node->leaf) {
+        link = node->u.children[last ? node->count : 0];
+        node = bp_btree_node(tree, link);
+    }
+
+    return link;
+}
+
+static uint32_t bp_btree_seek(bp_btree_t *tree, uint64_t key, size_t *slot)
+{
+    if (tree->_root == BP_BTREE_NONE) {
+        return BP_BTREE_NONE;
+    }
+
+    uint32_t link         = bp_btree_descend(tree, key, NULL, NULL);
+    bp_btree_node_t *leaf = bp_btree_node(tree, link);
+    size_t pos            = bp_btree_rank(leaf->keys, key, false);
+
+    /* Every key of the leaf is less than 'key': the next one starts the next leaf. */
+    if (pos == leaf->count) {
+        link = leaf->next;
+        pos  = 0;
+    }
+
+    *slot = pos;
+
+    return link;
+}
+
+static uint32_t bp_btree_split_leaf(bp_btree_t *tree, uint32_t link, size_t pos, uint64_t key,
+                                    uint64_t value)
+{
+    uint64_t keys[BP_BTREE_KEYS + 1U];
+    uint64_t values[BP_BTREE_KEYS + 1U];
+    uint32_t right_link    = bp_btree_alloc(tree, true);
+    bp_btree_node_t *left  = bp_btree_node(tree, link);
+    bp_btree_node_t *right = bp_btree_node(tree, right_link);
+
+    memcpy(keys, left->keys, pos * sizeof(uint64_t));
+    memcpy(values, left->u.values, pos * sizeof(uint64_t));
+    keys[pos]   = key;
+    values[pos] = value;
+    memcpy(&keys[pos + 1U], &left->keys[pos], (BP_BTREE_KEYS - pos) * sizeof(uint64_t));
+    memcpy(&values[pos + 1U], &left->u.values[pos], (BP_BTREE_KEYS - pos) * sizeof(uint64_t));
+
+    right->count = BP_BTREE_KEYS + 1U - BP_BTREE_MIN;
+    memcpy(left->keys, keys, BP_BTREE_MIN * sizeof(uint64_t));
+    memcpy(left->u.values, values, BP_BTREE_MIN * sizeof(uint64_t));
+    memcpy(right->keys, &keys[BP_BTREE_MIN], right->count * sizeof(uint64_t));
+    memcpy(right->u.values, &values[BP_BTREE_MIN], right->count * sizeof(uint64_t));
+    for (size_t i = BP_BTREE_MIN; i < BP_BTREE_KEYS; ++i) {
+        left->keys[i] = BP_BTREE_EMPTY;
+    }
+    left->count = BP_BTREE_MIN;
+
+    right->prev = link;
+    right->next = left->next;
+    if (left->next != BP_BTREE_NONE) {
+        bp_btree_node(tree, left->next)->prev = right_link;
+    }
+    left->next = right_link;
+
+    return right_link;
+}
+
+static bool bp_btree_insert_inner(bp_btree_t *tree, bp_btree_step_t step, uint64_t *key,
+                                  uint32_t *child)
+{
+    bp_btree_node_t *node = bp_btree_node(tree, step.link);
+    size_t pos            = step.pos;
+
+    if (node->count < BP_BTREE_KEYS) {
+        memmove(&node->keys[pos + 1U], &node->keys[pos], (node->count - pos) * sizeof(uint64_t));
+        memmove(&node->u.children[pos + 2U], &node->u.children[pos + 1U],
+                (node->count - pos) * sizeof(uint32_t));
+        node->keys[pos]             = *key;
+        node->u.children[pos + 1U] = *child;
+        node->count += 1;
+        return false;
+    }
+
+    uint64_t keys[BP_BTREE_KEYS + 1U];
+    uint32_t children[BP_BTREE_KEYS + 2U];
+
+    memcpy(keys, node->keys, pos * sizeof(uint64_t));
+    keys[pos] = *key;
+    memcpy(&keys[pos + 1U], &node->keys[pos], (BP_BTREE_KEYS - pos) * sizeof(uint64_t));
+    memcpy(children, node->u.children, (pos + 1U) * sizeof(uint32_t));
+    children[pos + 1U] = *child;
+    memcpy(&children[pos + 2U], &node->u.children[pos + 1U],
+           (BP_BTREE_KEYS - pos) * sizeof(uint32_t));
+
+    /* The middle key moves up: each half keeps BP_BTREE_MIN keys. */
+    uint32_t right_link    = bp_btree_alloc(tree, false);
+    bp_btree_node_t *right = bp_btree_node(tree, right_link);
+
+    memcpy(node->keys, keys, BP_BTREE_MIN * sizeof(uint64_t));
+    memcpy(node->u.children, children, (BP_BTREE_MIN + 1U) * sizeof(uint32_t));
+    for (size_t i = BP_BTREE_MIN; i < BP_BTREE_KEYS; ++i) {
+        node->keys[i] = BP_BTREE_EMPTY;
+    }
+    node->count = BP_BTREE_MIN;
+
+    right->count = BP_BTREE_KEYS - BP_BTREE_MIN;
+    memcpy(right->keys, &keys[BP_BTREE_MIN + 1U], right->count * sizeof(uint64_t));
+    memcpy(right->u.children, &children[BP_BTREE_MIN + 1U],
+           (right->count + 1U) * sizeof(uint32_t));
+
+    *key   = keys[BP_BTREE_MIN];
+    *child = right_link;
+
+    return true;
+}
+
+static bool bp_btree_rebalance(bp_btree_t *tree, bp_btree_step_t step)
+{
+    bp_btree_node_t *parent = bp_btree_node(tree, step.link);
+    size_t pos              = step.pos;
+    uint32_t link           = parent->u.children[pos];
+    bp_btree_node_t *node   = bp_btree_node(tree, link);
+    bp_btree_node_t *left =
+        pos > 0 ? bp_btree_node(tree, parent->u.children[pos - 1U]) : NULL;
+    bp_btree_node_t *right =
+        pos < parent->count ? bp_btree_node(tree, parent->u.children[pos + 1U]) : NULL;
+
+    if (left != NULL && left->count > BP_BTREE_MIN) {
+        /* Borrow the last key of the left sibling. */
+        memmove(&node->keys[1], &node->keys[0], node->count * sizeof(uint64_t));
+        left->count -= 1;
+        if (node->leaf) {
+            memmove(&node->u.values[1], &node->u.values[0], node->count * sizeof(uint64_t));
+            node->keys[0]            = left->keys[left->count];
+            node->u.values[0]        = left->u.values[left->count];
+            parent->keys[pos - 1U]   = node->keys[0];
+        } else {
+            memmove(&node->u.children[1], &node->u.children[0],
+                    (node->count + 1U) * sizeof(uint32_t));
+            node->keys[0]          = parent->keys[pos - 1U];
+            node->u.children[0]    = left->u.children[left->count + 1U];
+            parent->keys[pos - 1U] = left->keys[left->count];
+        }
+        left->keys[left->count] = BP_BTREE_EMPTY;
+        node->count += 1;
+        return false;
+    }
+
+    if (right != NULL && right->count > BP_BTREE_MIN) {
+        /* Borrow the first key of the right sibling. */
+        if (node->leaf) {
+            node->keys[node->count]     = right->keys[0];
+            node->u.values[node->count] = right->u.values[0];
+            memmove(&right->u.values[0], &right->u.values[1],
+                    (right->count - 1U) * sizeof(uint64_t));
+        } else {
+            node->keys[node->count]            = parent->keys[pos];
+            node->u.children[node->count + 1U] = right->u.children[0];
+            memmove(&right->u.children[0], &right->u.children[1],
+                    right->count * sizeof(uint32_t));
+        }
+        parent->keys[pos] = node->leaf ? right->keys[1] : right->keys[0];
+        memmove(&right->keys[0], &right->keys[1], (right->count - 1U) * sizeof(uint64_t));
+        right->count -= 1;
+        right->keys[right->count] = BP_BTREE_EMPTY;
+        node->count += 1;
+        return false;
+    }
+
+    /* No sibling can lend a key: merge the node with one of them. */
+    if (left == NULL) {
+        left = node;
+        node = right;
+        pos += 1U;
+        link = parent->u.children[pos];
+    }
+
+    if (node->leaf) {
+        memcpy(&left->keys[left->count], node->keys, node->count * sizeof(uint64_t));
+        memcpy(&left->u.values[left->count], node->u.values, node->count * sizeof(uint64_t));
+        left->count += node->count;
+        left->next = node->next;
+        if (node->next != BP_BTREE_NONE) {
+            bp_btree_node(tree, node->next)->prev = parent->u.children[pos - 1U];
+        }
+    } else {
+        left->keys[left->count] = parent->keys[pos - 1U];
+        memcpy(&left->keys[left->count + 1U], node->keys, node->count * sizeof(uint64_t));
+        memcpy(&left->u.children[left->count + 1U], node->u.children,
+               (node->count + 1U) * sizeof(uint32_t));
+        left->count = (uint16_t) (left->count + node->count + 1U);
+    }
+
+    bp_btree_inner_remove(parent, pos - 1U);
+    bp_btree_release(tree, link);
+
+    return true;
+}
+
+static void bp_btree_inner_remove(bp_btree_node_t *node, size_t idx)
+{
+    node->count -= 1;
+    memmove(&node->keys[idx], &node->keys[idx + 1U], (node->count - idx) * sizeof(uint64_t));
+    memmove(&node->u.children[idx + 1U], &node->u.children[idx + 2U],
+            (node->count - idx) * sizeof(uint32_t));
+    node->keys[node->count] = BP_BTREE_EMPTY;
+}
+
+static bp_btree_bounds_t bp_btree_bounds(struct bp_iterator *self)
+{
+    bp_btree_bounds_t bounds = {.tree = self->coll, .lo = 0, .hi = 0, .bounded = false};
+
+    if (self->vtable == &bp_btree_range_iterator_vtable) {
+        bp_btree_range_t *range = self->coll;
+        bounds.tree             = range->tree;
+        bounds.lo               = range->lo;
+        bounds.hi               = range->hi;
+        bounds.bounded          = true;
+    }
+
+    return bounds;
+}
+
+static void *bp_btree_iterator_move(struct bp_iterator *self, bp_btree_bounds_t bounds,
+                                    uint32_t link, size_t slot)
+{
+    self->current_idx = 0;
+
+    if (link == BP_BTREE_NONE) {
+        return NULL;
+    }
+
+    bp_btree_node_t *leaf = bp_btree_node(bounds.tree, link);
+    uint64_t key          = leaf->keys[slot];
+
+    if (key < bounds.lo || (bounds.bounded && key >= bounds.hi)) {
+        return NULL;
+    }
+
+    self->current_idx = ((size_t) link << BP_BTREE_SLOT_BITS) | slot;
+
+    return &leaf->u.values[slot];
+}
+
+static void *bp_btree_iterator_get(struct bp_iterator *self)
+{
+    if (self->coll == NULL || self->current_idx == 0) {
+        return NULL;
+    }
+
+    bp_btree_bounds_t bounds = bp_btree_bounds(self);
+    uint32_t link            = (uint32_t) (self->current_idx >> BP_BTREE_SLOT_BITS);
+    size_t slot = self->current_idx & ((UINT32_C(1) << BP_BTREE_SLOT_BITS) - 1U);
+
+    return &bp_btree_node(bounds.tree, link)->u.values[slot];
+}
+
+static void *bp_btree_iterator_first(struct bp_iterator *self)
+{
+    if (self->coll == NULL) {
+        return NULL;
+    }
+
+    bp_btree_bounds_t bounds = bp_btree_bounds(self);
+    size_t slot              = 0;
+    uint32_t link            = bp_btree_seek(bounds.tree, bounds.lo, &slot);
+
+    return bp_btree_iterator_move(self, bounds, link, slot);
+}
+
+static void *bp_btree_iterator_last(struct bp_iterator *self)
+{
+    if (self->coll == NULL) {
+        return NULL;
+    }
+
+    bp_btree_bounds_t bounds = bp_btree_bounds(self);
+    bp_btree_t *tree         = bounds.tree;
+    size_t slot              = 0;
+    uint32_t link            = BP_BTREE_NONE;
+
+    if (tree->_root == BP_BTREE_NONE) {
+        self->current_idx = 0;
+        return NULL;
+    }
+
+    if (bounds.bounded) {
+        link = bp_btree_seek(tree, bounds.hi, &slot);
+    }
+
+    /* Step back from the first key not in the range, or from the end of the tree. */
+    if (link == BP_BTREE_NONE) {
+        link = bp_btree_edge(tree, true);
+        slot = bp_btree_node(tree, link)->count;
+    }
+    if (slot == 0) {
+        link = bp_btree_node(tree, link)->prev;
+        slot = link == BP_BTREE_NONE ? 0 : bp_btree_node(tree, link)->count;
+    }
+
+    return bp_btree_iterator_move(self, bounds, link, slot - (link != BP_BTREE_NONE));
+}
+
+static void *bp_btree_iterator_next(struct bp_iterator *self)
+{
+    if (self->coll == NULL || self->current_idx == 0) {
+        return NULL;
+    }
+
+    bp_btree_bounds_t bounds = bp_btree_bounds(self);
+    uint32_t link            = (uint32_t) (self->current_idx >> BP_BTREE_SLOT_BITS);
+    size_t slot = (self->current_idx & ((UINT32_C(1) << BP_BTREE_SLOT_BITS) - 1U)) + 1U;
+    bp_btree_node_t *leaf = bp_btree_node(bounds.tree, link);
+
+    if (slot == leaf->count) {
+        link = leaf->next;
+        slot = 0;
+    }
+
+    return bp_btree_iterator_move(self, bounds, link, slot);
+}
+
+static void *bp_btree_iterator_prev(struct bp_iterator *self)
+{
+    if (self->coll == NULL || self->current_idx == 0) {
+        return NULL;
+    }
+
+    bp_btree_bounds_t bounds = bp_btree_bounds(self);
+    uint32_t link            = (uint32_t) (self->current_idx >> BP_BTREE_SLOT_BITS);
+    size_t slot = self->current_idx & ((UINT32_C(1) << BP_BTREE_SLOT_BITS) - 1U);
+
+    if (slot == 0) {
+        link = bp_btree_node(bounds.tree, link)->prev;
+        slot = link == BP_BTREE_NONE ? 0 : bp_btree_node(bounds.tree, link)->count;
+    }
+
+    return bp_btree_iterator_move(self, bounds, link, slot - (link != BP_BTREE_NONE));
+}
+
+#ifdef __cplusplus
+}
+#endif
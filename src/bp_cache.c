@@ -0,0 +1,335 @@
+/*!
+ * @file bp_cache.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Implement the cache structure.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#include "bp_cache.h"
+#include "bp_hashmap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Value of a link to no slot.
+ */
+#define BP_CACHE_NONE 0U
+
+/*!
+ * Check if the cache capacity and number of buckets are valid.
+ * @param cache Reference to bp_cache.
+ * @return true if the cache is valid, false otherwise.
+ */
+static inline bool bp_cache_valid(bp_cache_t *cache);
+
+/*!
+ * Get a reference to an element.
+ * @param cache Reference to bp_cache.
+ * @param idx Index of the slot.
+ * @return Reference to the element.
+ */
+static inline uint8_t *bp_cache_slot(bp_cache_t *cache, size_t idx);
+
+/*!
+ * Get the hash bucket of a key.
+ * @param cache Reference to bp_cache.
+ * @param key Reference to the key.
+ * @return Reference to the bucket, with the first slot of its chain.
+ */
+static inline uint32_t *bp_cache_bucket(bp_cache_t *cache, const void *key);
+
+/*!
+ * Find the slot of a key in a hash bucket.
+ * @param cache Reference to bp_cache.
+ * @param bucket Reference to the bucket of the key.
+ * @param key Reference to the key.
+ * @return Index of the slot, or the cache capacity if the key isn't found.
+ */
+static size_t bp_cache_lookup(bp_cache_t *cache, uint32_t *bucket, const void *key);
+
+/*!
+ * Remove a slot from the chain of its hash bucket.
+ * @param cache Reference to bp_cache.
+ * @param idx Index of the slot.
+ */
+static void bp_cache_unhash(bp_cache_t *cache, size_t idx);
+
+/*!
+ * Remove a slot from the recency list.
+ * @param cache Reference to bp_cache.
+ * @param idx Index of the slot.
+ */
+static void bp_cache_unlink(bp_cache_t *cache, size_t idx);
+
+/*!
+ * Put a slot at the front of the recency list.
+ * @param cache Reference to bp_cache.
+ * @param idx Index of the slot.
+ */
+static void bp_cache_link_front(bp_cache_t *cache, size_t idx);
+
+/*!
+ * Mark a slot as recently used.
+ * @param cache Reference to bp_cache.
+ * @param idx Index of the slot.
+ */
+static inline void bp_cache_touch(bp_cache_t *cache, size_t idx);
+
+/*!
+ * Choose the slot to be evicted from a full cache.
+ * @param cache Reference to bp_cache.
+ * @return Index of the slot.
+ */
+static size_t bp_cache_victim(bp_cache_t *cache);
+
+int bp_cache_put(bp_cache_t *cache, void *el, void *evicted)
+{
+    if (cache == NULL) {
+        return -ENODEV;
+    }
+
+    if (el == NULL || !bp_cache_valid(cache)) {
+        return -EINVAL;
+    }
+
+    uint32_t *bucket = bp_cache_bucket(cache, el);
+    size_t idx       = bp_cache_lookup(cache, bucket, el);
+    int ret          = 0;
+
+    if (idx != cache->_capacity) {
+        memcpy(bp_cache_slot(cache, idx), el, cache->_element_size);
+        bp_cache_touch(cache, idx);
+        return 0;
+    }
+
+    if (cache->_free != BP_CACHE_NONE) {
+        idx          = cache->_free - 1U;
+        cache->_free = cache->_nodes[idx].next;
+    } else if (cache->_used < cache->_capacity) {
+        idx = cache->_used++;
+    } else {
+        idx = bp_cache_victim(cache);
+        if (evicted != NULL) {
+            memcpy(evicted, bp_cache_slot(cache, idx), cache->_element_size);
+        }
+        bp_cache_unhash(cache, idx);
+        if (cache->_kind == BP_LRU_CACHE) {
+            bp_cache_unlink(cache, idx);
+        }
+        cache->_size -= 1;
+        ret = 1;
+    }
+
+    memcpy(bp_cache_slot(cache, idx), el, cache->_element_size);
+    cache->_nodes[idx].chain = *bucket;
+    cache->_nodes[idx].ref   = 1;
+    *bucket                  = (uint32_t) idx + 1U;
+    if (cache->_kind == BP_LRU_CACHE) {
+        bp_cache_link_front(cache, idx);
+    }
+    cache->_size += 1;
+
+    return ret;
+}
+
+void *bp_cache_get(bp_cache_t *cache, void *key)
+{
+    if (cache == NULL || key == NULL || !bp_cache_valid(cache)) {
+        return NULL;
+    }
+
+    size_t idx = bp_cache_lookup(cache, bp_cache_bucket(cache, key), key);
+
+    if (idx == cache->_capacity) {
+        return NULL;
+    }
+
+    bp_cache_touch(cache, idx);
+
+    return bp_cache_slot(cache, idx);
+}
+
+int bp_cache_del(bp_cache_t *cache, void *key)
+{
+    if (cache == NULL) {
+        return -ENODEV;
+    }
+
+    if (key == NULL || !bp_cache_valid(cache)) {
+        return -EINVAL;
+    }
+
+    size_t idx = bp_cache_lookup(cache, bp_cache_bucket(cache, key), key);
+
+    if (idx == cache->_capacity) {
+        return -ENOENT;
+    }
+
+    bp_cache_unhash(cache, idx);
+    if (cache->_kind == BP_LRU_CACHE) {
+        bp_cache_unlink(cache, idx);
+    }
+    memset(bp_cache_slot(cache, idx), 0, cache->_element_size);
+    memset(&cache->_nodes[idx], 0, sizeof(bp_cache_node_t));
+    cache->_nodes[idx].next = cache->_free;
+    cache->_free            = (uint32_t) idx + 1U;
+    cache->_size -= 1;
+
+    return 0;
+}
+
+int bp_cache_clear(bp_cache_t *cache)
+{
+    if (cache == NULL) {
+        return -ENODEV;
+    }
+
+    if (cache->_used > 0) {
+        memset(cache->_slots, 0, cache->_used * cache->_element_size);
+        memset(cache->_nodes, 0, cache->_used * sizeof(bp_cache_node_t));
+    }
+    if (cache->_buckets != NULL) {
+        memset(cache->_buckets, 0, cache->_nbuckets * sizeof(uint32_t));
+    }
+    cache->_size = 0;
+    cache->_used = 0;
+    cache->_head = BP_CACHE_NONE;
+    cache->_tail = BP_CACHE_NONE;
+    cache->_free = BP_CACHE_NONE;
+    cache->_hand = 0;
+
+    return 0;
+}
+
+size_t bp_cache_size(bp_cache_t *cache)
+{
+    if (cache == NULL) {
+        return 0;
+    }
+
+    return cache->_size;
+}
+
+static inline bool bp_cache_valid(bp_cache_t *cache)
+{
+    return cache->_capacity > 0 && cache->_capacity < UINT32_MAX && cache->_nbuckets > 0 &&
+           (cache->_nbuckets & (cache->_nbuckets - 1U)) == 0;
+}
+
+static inline uint8_t *bp_cache_slot(bp_cache_t *cache, size_t idx)
+{
+    return &cache->_slots[idx * cache->_element_size];
+}
+
+static inline uint32_t *bp_cache_bucket(bp_cache_t *cache, const void *key)
+{
+    uint64_t hash = bp_hashmap_hash(key, cache->_key_size);
+
+    return &cache->_buckets[hash & (cache->_nbuckets - 1U)];
+}
+
+static size_t bp_cache_lookup(bp_cache_t *cache, uint32_t *bucket, const void *key)
+{
+    uint32_t link = *bucket;
+
+    /* Integer keys are compared as words, without calling memcmp for each slot. */
+    if (cache->_key_size == sizeof(uint32_t)) {
+        uint32_t word, target;
+        memcpy(&target, key, sizeof(target));
+        for (; link != BP_CACHE_NONE; link = cache->_nodes[link - 1U].chain) {
+            memcpy(&word, bp_cache_slot(cache, link - 1U), sizeof(word));
+            if (word == target) {
+                return link - 1U;
+            }
+        }
+        return cache->_capacity;
+    }
+
+    for (; link != BP_CACHE_NONE; link = cache->_nodes[link - 1U].chain) {
+        if (memcmp(bp_cache_slot(cache, link - 1U), key, cache->_key_size) == 0) {
+            return link - 1U;
+        }
+    }
+
+    return cache->_capacity;
+}
+
+static void bp_cache_unhash(bp_cache_t *cache, size_t idx)
+{
+    uint32_t *link = bp_cache_bucket(cache, bp_cache_slot(cache, idx));
+
+    while (*link != idx + 1U) {
+        link = &cache->_nodes[*link - 1U].chain;
+    }
+    *link = cache->_nodes[idx].chain;
+}
+
+static void bp_cache_unlink(bp_cache_t *cache, size_t idx)
+{
+    bp_cache_node_t *node = &cache->_nodes[idx];
+
+    if (node->prev != BP_CACHE_NONE) {
+        cache->_nodes[node->prev - 1U].next = node->next;
+    } else {
+        cache->_head = node->next;
+    }
+
+    if (node->next != BP_CACHE_NONE) {
+        cache->_nodes[node->next - 1U].prev = node->prev;
+    } else {
+        cache->_tail = node->prev;
+    }
+}
+
+static void bp_cache_link_front(bp_cache_t *cache, size_t idx)
+{
+    bp_cache_node_t *node = &cache->_nodes[idx];
+
+    node->prev = BP_CACHE_NONE;
+    node->next = cache->_head;
+    if (cache->_head != BP_CACHE_NONE) {
+        cache->_nodes[cache->_head - 1U].prev = (uint32_t) idx + 1U;
+    } else {
+        cache->_tail = (uint32_t) idx + 1U;
+    }
+    cache->_head = (uint32_t) idx + 1U;
+}
+
+static inline void bp_cache_touch(bp_cache_t *cache, size_t idx)
+{
+    if (cache->_kind == BP_CLOCK_CACHE) {
+        /* Avoid dirtying the cache line when the flag is already set. */
+        if (cache->_nodes[idx].ref == 0) {
+            cache->_nodes[idx].ref = 1;
+        }
+    } else if (cache->_head != idx + 1U) {
+        bp_cache_unlink(cache, idx);
+        bp_cache_link_front(cache, idx);
+    }
+}
+
+static size_t bp_cache_victim(bp_cache_t *cache)
+{
+    if (cache->_kind == BP_LRU_CACHE) {
+        return cache->_tail - 1U;
+    }
+
+    /* Every slot is in use: give a second chance to the referenced ones. */
+    for (;;) {
+        size_t idx   = cache->_hand;
+        cache->_hand = (cache->_hand + 1U) % cache->_capacity;
+        if (cache->_nodes[idx].ref == 0) {
+            return idx;
+        }
+        cache->_nodes[idx].ref = 0;
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,244 @@
+/*!
+ * @file bp_chashmap.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Implement the concurrent hash map structure.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#include "bp_chashmap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Get the stripe of a key.
+ * @param map Reference to bp_chashmap.
+ * @param key Reference to the key.
+ * @return Index of the stripe.
+ */
+static inline size_t bp_chashmap_stripe_of(bp_chashmap_t *map, const void *key);
+
+/*!
+ * Fill a bp_hashmap with the buffers and the state of a stripe.
+ * @param map Reference to bp_chashmap.
+ * @param stripe Index of the stripe.
+ * @param view [out] Reference to the bp_hashmap.
+ */
+static inline void bp_chashmap_view(bp_chashmap_t *map, size_t stripe, bp_hashmap_t *view);
+
+/*!
+ * Take the write lock of a stripe, making its sequence counter odd.
+ * @param stripe Reference to the stripe.
+ */
+static void bp_chashmap_lock(bp_chashmap_stripe_t *stripe);
+
+/*!
+ * Release the write lock of a stripe, making its sequence counter even again.
+ * @param stripe Reference to the stripe.
+ */
+static void bp_chashmap_unlock(bp_chashmap_stripe_t *stripe);
+
+int bp_chashmap_insert(bp_chashmap_t *map, void *el)
+{
+    if (map == NULL) {
+        return -ENODEV;
+    }
+
+    if (el == NULL) {
+        return -EINVAL;
+    }
+
+    size_t idx                   = bp_chashmap_stripe_of(map, el);
+    bp_chashmap_stripe_t *stripe = &map->_stripes[idx];
+    bp_hashmap_t view;
+
+    bp_chashmap_lock(stripe);
+    bp_chashmap_view(map, idx, &view);
+    int err          = bp_hashmap_insert(&view, el);
+    __atomic_store_n(&stripe->_size, view._size, __ATOMIC_RELAXED);
+    stripe->_deleted = view._deleted;
+    bp_chashmap_unlock(stripe);
+
+    return err;
+}
+
+int bp_chashmap_put(bp_chashmap_t *map, void *el)
+{
+    if (map == NULL) {
+        return -ENODEV;
+    }
+
+    if (el == NULL) {
+        return -EINVAL;
+    }
+
+    size_t idx                   = bp_chashmap_stripe_of(map, el);
+    bp_chashmap_stripe_t *stripe = &map->_stripes[idx];
+    bp_hashmap_t view;
+    int err = 0;
+
+    bp_chashmap_lock(stripe);
+    bp_chashmap_view(map, idx, &view);
+    void *old = bp_hashmap_find(&view, el);
+    if (old != NULL) {
+        memcpy(old, el, map->_element_size);
+    } else {
+        err              = bp_hashmap_insert(&view, el);
+        __atomic_store_n(&stripe->_size, view._size, __ATOMIC_RELAXED);
+        stripe->_deleted = view._deleted;
+    }
+    bp_chashmap_unlock(stripe);
+
+    return err;
+}
+
+int bp_chashmap_find(bp_chashmap_t *map, void *key, void *el)
+{
+    if (map == NULL) {
+        return -ENODEV;
+    }
+
+    if (key == NULL || el == NULL) {
+        return -EINVAL;
+    }
+
+    size_t idx                   = bp_chashmap_stripe_of(map, key);
+    bp_chashmap_stripe_t *stripe = &map->_stripes[idx];
+    bp_hashmap_t view;
+    size_t seq;
+    void *found;
+
+    bp_chashmap_view(map, idx, &view);
+
+    for (;;) {
+        seq = __atomic_load_n(&stripe->_seq, __ATOMIC_ACQUIRE);
+        if (seq & 1U) {
+            bp_cpu_relax();
+            continue;
+        }
+
+        /* The probe only reads inside the stripe buffers, so a concurrent writer can
+         * make it return garbage, but never fault. The copy is validated below. */
+        found = bp_hashmap_find(&view, key);
+        if (found != NULL) {
+            memcpy(el, found, map->_element_size);
+        }
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&stripe->_seq, __ATOMIC_RELAXED) == seq) {
+            break;
+        }
+    }
+
+    return (found != NULL) ? 0 : -ENOENT;
+}
+
+int bp_chashmap_erase(bp_chashmap_t *map, void *key)
+{
+    if (map == NULL) {
+        return -ENODEV;
+    }
+
+    if (key == NULL) {
+        return -EINVAL;
+    }
+
+    size_t idx                   = bp_chashmap_stripe_of(map, key);
+    bp_chashmap_stripe_t *stripe = &map->_stripes[idx];
+    bp_hashmap_t view;
+
+    bp_chashmap_lock(stripe);
+    bp_chashmap_view(map, idx, &view);
+    int err          = bp_hashmap_erase(&view, key);
+    __atomic_store_n(&stripe->_size, view._size, __ATOMIC_RELAXED);
+    stripe->_deleted = view._deleted;
+    bp_chashmap_unlock(stripe);
+
+    return err;
+}
+
+int bp_chashmap_clear(bp_chashmap_t *map)
+{
+    if (map == NULL) {
+        return -ENODEV;
+    }
+
+    bp_hashmap_t view;
+
+    for (size_t i = 0; i < map->_nstripes; ++i) {
+        bp_chashmap_lock(&map->_stripes[i]);
+        bp_chashmap_view(map, i, &view);
+        bp_hashmap_clear(&view);
+        __atomic_store_n(&map->_stripes[i]._size, 0, __ATOMIC_RELAXED);
+        map->_stripes[i]._deleted = 0;
+        bp_chashmap_unlock(&map->_stripes[i]);
+    }
+
+    return 0;
+}
+
+size_t bp_chashmap_size(bp_chashmap_t *map)
+{
+    if (map == NULL) {
+        return 0;
+    }
+
+    size_t size = 0;
+
+    for (size_t i = 0; i < map->_nstripes; ++i) {
+        size += __atomic_load_n(&map->_stripes[i]._size, __ATOMIC_RELAXED);
+    }
+
+    return size;
+}
+
+static inline size_t bp_chashmap_stripe_of(bp_chashmap_t *map, const void *key)
+{
+    /* The low bits pick the slot and the top bits fill the control byte, so the
+     * stripe is picked with the bits between them. */
+    return (size_t) ((bp_hashmap_hash(key, map->_key_size) >> 32) % map->_nstripes);
+}
+
+static inline void bp_chashmap_view(bp_chashmap_t *map, size_t stripe, bp_hashmap_t *view)
+{
+    uint8_t *base = &map->_maps[stripe * map->_map_size];
+
+    view->_slots        = base;
+    view->_ctrl         = base + map->_ctrl_offset;
+    view->_element_size = map->_element_size;
+    view->_capacity     = map->_stripe_capacity;
+    view->_key_size     = map->_key_size;
+    view->_size         = __atomic_load_n(&map->_stripes[stripe]._size, __ATOMIC_RELAXED);
+    view->_deleted      = map->_stripes[stripe]._deleted;
+}
+
+static void bp_chashmap_lock(bp_chashmap_stripe_t *stripe)
+{
+    size_t seq = __atomic_load_n(&stripe->_seq, __ATOMIC_RELAXED);
+
+    for (;;) {
+        if ((seq & 1U) == 0 &&
+            __atomic_compare_exchange_n(&stripe->_seq, &seq, seq + 1U, true,
+                                        __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            break;
+        }
+        bp_cpu_relax();
+        seq = __atomic_load_n(&stripe->_seq, __ATOMIC_RELAXED);
+    }
+
+    /* Keep the writes to the stripe after the counter turns odd. */
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+static void bp_chashmap_unlock(bp_chashmap_stripe_t *stripe)
+{
+    __atomic_fetch_add(&stripe->_seq, 1U, __ATOMIC_RELEASE);
+}
+
+#ifdef __cplusplus
+}
+#endif
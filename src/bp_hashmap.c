@@ -0,0 +1,482 @@
+/*!
+ * @file bp_hashmap.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Implement the hash map structure.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#include "bp_hashmap.h"
+#include "bp_bits.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define BP_HASHMAP_SSE2
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Control byte of a slot never used.
+ */
+#define BP_HASHMAP_EMPTY 0x00U
+
+/*!
+ * Control byte of a slot whose element was erased.
+ */
+#define BP_HASHMAP_DELETED 0x01U
+
+/*!
+ * Bit set in the control byte of a slot with an element. The other bits keep 7 bits
+ * of the key hash.
+ */
+#define BP_HASHMAP_FULL 0x80U
+
+/*!
+ * Check if the hash map capacity is a power of two, not smaller than a group.
+ * @param map Reference to bp_hashmap.
+ * @return true if the capacity is valid, false otherwise.
+ */
+static inline bool bp_hashmap_valid(bp_hashmap_t *map);
+
+/*!
+ * Get the control byte of a full slot, from the key hash.
+ * @param hash The key hash.
+ * @return The control byte.
+ */
+static inline uint8_t bp_hashmap_h2(uint64_t hash);
+
+/*!
+ * Get a mask with the control bytes of a group that are equal to a byte.
+ * @param group Reference to the first control byte of the group.
+ * @param byte The byte to be matched.
+ * @return Mask with the bit i set if the i-th control byte matches.
+ */
+static inline uint32_t bp_hashmap_match(const uint8_t *group, uint8_t byte);
+
+/*!
+ * Get a mask with the control bytes of a group that aren't full.
+ * @param group Reference to the first control byte of the group.
+ * @return Mask with the bit i set if the i-th slot is empty or deleted.
+ */
+static inline uint32_t bp_hashmap_match_free(const uint8_t *group);
+
+/*!
+ * Set the control byte of a slot, keeping the mirror of the first group.
+ * @param map Reference to bp_hashmap.
+ * @param idx Index of the slot.
+ * @param ctrl The control byte.
+ */
+static inline void bp_hashmap_set_ctrl(bp_hashmap_t *map, size_t idx, uint8_t ctrl);
+
+/*!
+ * Compare two keys.
+ * @param left Reference to a key.
+ * @param right Reference to the other key.
+ * @param key_size Size (in bytes) of the keys.
+ * @return true if the keys are equal, false otherwise.
+ */
+static inline bool bp_hashmap_key_eq(const uint8_t *left, const uint8_t *right,
+                                     size_t key_size);
+
+/*!
+ * Find the slot of a key.
+ * @param map Reference to bp_hashmap.
+ * @param key Reference to the key.
+ * @param hash The key hash.
+ * @return Index of the slot, or the hash map capacity if the key isn't found.
+ */
+static size_t bp_hashmap_find_slot(bp_hashmap_t *map, const uint8_t *key, uint64_t hash);
+
+/*!
+ * Find the first slot that isn't full in the probe sequence of a hash.
+ * @param map Reference to bp_hashmap.
+ * @param hash The key hash.
+ * @return Index of the slot.
+ */
+static size_t bp_hashmap_find_free(bp_hashmap_t *map, uint64_t hash);
+
+/*!
+ * Rehash the elements in place, turning all the deleted slots into empty ones.
+ * @param map Reference to bp_hashmap.
+ */
+static void bp_hashmap_rehash(bp_hashmap_t *map);
+
+int bp_hashmap_init(bp_hashmap_t *map, uint8_t *ctrl, void *slots, size_t element_size,
+                    size_t capacity, size_t key_size)
+{
+    if (map == NULL) {
+        return -ENODEV;
+    }
+
+    if (ctrl == NULL || slots == NULL || key_size == 0 || key_size > element_size) {
+        return -EINVAL;
+    }
+
+    map->_ctrl         = ctrl;
+    map->_slots        = slots;
+    map->_element_size = element_size;
+    map->_capacity     = capacity;
+    map->_key_size     = key_size;
+    map->_size         = 0;
+    map->_deleted      = 0;
+
+    if (!bp_hashmap_valid(map)) {
+        return -EINVAL;
+    }
+
+    memset(ctrl, BP_HASHMAP_EMPTY, capacity + BP_HASHMAP_GROUP_SIZE);
+
+    return 0;
+}
+
+int bp_hashmap_insert(bp_hashmap_t *map, void *el)
+{
+    if (map == NULL) {
+        return -ENODEV;
+    }
+
+    if (el == NULL || !bp_hashmap_valid(map)) {
+        return -EINVAL;
+    }
+
+    uint64_t hash = bp_hashmap_hash(el, map->_key_size);
+
+    if (bp_hashmap_find_slot(map, el, hash) != map->_capacity) {
+        return -EEXIST;
+    }
+
+    size_t idx = bp_hashmap_find_free(map, hash);
+
+    /* Reusing a deleted slot doesn't make the probe sequences longer, but taking an
+     * empty one does, so it's limited to 7/8 of the slots. */
+    if (map->_ctrl[idx] == BP_HASHMAP_EMPTY &&
+        map->_size + map->_deleted >= map->_capacity - map->_capacity / 8U) {
+        if (map->_deleted == 0) {
+            return -ENOMEM;
+        }
+        bp_hashmap_rehash(map);
+        idx = bp_hashmap_find_free(map, hash);
+    }
+
+    if (map->_ctrl[idx] == BP_HASHMAP_DELETED) {
+        map->_deleted -= 1;
+    }
+
+    bp_hashmap_set_ctrl(map, idx, bp_hashmap_h2(hash));
+    memcpy(&map->_slots[idx * map->_element_size], el, map->_element_size);
+    map->_size += 1;
+
+    return 0;
+}
+
+void *bp_hashmap_find(bp_hashmap_t *map, void *key)
+{
+    if (map == NULL || key == NULL || !bp_hashmap_valid(map)) {
+        return NULL;
+    }
+
+    size_t idx = bp_hashmap_find_slot(map, key, bp_hashmap_hash(key, map->_key_size));
+
+    if (idx == map->_capacity) {
+        return NULL;
+    }
+
+    return &map->_slots[idx * map->_element_size];
+}
+
+int bp_hashmap_erase(bp_hashmap_t *map, void *key)
+{
+    if (map == NULL) {
+        return -ENODEV;
+    }
+
+    if (key == NULL || !bp_hashmap_valid(map)) {
+        return -EINVAL;
+    }
+
+    size_t idx = bp_hashmap_find_slot(map, key, bp_hashmap_hash(key, map->_key_size));
+
+    if (idx == map->_capacity) {
+        return -ENOENT;
+    }
+
+    size_t mask   = map->_capacity - 1U;
+    size_t before = 0;
+    size_t after  = 0;
+
+    while (before < BP_HASHMAP_GROUP_SIZE - 1U &&
+           map->_ctrl[(idx - before - 1U) & mask] != BP_HASHMAP_EMPTY) {
+        before += 1;
+    }
+    while (after < BP_HASHMAP_GROUP_SIZE - 1U &&
+           map->_ctrl[(idx + after + 1U) & mask] != BP_HASHMAP_EMPTY) {
+        after += 1;
+    }
+
+    /* If every group holding this slot has an empty slot too, no probe went past it,
+     * so it can be empty again. Otherwise it must be kept as a tombstone. */
+    if (before + after + 1U < BP_HASHMAP_GROUP_SIZE) {
+        bp_hashmap_set_ctrl(map, idx, BP_HASHMAP_EMPTY);
+    } else {
+        bp_hashmap_set_ctrl(map, idx, BP_HASHMAP_DELETED);
+        map->_deleted += 1;
+    }
+
+    memset(&map->_slots[idx * map->_element_size], 0, map->_element_size);
+    map->_size -= 1;
+
+    return 0;
+}
+
+int bp_hashmap_clear(bp_hashmap_t *map)
+{
+    if (map == NULL) {
+        return -ENODEV;
+    }
+
+    if (map->_ctrl != NULL) {
+        memset(map->_ctrl, BP_HASHMAP_EMPTY, map->_capacity + BP_HASHMAP_GROUP_SIZE);
+    }
+    map->_size    = 0;
+    map->_deleted = 0;
+
+    return 0;
+}
+
+size_t bp_hashmap_size(bp_hashmap_t *map)
+{
+    if (map == NULL) {
+        return 0;
+    }
+
+    return map->_size;
+}
+
+size_t bp_hashmap_capacity(bp_hashmap_t *map)
+{
+    if (map == NULL) {
+        return 0;
+    }
+
+    return map->_capacity;
+}
+
+uint64_t bp_hashmap_hash(const void *key, size_t key_size)
+{
+    const uint8_t *bytes = key;
+    uint64_t hash;
+
+    if (key_size == sizeof(uint32_t)) {
+        uint32_t word32;
+        memcpy(&word32, bytes, sizeof(word32));
+        hash = word32;
+    } else if (key_size == sizeof(uint64_t)) {
+        memcpy(&hash, bytes, sizeof(hash));
+    } else {
+        uint64_t word;
+        size_t len;
+
+        hash = key_size;
+        for (size_t i = 0; i < key_size; i += sizeof(word)) {
+            len  = (key_size - i < sizeof(word)) ? (key_size - i) : sizeof(word);
+            word = 0;
+            memcpy(&word, &bytes[i], len);
+            hash = (hash ^ word) * UINT64_C(0x9E3779B97F4A7C15);
+        }
+    }
+
+    /* Both the low bits (slot) and the high bits (control byte) are used, so mix all
+     * the bits of the key into them. */
+    hash ^= hash >> 33;
+    hash *= UINT64_C(0xFF51AFD7ED558CCD);
+    hash ^= hash >> 33;
+    hash *= UINT64_C(0xC4CEB9FE1A85EC53);
+    hash ^= hash >> 33;
+
+    return hash;
+}
+
+static inline bool bp_hashmap_valid(bp_hashmap_t *map)
+{
+    return map->_capacity >= BP_HASHMAP_GROUP_SIZE &&
+           (map->_capacity & (map->_capacity - 1U)) == 0;
+}
+
+static inline uint8_t bp_hashmap_h2(uint64_t hash)
+{
+    return (uint8_t) (BP_HASHMAP_FULL | (hash >> 57));
+}
+
+#ifdef BP_HASHMAP_SSE2
+static inline uint32_t bp_hashmap_match(const uint8_t *group, uint8_t byte)
+{
+    __m128i ctrl = _mm_loadu_si128((const __m128i *) group);
+
+    return (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char) byte)));
+}
+
+static inline uint32_t bp_hashmap_match_free(const uint8_t *group)
+{
+    __m128i ctrl = _mm_loadu_si128((const __m128i *) group);
+
+    /* Only the full slots have the most significant bit set. */
+    return ~(uint32_t) _mm_movemask_epi8(ctrl) & 0xFFFFU;
+}
+#else
+static inline uint32_t bp_hashmap_match(const uint8_t *group, uint8_t byte)
+{
+    uint32_t mask = 0;
+
+    for (uint32_t i = 0; i < BP_HASHMAP_GROUP_SIZE; ++i) {
+        mask |= (uint32_t) (group[i] == byte) << i;
+    }
+
+    return mask;
+}
+
+static inline uint32_t bp_hashmap_match_free(const uint8_t *group)
+{
+    uint32_t mask = 0;
+
+    for (uint32_t i = 0; i < BP_HASHMAP_GROUP_SIZE; ++i) {
+        mask |= (uint32_t) ((group[i] & BP_HASHMAP_FULL) == 0) << i;
+    }
+
+    return mask;
+}
+#endif
+
+static inline void bp_hashmap_set_ctrl(bp_hashmap_t *map, size_t idx, uint8_t ctrl)
+{
+    map->_ctrl[idx] = ctrl;
+    if (idx < BP_HASHMAP_GROUP_SIZE) {
+        map->_ctrl[map->_capacity + idx] = ctrl;
+    }
+}
+
+static inline bool bp_hashmap_key_eq(const uint8_t *left, const uint8_t *right,
+                                     size_t key_size)
+{
+    if (key_size == sizeof(uint32_t)) {
+        uint32_t l, r;
+        memcpy(&l, left, sizeof(l));
+        memcpy(&r, right, sizeof(r));
+        return l == r;
+    }
+
+    if (key_size == sizeof(uint64_t)) {
+        uint64_t l, r;
+        memcpy(&l, left, sizeof(l));
+        memcpy(&r, right, sizeof(r));
+        return l == r;
+    }
+
+    return memcmp(left, right, key_size) == 0;
+}
+
+static size_t bp_hashmap_find_slot(bp_hashmap_t *map, const uint8_t *key, uint64_t hash)
+{
+    size_t mask = map->_capacity - 1U;
+    size_t pos  = (size_t) (hash >> 7) & mask;
+    uint8_t h2  = bp_hashmap_h2(hash);
+
+    for (size_t step = BP_HASHMAP_GROUP_SIZE; step <= map->_capacity;
+         step += BP_HASHMAP_GROUP_SIZE) {
+        const uint8_t *group = &map->_ctrl[pos];
+        uint32_t match       = bp_hashmap_match(group, h2);
+
+        while (match != 0) {
+            size_t idx = (pos + bp_ctz64(match)) & mask;
+            if (bp_hashmap_key_eq(&map->_slots[idx * map->_element_size], key,
+                                  map->_key_size)) {
+                return idx;
+            }
+            match &= match - 1U;
+        }
+
+        if (bp_hashmap_match(group, BP_HASHMAP_EMPTY) != 0) {
+            break;
+        }
+
+        pos = (pos + step) & mask;
+    }
+
+    return map->_capacity;
+}
+
+static size_t bp_hashmap_find_free(bp_hashmap_t *map, uint64_t hash)
+{
+    size_t mask = map->_capacity - 1U;
+    size_t pos  = (size_t) (hash >> 7) & mask;
+    size_t step = BP_HASHMAP_GROUP_SIZE;
+    uint32_t match;
+
+    /* The load limit keeps empty slots in the table, so the probe always ends. */
+    while ((match = bp_hashmap_match_free(&map->_ctrl[pos])) == 0) {
+        pos = (pos + step) & mask;
+        step += BP_HASHMAP_GROUP_SIZE;
+    }
+
+    return (pos + bp_ctz64(match)) & mask;
+}
+
+static void bp_hashmap_rehash(bp_hashmap_t *map)
+{
+    size_t mask    = map->_capacity - 1U;
+    size_t el_size = map->_element_size;
+
+    /* Mark the elements as deleted (still to be placed) and the tombstones as empty. */
+    for (size_t i = 0; i < map->_capacity; ++i) {
+        map->_ctrl[i] = (map->_ctrl[i] & BP_HASHMAP_FULL) ? BP_HASHMAP_DELETED
+                                                          : BP_HASHMAP_EMPTY;
+    }
+    memcpy(&map->_ctrl[map->_capacity], map->_ctrl, BP_HASHMAP_GROUP_SIZE);
+
+    for (size_t i = 0; i < map->_capacity; ++i) {
+        if (map->_ctrl[i] != BP_HASHMAP_DELETED) {
+            continue;
+        }
+
+        uint8_t *slot = &map->_slots[i * el_size];
+        uint64_t hash = bp_hashmap_hash(slot, map->_key_size);
+        size_t start  = (size_t) (hash >> 7) & mask;
+        size_t target = bp_hashmap_find_free(map, hash);
+
+        /* Already in the first group of its probe sequence that has room. */
+        if (((target - start) & mask) / BP_HASHMAP_GROUP_SIZE ==
+            ((i - start) & mask) / BP_HASHMAP_GROUP_SIZE) {
+            bp_hashmap_set_ctrl(map, i, bp_hashmap_h2(hash));
+            continue;
+        }
+
+        uint8_t *target_slot = &map->_slots[target * el_size];
+
+        if (map->_ctrl[target] == BP_HASHMAP_EMPTY) {
+            memcpy(target_slot, slot, el_size);
+            memset(slot, 0, el_size);
+            bp_hashmap_set_ctrl(map, target, bp_hashmap_h2(hash));
+            bp_hashmap_set_ctrl(map, i, BP_HASHMAP_EMPTY);
+        } else {
+            /* The target holds an element still to be placed: swap them and place the
+             * one that came to this slot. */
+            for (size_t b = 0; b < el_size; ++b) {
+                uint8_t tmp    = slot[b];
+                slot[b]        = target_slot[b];
+                target_slot[b] = tmp;
+            }
+            bp_hashmap_set_ctrl(map, target, bp_hashmap_h2(hash));
+            i -= 1;
+        }
+    }
+
+    map->_deleted = 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,273 @@
+/*!
+ * @file bp_packed.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Implement the packed array structure.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#include <stdbool.h>
+#include <string.h>
+
+#include "bp_bits.h"
+#include "bp_packed.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Widest element unpacked by the AVX2 path. A 32-bit load at the byte of its first bit
+ * always holds the whole element.
+ */
+#define BP_PACKED_GATHER_BITS 25U
+
+/*!
+ * Check if the width of the elements is valid.
+ * @param packed Reference to bp_packed.
+ * @return true if the width is valid, false otherwise.
+ */
+static inline bool bp_packed_valid(bp_packed_t *packed);
+
+/*!
+ * Get the mask of the bits of an element.
+ * @param packed Reference to bp_packed.
+ * @return The mask, with the lowest '_bits' bits set.
+ */
+static inline uint64_t bp_packed_mask(bp_packed_t *packed);
+
+/*!
+ * Read an element. Its index must be valid.
+ * @param packed Reference to bp_packed.
+ * @param idx Index of the element.
+ * @return The element.
+ */
+static inline uint64_t bp_packed_read(bp_packed_t *packed, size_t idx);
+
+/*!
+ * Write an element. Its index must be valid and the value must fit in the width.
+ * @param packed Reference to bp_packed.
+ * @param idx Index of the element.
+ * @param value The element.
+ */
+static inline void bp_packed_write(bp_packed_t *packed, size_t idx, uint64_t value);
+
+int bp_packed_push(bp_packed_t *packed, uint64_t value)
+{
+    if (packed == NULL) {
+        return -ENODEV;
+    }
+
+    if (!bp_packed_valid(packed) || (value & ~bp_packed_mask(packed)) != 0) {
+        return -EINVAL;
+    }
+
+    if (packed->_size >= packed->_capacity) {
+        return -ENOMEM;
+    }
+
+    bp_packed_write(packed, packed->_size, value);
+    packed->_size += 1;
+
+    return 0;
+}
+
+int bp_packed_append(bp_packed_t *packed, const uint64_t *values, size_t count)
+{
+    if (packed == NULL) {
+        return -ENODEV;
+    }
+
+    if (values == NULL || !bp_packed_valid(packed)) {
+        return -EINVAL;
+    }
+
+    if (count > packed->_capacity - packed->_size) {
+        return -ENOMEM;
+    }
+
+    uint64_t any = 0;
+    for (size_t i = 0; i < count; ++i) {
+        any |= values[i];
+    }
+    if ((any & ~bp_packed_mask(packed)) != 0) {
+        return -EINVAL;
+    }
+
+    size_t bits   = packed->_bits;
+    size_t bit    = packed->_size * bits;
+    size_t w      = bit / 64U;
+    size_t off    = bit % 64U;
+    uint64_t word = packed->_words[w];
+
+    /* Fill a word in a register, and only store it when it's complete. The bits past the
+     * last element are always zero, so the partial word can be or-ed. */
+    for (size_t i = 0; i < count; ++i) {
+        word |= values[i] << off;
+        off += bits;
+        if (off >= 64U) {
+            packed->_words[w++] = word;
+            off -= 64U;
+            word = off == 0 ? 0 : values[i] >> (bits - off);
+        }
+    }
+    if (off > 0) {
+        packed->_words[w] = word;
+    }
+    packed->_size += count;
+
+    return 0;
+}
+
+uint64_t bp_packed_get(bp_packed_t *packed, size_t idx)
+{
+    if (packed == NULL || idx >= packed->_size) {
+        return 0;
+    }
+
+    return bp_packed_read(packed, idx);
+}
+
+int bp_packed_set(bp_packed_t *packed, size_t idx, uint64_t value)
+{
+    if (packed == NULL) {
+        return -ENODEV;
+    }
+
+    if (idx >= packed->_size || (value & ~bp_packed_mask(packed)) != 0) {
+        return -EINVAL;
+    }
+
+    bp_packed_write(packed, idx, value);
+
+    return 0;
+}
+
+int bp_packed_unpack(bp_packed_t *packed, size_t start, size_t count, uint64_t *out)
+{
+    if (packed == NULL) {
+        return -ENODEV;
+    }
+
+    if (out == NULL || start > packed->_size || count > packed->_size - start) {
+        return -EINVAL;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = bp_packed_read(packed, start + i);
+    }
+
+    return 0;
+}
+
+int bp_packed_unpack32(bp_packed_t *packed, size_t start, size_t count, uint32_t *out)
+{
+    if (packed == NULL) {
+        return -ENODEV;
+    }
+
+    if (out == NULL || start > packed->_size || count > packed->_size - start ||
+        packed->_bits > 32U) {
+        return -EINVAL;
+    }
+
+    size_t i = 0;
+
+#ifdef __AVX2__
+    if (packed->_bits <= BP_PACKED_GATHER_BITS) {
+        const uint8_t *bytes = (const uint8_t *) packed->_words;
+        __m256i bits         = _mm256_set1_epi32((int) packed->_bits);
+        __m256i lanes = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), bits);
+        __m256i mask  = _mm256_set1_epi32((int) bp_packed_mask(packed));
+        __m256i seven = _mm256_set1_epi32(7);
+
+        /* Each lane loads the 4 bytes starting at the first byte of its element. The
+         * extra word at the end of the buffer keeps the last loads inside it. */
+        for (; i + 8U <= count; i += 8U) {
+            size_t bit    = (start + i) * packed->_bits;
+            __m256i pos   = _mm256_add_epi32(lanes, _mm256_set1_epi32((int) (bit % 8U)));
+            __m256i word  = _mm256_i32gather_epi32((const int *) (bytes + bit / 8U),
+                                                   _mm256_srli_epi32(pos, 3), 1);
+            __m256i value = _mm256_srlv_epi32(word, _mm256_and_si256(pos, seven));
+            _mm256_storeu_si256((__m256i *) &out[i], _mm256_and_si256(value, mask));
+        }
+    }
+#endif
+
+    for (; i < count; ++i) {
+        out[i] = (uint32_t) bp_packed_read(packed, start + i);
+    }
+
+    return 0;
+}
+
+int bp_packed_clear(bp_packed_t *packed)
+{
+    if (packed == NULL) {
+        return -ENODEV;
+    }
+
+    size_t words = (packed->_size * packed->_bits + 63U) / 64U;
+
+    if (words > 0) {
+        memset(packed->_words, 0, words * sizeof(uint64_t));
+    }
+    packed->_size = 0;
+
+    return 0;
+}
+
+size_t bp_packed_size(bp_packed_t *packed)
+{
+    if (packed == NULL) {
+        return 0;
+    }
+
+    return packed->_size;
+}
+
+static inline bool bp_packed_valid(bp_packed_t *packed)
+{
+    return packed->_bits > 0 && packed->_bits <= 64U;
+}
+
+static inline uint64_t bp_packed_mask(bp_packed_t *packed)
+{
+    return bp_mask64((unsigned int) packed->_bits);
+}
+
+static inline uint64_t bp_packed_read(bp_packed_t *packed, size_t idx)
+{
+    size_t bit     = idx * packed->_bits;
+    size_t off     = bit % 64U;
+    uint64_t *word = &packed->_words[bit / 64U];
+
+    /* The next word always exists, so both are read without a branch. The high part is
+     * shifted in two steps, to avoid a shift by 64 when the offset is zero. */
+    uint64_t value = (word[0] >> off) | ((word[1] << 1) << (63U - off));
+
+    return value & bp_packed_mask(packed);
+}
+
+static inline void bp_packed_write(bp_packed_t *packed, size_t idx, uint64_t value)
+{
+    size_t bit     = idx * packed->_bits;
+    size_t off     = bit % 64U;
+    uint64_t mask  = bp_packed_mask(packed);
+    uint64_t *word = &packed->_words[bit / 64U];
+
+    word[0] = (word[0] & ~(mask << off)) | (value << off);
+    if (off + packed->_bits > 64U) {
+        word[1] = (word[1] & ~(mask >> (64U - off))) | (value >> (64U - off));
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
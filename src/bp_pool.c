@@ -0,0 +1,195 @@
+/*!
+ * @file bp_pool.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Implement the pool structure.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#include "bp_pool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Allocate a block to store elements of a structure, checking the element size.
+ * @param pool Reference to bp_pool.
+ * @param element_size Size (in bytes) of a single element.
+ * @param block [out] Reference to the allocated block.
+ * @return 0 on success.
+ * @return -EINVAL if the element size is zero, or larger than a block, or if the block
+ * isn't aligned to the alignment of the element size.
+ * @return -ENOMEM if there isn't any free block.
+ */
+static int bp_pool_alloc_for(bp_pool_t *pool, size_t element_size, uint8_t **block);
+
+void *bp_pool_alloc(bp_pool_t *pool)
+{
+    if (pool == NULL) {
+        return NULL;
+    }
+
+    uint32_t idx;
+
+    /* The released blocks go first; the never used ones are taken only when there
+     * isn't any, so a zeroed free stack is a valid initial state. */
+    if (bp_stack_pop(&pool->_free, &idx) == 0) {
+        return pool->_blocks + (size_t) idx * pool->_block_size;
+    }
+
+    if (pool->_next >= pool->_capacity) {
+        return NULL;
+    }
+
+    return pool->_blocks + pool->_next++ * pool->_block_size;
+}
+
+int bp_pool_free(bp_pool_t *pool, void *block)
+{
+    if (pool == NULL) {
+        return -ENODEV;
+    }
+
+    uint8_t *ptr = block;
+
+    if (ptr < pool->_blocks || pool->_block_size == 0) {
+        return -EFAULT;
+    }
+
+    size_t offset = (size_t) (ptr - pool->_blocks);
+    size_t idx    = offset / pool->_block_size;
+
+    /* There can't be more free blocks than allocated ones, so this catches a double free
+     * once every block is released. */
+    if (idx >= pool->_next || offset % pool->_block_size != 0 ||
+        bp_stack_size(&pool->_free) >= pool->_next) {
+        return -EFAULT;
+    }
+
+    uint32_t free_idx = (uint32_t) idx;
+
+    return bp_stack_push(&pool->_free, &free_idx);
+}
+
+int bp_pool_reset(bp_pool_t *pool)
+{
+    if (pool == NULL) {
+        return -ENODEV;
+    }
+
+    pool->_next = 0;
+
+    return bp_stack_clear(&pool->_free);
+}
+
+size_t bp_pool_available(bp_pool_t *pool)
+{
+    if (pool == NULL) {
+        return 0;
+    }
+
+    return (pool->_capacity - pool->_next) + bp_stack_size(&pool->_free);
+}
+
+size_t bp_pool_block_size(bp_pool_t *pool)
+{
+    if (pool == NULL) {
+        return 0;
+    }
+
+    return pool->_block_size;
+}
+
+int bp_pool_array_init(bp_pool_t *pool, bp_array_t *array, size_t element_size)
+{
+    if (pool == NULL || array == NULL) {
+        return -ENODEV;
+    }
+
+    uint8_t *block;
+    int err = bp_pool_alloc_for(pool, element_size, &block);
+    if (err) {
+        return err;
+    }
+
+    array->_element_size = element_size;
+    array->_capacity     = pool->_block_size / element_size;
+    array->_size         = 0;
+    array->_array        = block;
+
+    return 0;
+}
+
+int bp_pool_stack_init(bp_pool_t *pool, bp_stack_t *stack, size_t element_size)
+{
+    if (pool == NULL || stack == NULL) {
+        return -ENODEV;
+    }
+
+    uint8_t *block;
+    int err = bp_pool_alloc_for(pool, element_size, &block);
+    if (err) {
+        return err;
+    }
+
+    stack->_element_size = element_size;
+    stack->_capacity     = pool->_block_size / element_size;
+    stack->_size         = 0;
+    stack->_buffer       = block;
+
+    return 0;
+}
+
+int bp_pool_ring_init(bp_pool_t *pool, bp_ring_t *ring, size_t element_size)
+{
+    if (pool == NULL || ring == NULL) {
+        return -ENODEV;
+    }
+
+    uint8_t *block;
+    int err = bp_pool_alloc_for(pool, element_size, &block);
+    if (err) {
+        return err;
+    }
+
+    ring->_array        = block;
+    ring->_element_size = element_size;
+    ring->_capacity     = pool->_block_size / element_size;
+    ring->_size         = 0;
+    ring->_head         = 0;
+    ring->_tail         = 0;
+
+    return 0;
+}
+
+static int bp_pool_alloc_for(bp_pool_t *pool, size_t element_size, uint8_t **block)
+{
+    if (element_size == 0 || element_size > pool->_block_size) {
+        return -EINVAL;
+    }
+
+    /* The alignment of a type is the largest power of two that divides its size, up to
+     * BP_POOL_ALIGN. Every block is aligned if the first one is and the block size is a
+     * multiple of the alignment. */
+    size_t align = element_size & (~element_size + 1U);
+    if (align > BP_POOL_ALIGN) {
+        align = BP_POOL_ALIGN;
+    }
+    if ((uintptr_t) pool->_blocks % align != 0 || pool->_block_size % align != 0) {
+        return -EINVAL;
+    }
+
+    *block = bp_pool_alloc(pool);
+    if (*block == NULL) {
+        return -ENOMEM;
+    }
+
+    return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
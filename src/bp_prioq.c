@@ -0,0 +1,162 @@
+/*!
+ * @file bp_prioq.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Implement the multi-level priority queue.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#include "bp_prioq.h"
+#include "bp_bits.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Check if a level exists.
+ * @param queue Reference to bp_prioq.
+ * @param level The level.
+ * @return true if the level exists, false otherwise.
+ */
+static inline bool bp_prioq_valid(bp_prioq_t *queue, size_t level);
+
+/*!
+ * Remove the oldest element of a level that has elements, keeping the bitmap in sync.
+ * @param queue Reference to bp_prioq.
+ * @param level The level.
+ * @param el [out] Reference to a variable where the removed element will be put. It can
+ * be NULL.
+ */
+static void bp_prioq_take(bp_prioq_t *queue, size_t level, void *el);
+
+int bp_prioq_push(bp_prioq_t *queue, size_t level, void *el)
+{
+    if (queue == NULL || el == NULL) {
+        return -ENODEV;
+    }
+
+    if (!bp_prioq_valid(queue, level)) {
+        return -EINVAL;
+    }
+
+    int err = bp_ring_push_back_n(&queue->_levels[level], el, 1);
+    if (err) {
+        return err;
+    }
+
+    queue->_bitmap |= UINT64_C(1) << level;
+    queue->_size += 1;
+
+    return 0;
+}
+
+void *bp_prioq_peek(bp_prioq_t *queue, size_t *level)
+{
+    if (queue == NULL || queue->_bitmap == 0) {
+        return NULL;
+    }
+
+    size_t top = bp_ctz64(queue->_bitmap);
+
+    if (level != NULL) {
+        *level = top;
+    }
+
+    return bp_ring_peek(&queue->_levels[top]);
+}
+
+int bp_prioq_pop(bp_prioq_t *queue, void *el, size_t *level)
+{
+    if (queue == NULL) {
+        return -ENODEV;
+    }
+
+    if (queue->_bitmap == 0) {
+        return -ENOENT;
+    }
+
+    size_t top = bp_ctz64(queue->_bitmap);
+
+    bp_prioq_take(queue, top, el);
+    if (level != NULL) {
+        *level = top;
+    }
+
+    return 0;
+}
+
+int bp_prioq_pop_level(bp_prioq_t *queue, size_t level, void *el)
+{
+    if (queue == NULL) {
+        return -ENODEV;
+    }
+
+    if (!bp_prioq_valid(queue, level)) {
+        return -EINVAL;
+    }
+
+    if ((queue->_bitmap & (UINT64_C(1) << level)) == 0) {
+        return -ENOENT;
+    }
+
+    bp_prioq_take(queue, level, el);
+
+    return 0;
+}
+
+int bp_prioq_clear(bp_prioq_t *queue)
+{
+    if (queue == NULL) {
+        return -ENODEV;
+    }
+
+    /* Only the levels with elements need to be cleared. */
+    while (queue->_bitmap != 0) {
+        bp_ring_clear(&queue->_levels[bp_ctz64(queue->_bitmap)]);
+        queue->_bitmap &= queue->_bitmap - 1U;
+    }
+    queue->_size = 0;
+
+    return 0;
+}
+
+size_t bp_prioq_size(bp_prioq_t *queue)
+{
+    if (queue == NULL) {
+        return 0;
+    }
+
+    return queue->_size;
+}
+
+size_t bp_prioq_level_size(bp_prioq_t *queue, size_t level)
+{
+    if (queue == NULL || !bp_prioq_valid(queue, level)) {
+        return 0;
+    }
+
+    return bp_ring_size(&queue->_levels[level]);
+}
+
+static inline bool bp_prioq_valid(bp_prioq_t *queue, size_t level)
+{
+    return level < queue->_nlevels && level < BP_PRIOQ_MAX_LEVELS;
+}
+
+static void bp_prioq_take(bp_prioq_t *queue, size_t level, void *el)
+{
+    bp_ring_t *ring = &queue->_levels[level];
+
+    bp_ring_pop(ring, el);
+    if (bp_ring_size(ring) == 0) {
+        queue->_bitmap &= ~(UINT64_C(1) << level);
+    }
+    queue->_size -= 1;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,182 @@
+/*!
+ * @file bp_quantile.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Implement the sliding window quantile estimator.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#include <math.h>
+#include <string.h>
+
+#include "bp_quantile.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Get the bucket of a sample. The samples out of the range go to the first or the last
+ * bucket.
+ * @param quantile Reference to bp_quantile.
+ * @param value The sample. It must not be NaN.
+ * @return The bucket.
+ */
+static uint32_t bp_quantile_bucket(bp_quantile_t *quantile, double value);
+
+/*!
+ * Add a value to the count of a bucket, in the Fenwick tree.
+ * @param quantile Reference to bp_quantile.
+ * @param bucket The bucket.
+ * @param delta Value added to the count. It's 1 or UINT32_MAX (-1).
+ */
+static void bp_quantile_add(bp_quantile_t *quantile, uint32_t bucket, uint32_t delta);
+
+/*!
+ * Find the bucket of the sample with a given rank. It descends the Fenwick tree from the
+ * largest power of two, so it takes log2(buckets) steps.
+ * @param quantile Reference to bp_quantile.
+ * @param rank Rank of the sample, starting from 0. It must be less than the size.
+ * @return The bucket.
+ */
+static size_t bp_quantile_find(bp_quantile_t *quantile, size_t rank);
+
+int bp_quantile_check(bp_quantile_t *quantile)
+{
+    if (quantile == NULL) {
+        return -ENODEV;
+    }
+
+    if (quantile->_buckets == 0 || (quantile->_buckets & (quantile->_buckets - 1U)) != 0 ||
+        !isfinite(quantile->_hi - quantile->_lo) || !(quantile->_hi > quantile->_lo)) {
+        return -EINVAL;
+    }
+
+    return 0;
+}
+
+int bp_quantile_push(bp_quantile_t *quantile, double value)
+{
+    if (quantile == NULL) {
+        return -ENODEV;
+    }
+
+    if (!isfinite(value)) {
+        return -EINVAL;
+    }
+
+    uint32_t bucket = bp_quantile_bucket(quantile, value);
+    uint32_t oldest;
+
+    if (quantile->_samples._size == quantile->_samples._capacity) {
+        bp_ring_pop(&quantile->_samples, &oldest);
+        bp_quantile_add(quantile, oldest, UINT32_MAX);
+    }
+    bp_ring_push(&quantile->_samples, &bucket);
+    bp_quantile_add(quantile, bucket, 1U);
+
+    return 0;
+}
+
+int bp_quantile_query(bp_quantile_t *quantile, const double *quantiles, size_t count,
+                      double *out)
+{
+    if (quantile == NULL || quantiles == NULL || out == NULL) {
+        return -ENODEV;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        if (!(quantiles[i] >= 0.0 && quantiles[i] <= 1.0)) {
+            return -EINVAL;
+        }
+    }
+
+    size_t size = quantile->_samples._size;
+    if (size == 0) {
+        return -ENOENT;
+    }
+
+    double width = (quantile->_hi - quantile->_lo) / (double) quantile->_buckets;
+
+    for (size_t i = 0; i < count; ++i) {
+        size_t rank   = (size_t) (quantiles[i] * (double) (size - 1U) + 0.5);
+        size_t bucket = bp_quantile_find(quantile, rank);
+        out[i]        = quantile->_lo + ((double) bucket + 0.5) * width;
+    }
+
+    return 0;
+}
+
+int bp_quantile_clear(bp_quantile_t *quantile)
+{
+    if (quantile == NULL) {
+        return -ENODEV;
+    }
+
+    bp_ring_clear(&quantile->_samples);
+    if (quantile->_buckets > 0) {
+        memset(quantile->_tree, 0, quantile->_buckets * sizeof(uint32_t));
+    }
+
+    return 0;
+}
+
+size_t bp_quantile_size(bp_quantile_t *quantile)
+{
+    if (quantile == NULL) {
+        return 0;
+    }
+
+    return bp_ring_size(&quantile->_samples);
+}
+
+static uint32_t bp_quantile_bucket(bp_quantile_t *quantile, double value)
+{
+    double pos = (value - quantile->_lo) / (quantile->_hi - quantile->_lo) *
+                 (double) quantile->_buckets;
+
+    /* A NaN position, from an overflow in an unchecked range, goes to the first bucket
+     * instead of being converted. */
+    if (!(pos >= 0.0)) {
+        return 0;
+    }
+    if (pos >= (double) quantile->_buckets) {
+        return (uint32_t) (quantile->_buckets - 1U);
+    }
+
+    return (uint32_t) pos;
+}
+
+static void bp_quantile_add(bp_quantile_t *quantile, uint32_t bucket, uint32_t delta)
+{
+    /* The tree is 1-based: the node i covers the (i & -i) buckets ending at i. */
+    for (size_t i = (size_t) bucket + 1U; i <= quantile->_buckets; i += i & (~i + 1U)) {
+        quantile->_tree[i - 1U] += delta;
+    }
+}
+
+static size_t bp_quantile_find(bp_quantile_t *quantile, size_t rank)
+{
+    size_t pos  = 0;
+    size_t left = rank + 1U;
+
+    /* Find the largest prefix of buckets with less than 'rank + 1' samples. The bucket
+     * right after it has the sample. */
+    for (size_t step = quantile->_buckets; step > 0; step >>= 1) {
+        if (quantile->_tree[pos + step - 1U] < left) {
+            pos += step;
+            left -= quantile->_tree[pos - 1U];
+            if (pos == quantile->_buckets) {
+                break;
+            }
+        }
+    }
+
+    return pos < quantile->_buckets ? pos : quantile->_buckets - 1U;
+}
+
+#ifdef __cplusplus
+}
+#endif
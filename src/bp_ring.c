@@ -9,6 +9,7 @@
  *
  */
 #include "bp_ring.h"
+#include "bp_bits.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -40,6 +41,56 @@ extern "C" {
  */
 #define BP_RING_ADVANCE_TAIL(ring) BP_RING_ADVANCE_PTR(ring, _tail)
 
+/*!
+ * Macro to move back a ring buffer pointer. If the pointer is in the start of buffer, then
+ * its value will be the last position, otherwise it is decreased by 1.
+ * @param ring Reference to bp_ring.
+ * @param ptr Pointer name to be moved back.
+ * @return The previous value of the pointer
+ */
+#define BP_RING_RETREAT_PTR(ring, ptr) \
+    (((ring)->ptr == 0) ? ((ring)->_capacity - 1) : ((ring)->ptr - 1))
+
+/*!
+ * Move a position of the ring buffer by some elements. The positions wrap at the end of
+ * the buffer.
+ * @param ring Reference to bp_ring.
+ * @param pos The position.
+ * @param count Number of elements to move forward. It can't exceed the capacity.
+ * @return The moved position.
+ */
+static inline size_t bp_ring_forward(bp_ring_t *ring, size_t pos, size_t count);
+
+/*!
+ * Move a position of the ring buffer back by some elements. The positions wrap at the
+ * start of the buffer.
+ * @param ring Reference to bp_ring.
+ * @param pos The position.
+ * @param count Number of elements to move back. It can't exceed the capacity.
+ * @return The moved position.
+ */
+static inline size_t bp_ring_backward(bp_ring_t *ring, size_t pos, size_t count);
+
+/*!
+ * Copy a sequence of elements into the buffer, starting at a position. It takes at most
+ * two copies, one before and one after the end of the buffer.
+ * @param ring Reference to bp_ring.
+ * @param pos Position of the first element.
+ * @param els Reference to the elements.
+ * @param count Number of elements.
+ */
+static void bp_ring_copy_in(bp_ring_t *ring, size_t pos, const void *els, size_t count);
+
+/*!
+ * Copy a sequence of elements out of the buffer, starting at a position. It takes at most
+ * two copies, one before and one after the end of the buffer.
+ * @param ring Reference to bp_ring.
+ * @param pos Position of the first element.
+ * @param els [out] Reference to a buffer for the elements.
+ * @param count Number of elements.
+ */
+static void bp_ring_copy_out(bp_ring_t *ring, size_t pos, void *els, size_t count);
+
 /*!
  * Fallback function for compare elements. It's used when the user doesn't provide an
  * function for compare. This function will compare the two elements byte by bytes.
@@ -51,6 +102,19 @@ extern "C" {
  */
 static bool bp_ring_default_cmp(void *left, void *right, size_t el_size);
 
+/*!
+ * Fallback function for compare a block of elements. It's used when the user doesn't
+ * provide a block predicate. This function will compare each element with the parameter
+ * byte by byte.
+ * @param els Reference to the first element of the block.
+ * @param count Number of elements in the block.
+ * @param param Reference to the parameter used to compare elements.
+ * @param el_size Size of each element.
+ * @return A mask where the i-th bit is set if the i-th element is equal to the parameter.
+ */
+static uint64_t bp_ring_default_block_cmp(uint8_t *els, size_t count, void *param,
+                                          size_t el_size);
+
 /*!
  * Initialize iterator for bp_ring.
  * @param self Reference to the iterator itself.
@@ -156,6 +220,127 @@ int bp_ring_pop(bp_ring_t *ring, void *el)
     return 0;
 }
 
+int bp_ring_push_front(bp_ring_t *ring, void *el)
+{
+    if (ring == NULL || el == NULL) {
+        return -ENODEV;
+    }
+
+    if (ring->_size == ring->_capacity) {
+        return -ENOMEM;
+    }
+
+    ring->_tail = BP_RING_RETREAT_PTR(ring, _tail);
+    memcpy(&ring->_array[ring->_tail * ring->_element_size], el, ring->_element_size);
+    ring->_size += 1;
+
+    return 0;
+}
+
+void *bp_ring_peek_back(bp_ring_t *ring)
+{
+    if (ring == NULL) {
+        return NULL;
+    }
+
+    if (ring->_size == 0) {
+        return NULL;
+    }
+
+    return &ring->_array[BP_RING_RETREAT_PTR(ring, _head) * ring->_element_size];
+}
+
+int bp_ring_pop_back(bp_ring_t *ring, void *el)
+{
+    if (ring == NULL) {
+        return -ENODEV;
+    }
+
+    if (ring->_size == 0) {
+        return -ENOENT;
+    }
+
+    ring->_head = BP_RING_RETREAT_PTR(ring, _head);
+    if (el != NULL) {
+        memcpy(el, &ring->_array[ring->_head * ring->_element_size], ring->_element_size);
+    }
+    ring->_size -= 1;
+
+    return 0;
+}
+
+int bp_ring_push_back_n(bp_ring_t *ring, const void *els, size_t count)
+{
+    if (ring == NULL || els == NULL) {
+        return -ENODEV;
+    }
+
+    if (count > ring->_capacity - ring->_size) {
+        return -ENOMEM;
+    }
+
+    bp_ring_copy_in(ring, ring->_head, els, count);
+    ring->_head = bp_ring_forward(ring, ring->_head, count);
+    ring->_size += count;
+
+    return 0;
+}
+
+int bp_ring_push_front_n(bp_ring_t *ring, const void *els, size_t count)
+{
+    if (ring == NULL || els == NULL) {
+        return -ENODEV;
+    }
+
+    if (count > ring->_capacity - ring->_size) {
+        return -ENOMEM;
+    }
+
+    ring->_tail = bp_ring_backward(ring, ring->_tail, count);
+    bp_ring_copy_in(ring, ring->_tail, els, count);
+    ring->_size += count;
+
+    return 0;
+}
+
+int bp_ring_pop_front_n(bp_ring_t *ring, void *els, size_t count)
+{
+    if (ring == NULL) {
+        return -ENODEV;
+    }
+
+    if (count > ring->_size) {
+        return -ENOENT;
+    }
+
+    if (els != NULL) {
+        bp_ring_copy_out(ring, ring->_tail, els, count);
+    }
+    ring->_tail = bp_ring_forward(ring, ring->_tail, count);
+    ring->_size -= count;
+
+    return 0;
+}
+
+int bp_ring_pop_back_n(bp_ring_t *ring, void *els, size_t count)
+{
+    if (ring == NULL) {
+        return -ENODEV;
+    }
+
+    if (count > ring->_size) {
+        return -ENOENT;
+    }
+
+    ring->_head = bp_ring_backward(ring, ring->_head, count);
+    if (els != NULL) {
+        bp_ring_copy_out(ring, ring->_head, els, count);
+    }
+    ring->_size -= count;
+
+    return 0;
+}
+
 size_t bp_ring_find_idx(bp_ring_t *ring, void *param, bool (*cmp)(void *, void *))
 {
     if (ring == NULL || param == NULL) {
@@ -210,6 +395,47 @@ void *bp_ring_find(bp_ring_t *ring, void *param, bool (*cmp)(void *, void *))
     return NULL;
 }
 
+size_t bp_ring_find_block(bp_ring_t *ring, void *param, bp_block_cmp_t cmp)
+{
+    if (ring == NULL || param == NULL) {
+        return BP_RING_INVALID_INDEX;
+    }
+
+    uint64_t mask;
+    size_t count;
+    size_t idx = ring->_tail;
+    uint8_t *els;
+
+    for (size_t i = 0; i < ring->_size; i += count) {
+        count = ring->_size - i;
+        if (count > BP_BLOCK_SIZE) {
+            count = BP_BLOCK_SIZE;
+        }
+        /* The block must stop at the end of the buffer. */
+        if (count > ring->_capacity - idx) {
+            count = ring->_capacity - idx;
+        }
+
+        els = &ring->_array[idx * ring->_element_size];
+        if (cmp != NULL) {
+            mask = cmp(els, count, param) & bp_mask64((unsigned int) count);
+        } else {
+            mask = bp_ring_default_block_cmp(els, count, param, ring->_element_size);
+        }
+
+        if (mask != 0) {
+            return i + bp_ctz64(mask);
+        }
+
+        idx += count;
+        if (idx >= ring->_capacity) {
+            idx -= ring->_capacity;
+        }
+    }
+
+    return BP_RING_INVALID_INDEX;
+}
+
 int bp_ring_clear(bp_ring_t *ring)
 {
     if (ring == NULL) {
@@ -283,6 +509,46 @@ bp_iterator_t bp_ring_circular_iterator(bp_ring_t *ring)
     return iter;
 }
 
+static inline size_t bp_ring_forward(bp_ring_t *ring, size_t pos, size_t count)
+{
+    return (pos < ring->_capacity - count) ? (pos + count) : (pos + count - ring->_capacity);
+}
+
+static inline size_t bp_ring_backward(bp_ring_t *ring, size_t pos, size_t count)
+{
+    return (pos >= count) ? (pos - count) : (pos + ring->_capacity - count);
+}
+
+static void bp_ring_copy_in(bp_ring_t *ring, size_t pos, const void *els, size_t count)
+{
+    size_t first = ring->_capacity - pos;
+
+    if (first > count) {
+        first = count;
+    }
+
+    memcpy(&ring->_array[pos * ring->_element_size], els, first * ring->_element_size);
+    if (count > first) {
+        memcpy(ring->_array, (const uint8_t *) els + first * ring->_element_size,
+               (count - first) * ring->_element_size);
+    }
+}
+
+static void bp_ring_copy_out(bp_ring_t *ring, size_t pos, void *els, size_t count)
+{
+    size_t first = ring->_capacity - pos;
+
+    if (first > count) {
+        first = count;
+    }
+
+    memcpy(els, &ring->_array[pos * ring->_element_size], first * ring->_element_size);
+    if (count > first) {
+        memcpy((uint8_t *) els + first * ring->_element_size, ring->_array,
+               (count - first) * ring->_element_size);
+    }
+}
+
 static bool bp_ring_default_cmp(void *left, void *right, size_t el_size)
 {
     bool res;
@@ -301,6 +567,20 @@ static bool bp_ring_default_cmp(void *left, void *right, size_t el_size)
     return true;
 }
 
+static uint64_t bp_ring_default_block_cmp(uint8_t *els, size_t count, void *param,
+                                          size_t el_size)
+{
+    uint64_t mask = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        if (bp_ring_default_cmp(&els[i * el_size], param, el_size)) {
+            mask |= UINT64_C(1) << i;
+        }
+    }
+
+    return mask;
+}
+
 static void *bp_ring_iter_init(struct bp_iter *self)
 {
     bp_ring_t *ring = self->coll;
@@ -0,0 +1,218 @@
+/*!
+ * @file bp_slotmap.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Implement the slot map structure.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#include "bp_slotmap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Value of a link to no slot.
+ */
+#define BP_SLOTMAP_NONE 0U
+
+/*!
+ * Get a reference to an element of the dense array.
+ * @param map Reference to bp_slotmap.
+ * @param idx Index of the element.
+ * @return Reference to the element.
+ */
+static inline uint8_t *bp_slotmap_el(bp_slotmap_t *map, size_t idx);
+
+/*!
+ * Find the slot referred by a handle.
+ * @param map Reference to bp_slotmap.
+ * @param handle Handle of the element.
+ * @return Reference to the slot.
+ * @return NULL if the handle isn't valid.
+ */
+static inline bp_slotmap_slot_t *bp_slotmap_lookup(bp_slotmap_t *map,
+                                                   bp_slotmap_handle_t handle);
+
+/*!
+ * Build the handle of a slot, with its current generation.
+ * @param map Reference to bp_slotmap.
+ * @param slot Index of the slot.
+ * @return Handle of the slot.
+ */
+static inline bp_slotmap_handle_t bp_slotmap_handle(bp_slotmap_t *map, uint32_t slot);
+
+int bp_slotmap_insert(bp_slotmap_t *map, void *el, bp_slotmap_handle_t *handle)
+{
+    if (map == NULL) {
+        return -ENODEV;
+    }
+
+    if (el == NULL) {
+        return -EINVAL;
+    }
+
+    if (map->_dense._size >= map->_dense._capacity || map->_dense._capacity >= UINT32_MAX) {
+        return -ENOMEM;
+    }
+
+    uint32_t slot;
+
+    if (map->_free != BP_SLOTMAP_NONE) {
+        slot       = map->_free - 1U;
+        map->_free = map->_slots[slot].idx;
+    } else {
+        slot = (uint32_t) map->_used++;
+    }
+
+    map->_owners[map->_dense._size] = slot;
+    map->_slots[slot].idx           = (uint32_t) map->_dense._size;
+    map->_slots[slot].gen += 1;
+    bp_array_push(&map->_dense, el);
+
+    if (handle != NULL) {
+        *handle = bp_slotmap_handle(map, slot);
+    }
+
+    return 0;
+}
+
+void *bp_slotmap_get(bp_slotmap_t *map, bp_slotmap_handle_t handle)
+{
+    if (map == NULL) {
+        return NULL;
+    }
+
+    bp_slotmap_slot_t *slot = bp_slotmap_lookup(map, handle);
+
+    if (slot == NULL) {
+        return NULL;
+    }
+
+    return bp_slotmap_el(map, slot->idx);
+}
+
+bool bp_slotmap_contains(bp_slotmap_t *map, bp_slotmap_handle_t handle)
+{
+    if (map == NULL) {
+        return false;
+    }
+
+    return bp_slotmap_lookup(map, handle) != NULL;
+}
+
+int bp_slotmap_del(bp_slotmap_t *map, bp_slotmap_handle_t handle)
+{
+    if (map == NULL) {
+        return -ENODEV;
+    }
+
+    bp_slotmap_slot_t *slot = bp_slotmap_lookup(map, handle);
+
+    if (slot == NULL) {
+        return -ENOENT;
+    }
+
+    size_t el_size = map->_dense._element_size;
+    size_t last    = map->_dense._size - 1U;
+    uint32_t idx   = slot->idx;
+
+    /* Move the last element to the hole, and point its slot to the new place. */
+    if (idx != last) {
+        memcpy(bp_slotmap_el(map, idx), bp_slotmap_el(map, last), el_size);
+        map->_owners[idx]                  = map->_owners[last];
+        map->_slots[map->_owners[idx]].idx = idx;
+    }
+    memset(bp_slotmap_el(map, last), 0, el_size);
+    map->_dense._size = last;
+
+    slot->gen += 1;
+    slot->idx  = map->_free;
+    map->_free = (uint32_t) (slot - map->_slots) + 1U;
+
+    return 0;
+}
+
+bp_slotmap_handle_t bp_slotmap_handle_of(bp_slotmap_t *map, void *el)
+{
+    if (map == NULL || el == NULL) {
+        return BP_SLOTMAP_INVALID_HANDLE;
+    }
+
+    uint8_t *ptr   = el;
+    uint8_t *begin = map->_dense._array;
+    size_t el_size = map->_dense._element_size;
+
+    if (ptr < begin || ptr >= begin + map->_dense._size * el_size ||
+        (size_t) (ptr - begin) % el_size != 0) {
+        return BP_SLOTMAP_INVALID_HANDLE;
+    }
+
+    return bp_slotmap_handle(map, map->_owners[(size_t) (ptr - begin) / el_size]);
+}
+
+int bp_slotmap_clear(bp_slotmap_t *map)
+{
+    if (map == NULL) {
+        return -ENODEV;
+    }
+
+    /* The slots keep their generations, so the old handles stay invalid. */
+    for (size_t i = 0; i < map->_dense._size; ++i) {
+        uint32_t slot          = map->_owners[i];
+        map->_slots[slot].gen += 1;
+        map->_slots[slot].idx  = map->_free;
+        map->_free             = slot + 1U;
+    }
+
+    if (map->_dense._size > 0) {
+        memset(map->_dense._array, 0, map->_dense._size * map->_dense._element_size);
+    }
+    map->_dense._size = 0;
+
+    return 0;
+}
+
+size_t bp_slotmap_size(bp_slotmap_t *map)
+{
+    if (map == NULL) {
+        return 0;
+    }
+
+    return map->_dense._size;
+}
+
+bp_iter_t bp_slotmap_iter(bp_slotmap_t *map)
+{
+    return bp_array_iter(map == NULL ? NULL : &map->_dense);
+}
+
+static inline uint8_t *bp_slotmap_el(bp_slotmap_t *map, size_t idx)
+{
+    return &map->_dense._array[idx * map->_dense._element_size];
+}
+
+static inline bp_slotmap_slot_t *bp_slotmap_lookup(bp_slotmap_t *map,
+                                                   bp_slotmap_handle_t handle)
+{
+    uint32_t slot = (uint32_t) handle;
+    uint32_t gen  = (uint32_t) (handle >> 32);
+
+    if (slot >= map->_used || map->_slots[slot].gen != gen || (gen & 1U) == 0) {
+        return NULL;
+    }
+
+    return &map->_slots[slot];
+}
+
+static inline bp_slotmap_handle_t bp_slotmap_handle(bp_slotmap_t *map, uint32_t slot)
+{
+    return ((bp_slotmap_handle_t) map->_slots[slot].gen << 32) | slot;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,216 @@
+/*!
+ * @file bp_soa.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Implement the structure-of-arrays.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#include "bp_soa.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Get a reference to a field of a record, without checking the arguments.
+ * @param soa Reference to bp_soa.
+ * @param idx Index of the record.
+ * @param field Index of the field.
+ * @return Reference to the field.
+ */
+static inline uint8_t *bp_soa_field_at(bp_soa_t *soa, size_t idx, size_t field);
+
+int bp_soa_check(bp_soa_t *soa)
+{
+    if (soa == NULL) {
+        return -ENODEV;
+    }
+
+    for (size_t f = 0; f < soa->_nfields; ++f) {
+        if (soa->_fields[f].offset > soa->_record_size ||
+            soa->_fields[f].size > soa->_record_size - soa->_fields[f].offset) {
+            return -EINVAL;
+        }
+    }
+
+    return 0;
+}
+
+int bp_soa_push(bp_soa_t *soa, const void *record)
+{
+    if (soa == NULL) {
+        return -ENODEV;
+    }
+
+    if (record == NULL) {
+        return -EINVAL;
+    }
+
+    if (soa->_size >= soa->_capacity) {
+        return -ENOMEM;
+    }
+
+    const uint8_t *src = record;
+
+    for (size_t f = 0; f < soa->_nfields; ++f) {
+        memcpy(bp_soa_field_at(soa, soa->_size, f), src + soa->_fields[f].offset,
+               soa->_fields[f].size);
+    }
+    soa->_size += 1;
+
+    return 0;
+}
+
+int bp_soa_get(bp_soa_t *soa, size_t idx, void *record)
+{
+    if (soa == NULL) {
+        return -ENODEV;
+    }
+
+    if (record == NULL) {
+        return -EINVAL;
+    }
+
+    if (idx >= soa->_size) {
+        return -EFAULT;
+    }
+
+    uint8_t *dst = record;
+
+    for (size_t f = 0; f < soa->_nfields; ++f) {
+        memcpy(dst + soa->_fields[f].offset, bp_soa_field_at(soa, idx, f),
+               soa->_fields[f].size);
+    }
+
+    return 0;
+}
+
+void *bp_soa_get_field(bp_soa_t *soa, size_t idx, size_t field)
+{
+    if (soa == NULL || idx >= soa->_size || field >= soa->_nfields) {
+        return NULL;
+    }
+
+    return bp_soa_field_at(soa, idx, field);
+}
+
+int bp_soa_del(bp_soa_t *soa, size_t idx)
+{
+    if (soa == NULL) {
+        return -ENODEV;
+    }
+
+    if (idx >= soa->_size) {
+        return -EFAULT;
+    }
+
+    size_t tail = soa->_size - idx - 1;
+
+    for (size_t f = 0; f < soa->_nfields; ++f) {
+        size_t size  = soa->_fields[f].size;
+        uint8_t *pos = bp_soa_field_at(soa, idx, f);
+
+        memmove(pos, pos + size, tail * size);
+        memset(pos + tail * size, 0, size);
+    }
+    soa->_size -= 1;
+
+    return 0;
+}
+
+int bp_soa_column(bp_soa_t *soa, size_t field, bp_array_t *view)
+{
+    if (soa == NULL || view == NULL) {
+        return -ENODEV;
+    }
+
+    if (field >= soa->_nfields) {
+        return -EINVAL;
+    }
+
+    view->_element_size = soa->_fields[field].size;
+    view->_capacity     = soa->_capacity;
+    view->_size         = soa->_size;
+    view->_array        = soa->_columns[field];
+
+    return 0;
+}
+
+size_t bp_soa_find_idx(bp_soa_t *soa, size_t field, void *param,
+                       bool (*cmp)(void *el, void *param))
+{
+    bp_array_t view;
+
+    if (bp_soa_column(soa, field, &view) != 0) {
+        return BP_SOA_INVALID_INDEX;
+    }
+
+    return bp_array_find_idx(&view, param, cmp);
+}
+
+size_t bp_soa_find_block(bp_soa_t *soa, size_t field, void *param, bp_block_cmp_t cmp)
+{
+    bp_array_t view;
+
+    if (bp_soa_column(soa, field, &view) != 0) {
+        return BP_SOA_INVALID_INDEX;
+    }
+
+    return bp_array_find_block(&view, param, cmp);
+}
+
+int bp_soa_reduce(bp_soa_t *soa, size_t field, void *acc,
+                  void (*fn)(void *acc, void *el))
+{
+    if (soa == NULL) {
+        return -ENODEV;
+    }
+
+    if (field >= soa->_nfields || acc == NULL || fn == NULL) {
+        return -EINVAL;
+    }
+
+    size_t size  = soa->_fields[field].size;
+    uint8_t *col = soa->_columns[field];
+
+    for (size_t i = 0; i < soa->_size; ++i) {
+        fn(acc, col + i * size);
+    }
+
+    return 0;
+}
+
+int bp_soa_clear(bp_soa_t *soa)
+{
+    if (soa == NULL) {
+        return -ENODEV;
+    }
+
+    for (size_t f = 0; f < soa->_nfields; ++f) {
+        memset(soa->_columns[f], 0, soa->_size * soa->_fields[f].size);
+    }
+    soa->_size = 0;
+
+    return 0;
+}
+
+size_t bp_soa_size(bp_soa_t *soa)
+{
+    if (soa == NULL) {
+        return 0;
+    }
+
+    return soa->_size;
+}
+
+static inline uint8_t *bp_soa_field_at(bp_soa_t *soa, size_t idx, size_t field)
+{
+    return (uint8_t *) soa->_columns[field] + idx * soa->_fields[field].size;
+}
+
+#ifdef __cplusplus
+}
+#endif
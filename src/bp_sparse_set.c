@@ -0,0 +1,121 @@
+/*!
+ * @file bp_sparse_set.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Implement the sparse set structure.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#include "bp_sparse_set.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Get a reference to the dense array.
+ * @param set Reference to bp_sparse_set.
+ * @return Reference to the first member.
+ */
+static inline uint32_t *bp_sparse_set_dense(bp_sparse_set_t *set);
+
+int bp_sparse_set_add(bp_sparse_set_t *set, uint32_t id)
+{
+    if (set == NULL) {
+        return -ENODEV;
+    }
+
+    if (id >= set->_universe) {
+        return -EINVAL;
+    }
+
+    if (bp_sparse_set_contains(set, id)) {
+        return -EEXIST;
+    }
+
+    if (set->_dense._size >= set->_dense._capacity) {
+        return -ENOMEM;
+    }
+
+    set->_sparse[id] = (uint32_t) set->_dense._size;
+    bp_array_push(&set->_dense, &id);
+
+    return 0;
+}
+
+int bp_sparse_set_remove(bp_sparse_set_t *set, uint32_t id)
+{
+    if (set == NULL) {
+        return -ENODEV;
+    }
+
+    if (!bp_sparse_set_contains(set, id)) {
+        return -ENOENT;
+    }
+
+    uint32_t *dense = bp_sparse_set_dense(set);
+    uint32_t last   = dense[set->_dense._size - 1U];
+
+    dense[set->_sparse[id]] = last;
+    set->_sparse[last]      = set->_sparse[id];
+    set->_dense._size -= 1;
+
+    return 0;
+}
+
+bool bp_sparse_set_contains(bp_sparse_set_t *set, uint32_t id)
+{
+    if (set == NULL || id >= set->_universe) {
+        return false;
+    }
+
+    /* The sparse entry may be garbage: it's only trusted if the dense array agrees. */
+    uint32_t idx = set->_sparse[id];
+
+    return idx < set->_dense._size && bp_sparse_set_dense(set)[idx] == id;
+}
+
+int bp_sparse_set_clear(bp_sparse_set_t *set)
+{
+    if (set == NULL) {
+        return -ENODEV;
+    }
+
+    set->_dense._size = 0;
+
+    return 0;
+}
+
+size_t bp_sparse_set_size(bp_sparse_set_t *set)
+{
+    if (set == NULL) {
+        return 0;
+    }
+
+    return set->_dense._size;
+}
+
+const uint32_t *bp_sparse_set_data(bp_sparse_set_t *set)
+{
+    if (set == NULL) {
+        return NULL;
+    }
+
+    return bp_sparse_set_dense(set);
+}
+
+bp_iter_t bp_sparse_set_iter(bp_sparse_set_t *set)
+{
+    return bp_array_iter(set == NULL ? NULL : &set->_dense);
+}
+
+static inline uint32_t *bp_sparse_set_dense(bp_sparse_set_t *set)
+{
+    return (uint32_t *) set->_dense._array;
+}
+
+#ifdef __cplusplus
+}
+#endif
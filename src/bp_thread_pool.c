@@ -0,0 +1,183 @@
+/*!
+ * @file bp_thread_pool.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Implement the worker pool.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#define _GNU_SOURCE
+#include "bp_thread_pool.h"
+#include <unistd.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Main loop of a worker thread. The thread waits for a new job, runs it and goes back to
+ * wait, until the pool is stopped.
+ * @param arg Reference to the worker arguments.
+ * @return Always NULL.
+ */
+static void *bp_thread_pool_main(void *arg);
+
+/*!
+ * Wake up the threads and wait for them to exit.
+ * @param pool Reference to the pool.
+ * @param nthreads Number of threads already created.
+ */
+static void bp_thread_pool_stop(bp_thread_pool_t *pool, size_t nthreads);
+
+int bp_thread_pool_init(bp_thread_pool_t *pool, size_t nthreads)
+{
+    if (pool == NULL) {
+        return -ENODEV;
+    }
+
+    if (nthreads == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        nthreads    = (online > 0) ? (size_t) online : 1U;
+        if (nthreads > BP_THREAD_POOL_MAX_THREADS) {
+            nthreads = BP_THREAD_POOL_MAX_THREADS;
+        }
+    }
+
+    if (nthreads > BP_THREAD_POOL_MAX_THREADS) {
+        return -EINVAL;
+    }
+
+    int err;
+
+    pool->_size       = nthreads;
+    pool->_job        = NULL;
+    pool->_arg        = NULL;
+    pool->_generation = 0;
+    pool->_running    = 0;
+    pool->_stop       = false;
+
+    err = pthread_mutex_init(&pool->_lock, NULL);
+    if (err) {
+        return -err;
+    }
+    pthread_cond_init(&pool->_start, NULL);
+    pthread_cond_init(&pool->_done, NULL);
+
+    /* The worker 0 is the caller thread, so it doesn't need a thread. */
+    for (size_t i = 1; i < nthreads; ++i) {
+        pool->_workers[i]._pool = pool;
+        pool->_workers[i]._idx  = i;
+
+        err = pthread_create(&pool->_threads[i], NULL, bp_thread_pool_main,
+                             &pool->_workers[i]);
+        if (err) {
+            bp_thread_pool_stop(pool, i);
+            return -err;
+        }
+    }
+
+    return 0;
+}
+
+int bp_thread_pool_run(bp_thread_pool_t *pool, bp_thread_pool_job_t job, void *arg)
+{
+    if (pool == NULL || job == NULL) {
+        return -ENODEV;
+    }
+
+    pthread_mutex_lock(&pool->_lock);
+    pool->_job     = job;
+    pool->_arg     = arg;
+    pool->_running = pool->_size - 1U;
+    pool->_generation += 1;
+    pthread_cond_broadcast(&pool->_start);
+    pthread_mutex_unlock(&pool->_lock);
+
+    job(arg, 0, pool->_size);
+
+    pthread_mutex_lock(&pool->_lock);
+    while (pool->_running > 0) {
+        pthread_cond_wait(&pool->_done, &pool->_lock);
+    }
+    pool->_job = NULL;
+    pthread_mutex_unlock(&pool->_lock);
+
+    return 0;
+}
+
+size_t bp_thread_pool_size(bp_thread_pool_t *pool)
+{
+    if (pool == NULL) {
+        return 0;
+    }
+
+    return pool->_size;
+}
+
+int bp_thread_pool_deinit(bp_thread_pool_t *pool)
+{
+    if (pool == NULL) {
+        return -ENODEV;
+    }
+
+    bp_thread_pool_stop(pool, pool->_size);
+
+    return 0;
+}
+
+static void *bp_thread_pool_main(void *arg)
+{
+    bp_thread_pool_worker_t *worker = arg;
+    bp_thread_pool_t *pool          = worker->_pool;
+    size_t generation               = 0;
+    bp_thread_pool_job_t job;
+    void *job_arg;
+
+    for (;;) {
+        pthread_mutex_lock(&pool->_lock);
+        while (!pool->_stop && pool->_generation == generation) {
+            pthread_cond_wait(&pool->_start, &pool->_lock);
+        }
+        if (pool->_stop) {
+            pthread_mutex_unlock(&pool->_lock);
+            break;
+        }
+        generation = pool->_generation;
+        job        = pool->_job;
+        job_arg    = pool->_arg;
+        pthread_mutex_unlock(&pool->_lock);
+
+        job(job_arg, worker->_idx, pool->_size);
+
+        pthread_mutex_lock(&pool->_lock);
+        pool->_running -= 1;
+        if (pool->_running == 0) {
+            pthread_cond_signal(&pool->_done);
+        }
+        pthread_mutex_unlock(&pool->_lock);
+    }
+
+    return NULL;
+}
+
+static void bp_thread_pool_stop(bp_thread_pool_t *pool, size_t nthreads)
+{
+    pthread_mutex_lock(&pool->_lock);
+    pool->_stop = true;
+    pthread_cond_broadcast(&pool->_start);
+    pthread_mutex_unlock(&pool->_lock);
+
+    for (size_t i = 1; i < nthreads; ++i) {
+        pthread_join(pool->_threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&pool->_start);
+    pthread_cond_destroy(&pool->_done);
+    pthread_mutex_destroy(&pool->_lock);
+}
+
+#ifdef __cplusplus
+}
+#endif
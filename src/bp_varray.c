@@ -0,0 +1,179 @@
+/*!
+ * @file bp_varray.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Implement the variable-length array structure.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#include "bp_varray.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int bp_varray_push(bp_varray_t *varray, const void *data, size_t length)
+{
+    if (varray == NULL) {
+        return -ENODEV;
+    }
+
+    if (data == NULL && length > 0) {
+        return -EINVAL;
+    }
+
+    if (varray->_size >= varray->_capacity || length > varray->_heap_size - varray->_used) {
+        return -ENOMEM;
+    }
+
+    bp_varray_entry_t *entry = &varray->_entries[varray->_size];
+
+    entry->offset = (uint32_t) varray->_used;
+    entry->length = (uint32_t) length;
+    if (length > 0) {
+        memcpy(&varray->_heap[varray->_used], data, length);
+    }
+    varray->_used += length;
+    varray->_size += 1;
+
+    return 0;
+}
+
+int bp_varray_load(bp_varray_t *varray, const void *data, const uint32_t *lengths,
+                   size_t count)
+{
+    if (varray == NULL) {
+        return -ENODEV;
+    }
+
+    if (data == NULL || lengths == NULL) {
+        return -EINVAL;
+    }
+
+    if (count > varray->_capacity - varray->_size) {
+        return -ENOMEM;
+    }
+
+    size_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        total += lengths[i];
+    }
+
+    if (total > varray->_heap_size - varray->_used) {
+        return -ENOMEM;
+    }
+
+    /* The bytes are already back to back: a single copy, and a prefix sum for the table. */
+    bp_varray_entry_t *entries = &varray->_entries[varray->_size];
+    uint32_t offset            = (uint32_t) varray->_used;
+
+    for (size_t i = 0; i < count; ++i) {
+        entries[i].offset = offset;
+        entries[i].length = lengths[i];
+        offset += lengths[i];
+    }
+    if (total > 0) {
+        memcpy(&varray->_heap[varray->_used], data, total);
+    }
+    varray->_used += total;
+    varray->_size += count;
+
+    return 0;
+}
+
+void *bp_varray_get(bp_varray_t *varray, size_t idx, size_t *length)
+{
+    if (varray == NULL || idx >= varray->_size) {
+        return NULL;
+    }
+
+    bp_varray_entry_t *entry = &varray->_entries[idx];
+
+    if (length != NULL) {
+        *length = entry->length;
+    }
+
+    return &varray->_heap[entry->offset];
+}
+
+int bp_varray_del(bp_varray_t *varray, size_t idx)
+{
+    if (varray == NULL) {
+        return -ENODEV;
+    }
+
+    if (idx >= varray->_size) {
+        return -EINVAL;
+    }
+
+    varray->_garbage += varray->_entries[idx].length;
+    memmove(&varray->_entries[idx], &varray->_entries[idx + 1U],
+            (varray->_size - idx - 1U) * sizeof(bp_varray_entry_t));
+    varray->_size -= 1;
+
+    return 0;
+}
+
+int bp_varray_compact(bp_varray_t *varray)
+{
+    if (varray == NULL) {
+        return -ENODEV;
+    }
+
+    if (varray->_garbage == 0) {
+        return 0;
+    }
+
+    /* The offsets grow with the index, so each element only moves towards the start. */
+    uint32_t offset = 0;
+
+    for (size_t i = 0; i < varray->_size; ++i) {
+        bp_varray_entry_t *entry = &varray->_entries[i];
+        if (entry->offset != offset && entry->length > 0) {
+            memmove(&varray->_heap[offset], &varray->_heap[entry->offset], entry->length);
+        }
+        entry->offset = offset;
+        offset += entry->length;
+    }
+    varray->_used    = offset;
+    varray->_garbage = 0;
+
+    return 0;
+}
+
+int bp_varray_clear(bp_varray_t *varray)
+{
+    if (varray == NULL) {
+        return -ENODEV;
+    }
+
+    varray->_size    = 0;
+    varray->_used    = 0;
+    varray->_garbage = 0;
+
+    return 0;
+}
+
+size_t bp_varray_size(bp_varray_t *varray)
+{
+    if (varray == NULL) {
+        return 0;
+    }
+
+    return varray->_size;
+}
+
+size_t bp_varray_garbage(bp_varray_t *varray)
+{
+    if (varray == NULL) {
+        return 0;
+    }
+
+    return varray->_garbage;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,257 @@
+/*!
+ * @file bp_vec.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Implement the vector structure.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#include "bp_vec.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Check if the vector elements are in the inline buffer.
+ * @param vec Reference to bp_vec.
+ * @return true if the current buffer is the inline buffer, or if there is no buffer.
+ */
+static inline bool bp_vec_is_inline(bp_vec_t *vec);
+
+/*!
+ * Move the vector elements to a buffer with the given capacity.
+ * @param vec Reference to bp_vec.
+ * @param capacity Capacity of the new buffer. Must be at least the vector size.
+ * @return 0 on success.
+ * @return -ENOMEM if the vector doesn't have an allocator or the allocation failed.
+ */
+static int bp_vec_resize(bp_vec_t *vec, size_t capacity);
+
+int bp_vec_push(bp_vec_t *vec, void *el)
+{
+    if (vec == NULL || el == NULL) {
+        return -ENODEV;
+    }
+
+    bp_array_t *coll = &vec->_coll;
+
+    if (coll->_size >= coll->_capacity) {
+        uint8_t *ptr   = el;
+        size_t buf_len = coll->_size * coll->_element_size;
+        bool aliased   = coll->_array != NULL && ptr >= coll->_array
+                       && ptr < coll->_array + buf_len;
+        size_t offset  = aliased ? (size_t) (ptr - coll->_array) : 0;
+        size_t capacity = coll->_capacity * 2U;
+        int err;
+
+        if (capacity < BP_VEC_MIN_CAPACITY) {
+            capacity = BP_VEC_MIN_CAPACITY;
+        }
+        if (capacity <= coll->_capacity || capacity > SIZE_MAX / coll->_element_size) {
+            return -ENOMEM;
+        }
+
+        err = bp_vec_resize(vec, capacity);
+        if (err) {
+            return err;
+        }
+
+        /* The element was inside the old buffer, which was released. */
+        if (aliased) {
+            el = &coll->_array[offset];
+        }
+    }
+
+    return bp_array_push(coll, el);
+}
+
+void *bp_vec_get(bp_vec_t *vec, size_t idx)
+{
+    if (vec == NULL) {
+        return NULL;
+    }
+
+    return bp_array_get(&vec->_coll, idx);
+}
+
+void *bp_vec_last(bp_vec_t *vec)
+{
+    if (vec == NULL) {
+        return NULL;
+    }
+
+    return bp_array_last(&vec->_coll);
+}
+
+int bp_vec_del(bp_vec_t *vec, size_t idx)
+{
+    if (vec == NULL) {
+        return -ENODEV;
+    }
+
+    return bp_array_del(&vec->_coll, idx);
+}
+
+size_t bp_vec_find_idx(bp_vec_t *vec, void *param, bool (*cmp)(void *, void *))
+{
+    if (vec == NULL) {
+        return BP_ARRAY_INVALID_INDEX;
+    }
+
+    return bp_array_find_idx(&vec->_coll, param, cmp);
+}
+
+void *bp_vec_find(bp_vec_t *vec, void *param, bool (*cmp)(void *, void *))
+{
+    if (vec == NULL) {
+        return NULL;
+    }
+
+    return bp_array_find(&vec->_coll, param, cmp);
+}
+
+int bp_vec_clear(bp_vec_t *vec)
+{
+    if (vec == NULL) {
+        return -ENODEV;
+    }
+
+    return bp_array_clear(&vec->_coll);
+}
+
+size_t bp_vec_size(bp_vec_t *vec)
+{
+    if (vec == NULL) {
+        return 0;
+    }
+
+    return vec->_coll._size;
+}
+
+size_t bp_vec_capacity(bp_vec_t *vec)
+{
+    if (vec == NULL) {
+        return 0;
+    }
+
+    return vec->_coll._capacity;
+}
+
+int bp_vec_reserve(bp_vec_t *vec, size_t capacity)
+{
+    if (vec == NULL) {
+        return -ENODEV;
+    }
+
+    if (capacity <= vec->_coll._capacity) {
+        return 0;
+    }
+
+    if (capacity > SIZE_MAX / vec->_coll._element_size) {
+        return -ENOMEM;
+    }
+
+    return bp_vec_resize(vec, capacity);
+}
+
+int bp_vec_shrink_to_fit(bp_vec_t *vec)
+{
+    if (vec == NULL) {
+        return -ENODEV;
+    }
+
+    if (bp_vec_is_inline(vec) || vec->_coll._size == vec->_coll._capacity) {
+        return 0;
+    }
+
+    return bp_vec_resize(vec, vec->_coll._size);
+}
+
+int bp_vec_deinit(bp_vec_t *vec)
+{
+    if (vec == NULL) {
+        return -ENODEV;
+    }
+
+    bp_array_t *coll = &vec->_coll;
+
+    if (!bp_vec_is_inline(vec) && vec->_allocator->free != NULL) {
+        vec->_allocator->free(vec->_allocator->ctx, coll->_array,
+                              coll->_capacity * coll->_element_size);
+    }
+
+    coll->_array    = vec->_inline;
+    coll->_capacity = vec->_inline_capacity;
+    coll->_size     = 0;
+
+    return 0;
+}
+
+bp_iter_t bp_vec_iter(bp_vec_t *vec)
+{
+    return bp_array_iter(&vec->_coll);
+}
+
+static inline bool bp_vec_is_inline(bp_vec_t *vec)
+{
+    return vec->_coll._array == NULL || vec->_coll._array == vec->_inline;
+}
+
+static int bp_vec_resize(bp_vec_t *vec, size_t capacity)
+{
+    bp_array_t *coll             = &vec->_coll;
+    const bp_allocator_t *alloc = vec->_allocator;
+    size_t el_size              = coll->_element_size;
+    uint8_t *buffer;
+
+    /* The elements fit in the inline buffer, so the allocated buffer isn't needed. */
+    if (capacity <= vec->_inline_capacity) {
+        if (!bp_vec_is_inline(vec)) {
+            if (coll->_size > 0) {
+                memcpy(vec->_inline, coll->_array, coll->_size * el_size);
+            }
+            if (alloc->free != NULL) {
+                alloc->free(alloc->ctx, coll->_array, coll->_capacity * el_size);
+            }
+            coll->_array    = vec->_inline;
+            coll->_capacity = vec->_inline_capacity;
+        }
+        return 0;
+    }
+
+    if (alloc == NULL || alloc->alloc == NULL) {
+        return -ENOMEM;
+    }
+
+    if (!bp_vec_is_inline(vec) && alloc->realloc != NULL) {
+        buffer = alloc->realloc(alloc->ctx, coll->_array, coll->_capacity * el_size,
+                                capacity * el_size);
+        if (buffer == NULL) {
+            return -ENOMEM;
+        }
+    } else {
+        buffer = alloc->alloc(alloc->ctx, capacity * el_size);
+        if (buffer == NULL) {
+            return -ENOMEM;
+        }
+
+        if (coll->_size > 0) {
+            memcpy(buffer, coll->_array, coll->_size * el_size);
+        }
+        if (!bp_vec_is_inline(vec) && alloc->free != NULL) {
+            alloc->free(alloc->ctx, coll->_array, coll->_capacity * el_size);
+        }
+    }
+
+    coll->_array    = buffer;
+    coll->_capacity = capacity;
+
+    return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
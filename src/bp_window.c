@@ -0,0 +1,196 @@
+/*!
+ * @file bp_window.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Implement the sliding window aggregator.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#include <math.h>
+
+#include "bp_window.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Remove the oldest sample from the aggregates. The window must not be empty.
+ * @param window Reference to bp_window.
+ */
+static void bp_window_evict(bp_window_t *window);
+
+/*!
+ * Recompute the sum, the mean and the squared deviations from the samples in the window.
+ * @param window Reference to bp_window.
+ */
+static void bp_window_rebuild(bp_window_t *window);
+
+/*!
+ * Fraction of the squared deviations an eviction may cancel before the aggregates are
+ * recomputed (2^-20). Past it, the rounding error left is larger than what remains.
+ */
+#define BP_WINDOW_CANCEL (1.0 / 1048576.0)
+
+int bp_window_push(bp_window_t *window, double value)
+{
+    if (window == NULL) {
+        return -ENODEV;
+    }
+
+    if (!isfinite(value)) {
+        return -EINVAL;
+    }
+
+    if (window->_samples._size == window->_samples._capacity) {
+        bp_window_evict(window);
+    }
+
+    size_t count = window->_samples._size + 1U;
+    double delta = value - window->_mean;
+
+    bp_ring_push(&window->_samples, &value);
+    window->_sum += value;
+    window->_mean += delta / (double) count;
+    window->_m2 += delta * (value - window->_mean);
+
+    /* A candidate that is older and not better than the new sample can never be the
+     * minimum (or maximum) again, so it leaves the deque. */
+    bp_window_entry_t entry = {.value = value, .seq = window->_seq++};
+    bp_window_entry_t *back;
+
+    while ((back = bp_ring_peek_back(&window->_mins)) != NULL && back->value >= value) {
+        bp_ring_pop_back(&window->_mins, NULL);
+    }
+    bp_ring_push(&window->_mins, &entry);
+
+    while ((back = bp_ring_peek_back(&window->_maxs)) != NULL && back->value <= value) {
+        bp_ring_pop_back(&window->_maxs, NULL);
+    }
+    bp_ring_push(&window->_maxs, &entry);
+
+    return 0;
+}
+
+int bp_window_stats(bp_window_t *window, bp_window_stats_t *stats)
+{
+    if (window == NULL) {
+        return -ENODEV;
+    }
+
+    if (stats == NULL) {
+        return -EINVAL;
+    }
+
+    if (window->_samples._size == 0) {
+        return -ENOENT;
+    }
+
+    stats->count    = window->_samples._size;
+    stats->sum      = window->_sum;
+    stats->mean     = window->_mean;
+    stats->variance = window->_m2 > 0.0 ? window->_m2 / (double) stats->count : 0.0;
+    stats->min      = ((bp_window_entry_t *) bp_ring_peek(&window->_mins))->value;
+    stats->max      = ((bp_window_entry_t *) bp_ring_peek(&window->_maxs))->value;
+
+    return 0;
+}
+
+bp_ring_t *bp_window_samples(bp_window_t *window)
+{
+    if (window == NULL) {
+        return NULL;
+    }
+
+    return &window->_samples;
+}
+
+int bp_window_clear(bp_window_t *window)
+{
+    if (window == NULL) {
+        return -ENODEV;
+    }
+
+    bp_ring_clear(&window->_samples);
+    bp_ring_clear(&window->_mins);
+    bp_ring_clear(&window->_maxs);
+    window->_evictions = 0;
+    window->_sum       = 0.0;
+    window->_mean      = 0.0;
+    window->_m2        = 0.0;
+
+    return 0;
+}
+
+size_t bp_window_size(bp_window_t *window)
+{
+    if (window == NULL) {
+        return 0;
+    }
+
+    return bp_ring_size(&window->_samples);
+}
+
+static void bp_window_evict(bp_window_t *window)
+{
+    uint64_t seq = window->_seq - window->_samples._size;
+    size_t count = window->_samples._size - 1U;
+    double value;
+    bp_window_entry_t *front;
+
+    bp_ring_pop(&window->_samples, &value);
+
+    if (++window->_evictions >= window->_samples._capacity) {
+        bp_window_rebuild(window);
+    } else {
+        double m2    = window->_m2;
+        double delta = value - window->_mean;
+        window->_sum -= value;
+        window->_mean -= delta / (double) count;
+        window->_m2 -= delta * (value - window->_mean);
+
+        /* Also true if the downdate went negative or NaN. */
+        if (!(window->_m2 >= m2 * BP_WINDOW_CANCEL)) {
+            bp_window_rebuild(window);
+        }
+    }
+
+    /* The oldest sample is at the front of a deque only if it's still a candidate. */
+    front = bp_ring_peek(&window->_mins);
+    if (front != NULL && front->seq == seq) {
+        bp_ring_pop(&window->_mins, NULL);
+    }
+    front = bp_ring_peek(&window->_maxs);
+    if (front != NULL && front->seq == seq) {
+        bp_ring_pop(&window->_maxs, NULL);
+    }
+}
+
+static void bp_window_rebuild(bp_window_t *window)
+{
+    size_t count = window->_samples._size;
+    double sum   = 0.0;
+    double m2    = 0.0;
+
+    for (size_t i = 0; i < count; ++i) {
+        sum += *(double *) bp_ring_get(&window->_samples, i);
+    }
+
+    double mean = count > 0 ? sum / (double) count : 0.0;
+
+    for (size_t i = 0; i < count; ++i) {
+        double delta = *(double *) bp_ring_get(&window->_samples, i) - mean;
+        m2 += delta * delta;
+    }
+
+    window->_evictions = 0;
+    window->_sum       = sum;
+    window->_mean      = mean;
+    window->_m2        = m2;
+}
+
+#ifdef __cplusplus
+}
+#endif
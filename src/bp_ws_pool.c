@@ -0,0 +1,183 @@
+/*!
+ * @file bp_ws_pool.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Implement the work-stealing pool.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#include "bp_ws_pool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Job of the thread pool. The worker 0 runs the root task, and the others look for tasks
+ * until it returns.
+ * @param arg Reference to bp_ws_pool.
+ * @param worker Index of the worker.
+ * @param nworkers Number of workers.
+ */
+static void bp_ws_pool_job(void *arg, size_t worker, size_t nworkers);
+
+/*!
+ * Run a task and mark it as finished in its group.
+ * @param worker Reference to the worker running the task.
+ * @param task Reference to the task.
+ */
+static void bp_ws_execute(bp_ws_worker_t *worker, bp_ws_task_t *task);
+
+/*!
+ * Find a task and run it. The worker first pops its own newest task, and then tries to
+ * steal from the other workers, starting at a random one.
+ * @param worker Reference to the worker.
+ * @return true if a task was run, false if no task was found.
+ */
+static bool bp_ws_help(bp_ws_worker_t *worker);
+
+int bp_ws_pool_init(bp_ws_pool_t *ws, bp_thread_pool_t *pool)
+{
+    if (ws == NULL || pool == NULL) {
+        return -ENODEV;
+    }
+
+    ws->_threads  = pool;
+    ws->_root     = NULL;
+    ws->_root_arg = NULL;
+    ws->_done     = false;
+
+    for (size_t i = 0; i < BP_THREAD_POOL_MAX_THREADS; ++i) {
+        bp_ws_worker_t *worker = &ws->_workers[i];
+        bp_wsdeque_t deque     = BP_WSDEQUE_INIT(worker->_tasks);
+
+        worker->_deque = deque;
+        worker->_pool  = ws;
+        worker->_idx   = i;
+        worker->_seed  = (uint64_t) i * 0x9E3779B97F4A7C15U + 1U;
+    }
+
+    return 0;
+}
+
+int bp_ws_pool_run(bp_ws_pool_t *ws, bp_ws_task_fn_t fn, void *arg)
+{
+    if (ws == NULL || fn == NULL) {
+        return -ENODEV;
+    }
+
+    ws->_root     = fn;
+    ws->_root_arg = arg;
+    __atomic_store_n(&ws->_done, false, __ATOMIC_RELAXED);
+
+    return bp_thread_pool_run(ws->_threads, bp_ws_pool_job, ws);
+}
+
+int bp_ws_spawn(bp_ws_worker_t *worker, bp_ws_group_t *group, bp_ws_task_t *task)
+{
+    if (worker == NULL || group == NULL || task == NULL) {
+        return -ENODEV;
+    }
+
+    if (task->fn == NULL) {
+        return -EINVAL;
+    }
+
+    task->_group = group;
+    __atomic_fetch_add(&group->_pending, 1U, __ATOMIC_RELAXED);
+
+    if (bp_wsdeque_push(&worker->_deque, task) != 0) {
+        bp_ws_execute(worker, task);
+    }
+
+    return 0;
+}
+
+int bp_ws_wait(bp_ws_worker_t *worker, bp_ws_group_t *group)
+{
+    if (worker == NULL || group == NULL) {
+        return -ENODEV;
+    }
+
+    while (__atomic_load_n(&group->_pending, __ATOMIC_ACQUIRE) != 0) {
+        if (!bp_ws_help(worker)) {
+            bp_cpu_relax();
+        }
+    }
+
+    return 0;
+}
+
+size_t bp_ws_worker_index(bp_ws_worker_t *worker)
+{
+    if (worker == NULL) {
+        return 0;
+    }
+
+    return worker->_idx;
+}
+
+static void bp_ws_pool_job(void *arg, size_t worker, size_t nworkers)
+{
+    bp_ws_pool_t *ws = arg;
+
+    (void) nworkers;
+
+    if (worker == 0) {
+        ws->_root(&ws->_workers[0], ws->_root_arg);
+        __atomic_store_n(&ws->_done, true, __ATOMIC_RELEASE);
+        return;
+    }
+
+    while (!__atomic_load_n(&ws->_done, __ATOMIC_ACQUIRE)) {
+        if (!bp_ws_help(&ws->_workers[worker])) {
+            bp_cpu_relax();
+        }
+    }
+}
+
+static void bp_ws_execute(bp_ws_worker_t *worker, bp_ws_task_t *task)
+{
+    /* The task can be released as soon as its group is done, so the group is read
+     * before the task runs. */
+    bp_ws_group_t *group = task->_group;
+
+    task->fn(worker, task->arg);
+    __atomic_fetch_sub(&group->_pending, 1U, __ATOMIC_RELEASE);
+}
+
+static bool bp_ws_help(bp_ws_worker_t *worker)
+{
+    bp_ws_pool_t *ws = worker->_pool;
+    size_t nworkers  = bp_thread_pool_size(ws->_threads);
+    void *task       = NULL;
+
+    if (bp_wsdeque_pop(&worker->_deque, &task) == 0) {
+        bp_ws_execute(worker, task);
+        return true;
+    }
+
+    /* xorshift64, so each worker starts the search at a different victim. */
+    worker->_seed ^= worker->_seed << 13;
+    worker->_seed ^= worker->_seed >> 7;
+    worker->_seed ^= worker->_seed << 17;
+
+    size_t victim = (size_t) (worker->_seed % nworkers);
+
+    for (size_t i = 0; i < nworkers; ++i) {
+        if (victim != worker->_idx &&
+            bp_wsdeque_steal(&ws->_workers[victim]._deque, &task) == 0) {
+            bp_ws_execute(worker, task);
+            return true;
+        }
+        victim = (victim + 1U == nworkers) ? 0U : (victim + 1U);
+    }
+
+    return false;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,121 @@
+/*!
+ * @file bp_wsdeque.c
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Implement the work-stealing deque.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#include "bp_wsdeque.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Get the slot of a position in the buffer.
+ * @param deque Reference to bp_wsdeque.
+ * @param pos The position.
+ */
+#define BP_WSDEQUE_SLOT(deque, pos) (&(deque)->_buffer[(size_t) (pos) & (deque)->_mask])
+
+int bp_wsdeque_push(bp_wsdeque_t *deque, void *task)
+{
+    if (deque == NULL) {
+        return -ENODEV;
+    }
+
+    if ((deque->_mask & (deque->_mask + 1U)) != 0) {
+        return -EINVAL;
+    }
+
+    int64_t bottom = __atomic_load_n(&deque->_bottom, __ATOMIC_RELAXED);
+    int64_t top    = __atomic_load_n(&deque->_top, __ATOMIC_ACQUIRE);
+
+    /* The slot of 'bottom' can only be reused after the thieves moved past it. */
+    if ((size_t) (bottom - top) > deque->_mask) {
+        return -ENOMEM;
+    }
+
+    __atomic_store_n(BP_WSDEQUE_SLOT(deque, bottom), task, __ATOMIC_RELAXED);
+    __atomic_store_n(&deque->_bottom, bottom + 1, __ATOMIC_RELEASE);
+
+    return 0;
+}
+
+int bp_wsdeque_pop(bp_wsdeque_t *deque, void **task)
+{
+    if (deque == NULL || task == NULL) {
+        return -ENODEV;
+    }
+
+    int64_t bottom = __atomic_load_n(&deque->_bottom, __ATOMIC_RELAXED) - 1;
+
+    /* Claim the bottom task before looking at the top. The full fence orders the store
+     * with the load, so a thief and the owner never both miss each other's claim. */
+    __atomic_store_n(&deque->_bottom, bottom, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int64_t top = __atomic_load_n(&deque->_top, __ATOMIC_RELAXED);
+
+    if (top > bottom) {
+        __atomic_store_n(&deque->_bottom, bottom + 1, __ATOMIC_RELAXED);
+        return -ENOENT;
+    }
+
+    *task = __atomic_load_n(BP_WSDEQUE_SLOT(deque, bottom), __ATOMIC_RELAXED);
+    if (top < bottom) {
+        return 0;
+    }
+
+    /* It's the last task, so the owner races the thieves for it, as a thief would. */
+    bool won = __atomic_compare_exchange_n(&deque->_top, &top, top + 1, false,
+                                           __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+    __atomic_store_n(&deque->_bottom, bottom + 1, __ATOMIC_RELAXED);
+
+    return won ? 0 : -ENOENT;
+}
+
+int bp_wsdeque_steal(bp_wsdeque_t *deque, void **task)
+{
+    if (deque == NULL || task == NULL) {
+        return -ENODEV;
+    }
+
+    int64_t top = __atomic_load_n(&deque->_top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int64_t bottom = __atomic_load_n(&deque->_bottom, __ATOMIC_ACQUIRE);
+
+    if (top >= bottom) {
+        return -ENOENT;
+    }
+
+    /* The slot is read before the claim. If the owner reused it meanwhile, the top has
+     * moved and the claim fails. */
+    void *stolen = __atomic_load_n(BP_WSDEQUE_SLOT(deque, top), __ATOMIC_RELAXED);
+    if (!__atomic_compare_exchange_n(&deque->_top, &top, top + 1, false, __ATOMIC_SEQ_CST,
+                                     __ATOMIC_RELAXED)) {
+        return -EAGAIN;
+    }
+
+    *task = stolen;
+
+    return 0;
+}
+
+size_t bp_wsdeque_size(bp_wsdeque_t *deque)
+{
+    if (deque == NULL) {
+        return 0;
+    }
+
+    int64_t top    = __atomic_load_n(&deque->_top, __ATOMIC_ACQUIRE);
+    int64_t bottom = __atomic_load_n(&deque->_bottom, __ATOMIC_ACQUIRE);
+
+    return (bottom > top) ? (size_t) (bottom - top) : 0U;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,52 @@
+/*!
+ * @file bp_alloc.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies the allocator interface. The structures that could grow receive an
+ * allocator, instead of calling malloc directly, so the user decides where the memory
+ * comes from. Without an allocator, these structures work only over static buffers.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_ALLOC_H
+#define BACKPACK_ALLOC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+/*!
+ * Struct with the allocator functions.
+ *
+ * @note The functions receive the size of the blocks, so allocators that don't keep
+ * metadata about the blocks (like arenas and pools) could implement them.
+ */
+typedef struct bp_allocator {
+    void *(*alloc)(void *ctx, size_t size); /*!< Allocate a block. Return NULL on failure. */
+    void *(*realloc)(void *ctx, void *ptr, size_t old_size,
+                     size_t new_size); /*!< Resize a block, keeping its content. Return
+                                          NULL on failure, without freeing the block. It
+                                          could be NULL, so the block is moved with
+                                          alloc, memcpy and free. */
+    void (*free)(void *ctx, void *ptr,
+                 size_t size); /*!< Free a block. It could be NULL, if the memory is
+                                  released in another way. */
+    void *ctx;                 /*!< Context passed to each function. */
+} bp_allocator_t;
+
+/*!
+ * Allocator based on the malloc, realloc and free functions of the C library. It's
+ * defined in its own translation unit, so only the programs that use it depend on the C
+ * library allocator.
+ */
+extern const bp_allocator_t bp_libc_allocator;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_ALLOC_H
@@ -0,0 +1,170 @@
+/*!
+ * @file bp_arena.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies the arena structure. The arena is a bump-pointer allocator over a
+ * single buffer: each allocation only advances an offset, and all the allocations are
+ * released at once, resetting the offset to a previous mark. It's used to carve the
+ * buffers of short-lived structures.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_ARENA_H
+#define BACKPACK_ARENA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bp_alloc.h"
+#include "bp_array.h"
+#include "bp_ring.h"
+#include "bp_stack.h"
+
+/*!
+ * Default alignment of the arena allocations.
+ */
+#define BP_ARENA_ALIGN 16U
+
+/*!
+ * Size of a huge page. Arenas mapped with at least this size try to use huge pages.
+ */
+#define BP_ARENA_HUGE_PAGE_SIZE (2U * 1024U * 1024U)
+
+/*!
+ * Macro to initialize a bp_arena over a static buffer.
+ * @param buffer_ Buffer where the allocations will be done.
+ */
+#define BP_ARENA_INIT(buffer_)                                                  \
+    {                                                                           \
+        ._buffer = (uint8_t *) (buffer_), ._capacity = sizeof(buffer_),         \
+        ._offset = 0, ._mapped = 0,                                             \
+    }
+
+/*!
+ * Struct with metadata about the arena.
+ */
+typedef struct {
+    uint8_t *_buffer; /*!< Reference to the buffer, where the allocations are done. */
+    size_t _capacity; /*!< Size (in bytes) of the buffer. */
+    size_t _offset;   /*!< Offset of the first free byte. */
+    size_t _mapped;   /*!< Size of the mapped region, or zero for a user buffer. */
+} bp_arena_t;
+
+/*!
+ * Allocate a block from the arena.
+ * @param arena Reference to bp_arena.
+ * @param size Size (in bytes) of the block.
+ * @param align Alignment of the block. Must be a power of two.
+ * @return A reference to the block.
+ * @return NULL if the 'arena' argument is NULL, if the alignment isn't a power of two or
+ * if the arena doesn't have enough space.
+ */
+void *bp_arena_alloc(bp_arena_t *arena, size_t size, size_t align);
+
+/*!
+ * Get a mark of the arena current state, to release all the blocks allocated after it
+ * with bp_arena_reset.
+ * @param arena Reference to bp_arena.
+ * @return The mark.
+ * @return 0 if the 'arena' argument is NULL.
+ */
+size_t bp_arena_mark(bp_arena_t *arena);
+
+/*!
+ * Release all the blocks allocated after a mark.
+ * @param arena Reference to bp_arena.
+ * @param mark Mark returned by bp_arena_mark. Use 0 to release all blocks.
+ * @return 0 on success.
+ * @return -ENODEV if the 'arena' argument is NULL.
+ * @return -EINVAL if the mark is after the current state of the arena.
+ */
+int bp_arena_reset(bp_arena_t *arena, size_t mark);
+
+/*!
+ * Get the number of bytes in use in the arena, including the alignment padding.
+ * @param arena Reference to bp_arena.
+ * @return The number of bytes in use.
+ * @return 0 if the 'arena' argument is NULL.
+ */
+size_t bp_arena_used(bp_arena_t *arena);
+
+/*!
+ * Initialize an arena over memory mapped from the operating system. If the size is at
+ * least BP_ARENA_HUGE_PAGE_SIZE, the arena tries to use huge pages: first with an
+ * explicit huge page mapping (MAP_HUGETLB), and then asking for transparent huge pages
+ * (madvise). The arena must be zeroed or initialized with BP_ARENA_INIT.
+ * @param arena Reference to bp_arena.
+ * @param size Size (in bytes) of the arena.
+ * @return 0 on success.
+ * @return -ENODEV if the 'arena' argument is NULL.
+ * @return -EBUSY if the arena is already mapped. It must be unmapped first.
+ * @return -ENOMEM if the memory could not be mapped.
+ * @return -ENOTSUP if the platform doesn't support memory mapping.
+ */
+int bp_arena_map(bp_arena_t *arena, size_t size);
+
+/*!
+ * Release the memory mapped by bp_arena_map.
+ * @param arena Reference to bp_arena.
+ * @return 0 on success.
+ * @return -ENODEV if the 'arena' argument is NULL.
+ * @return -EINVAL if the arena memory wasn't mapped by bp_arena_map.
+ */
+int bp_arena_unmap(bp_arena_t *arena);
+
+/*!
+ * Get an allocator that takes its blocks from the arena. The allocator resizes the last
+ * block in place and releases only the last block, so it works well for a single
+ * growing bp_vec.
+ * @param arena Reference to bp_arena.
+ * @return The allocator.
+ */
+bp_allocator_t bp_arena_allocator(bp_arena_t *arena);
+
+/*!
+ * Initialize an empty array over a buffer allocated from the arena.
+ * @param arena Reference to bp_arena.
+ * @param array [out] Reference to the array.
+ * @param element_size Size (in bytes) of a single element.
+ * @param capacity Maximum number of elements in the array.
+ * @return 0 on success.
+ * @return -ENODEV if the 'arena' or the 'array' argument is NULL.
+ * @return -ENOMEM if the arena doesn't have enough space.
+ */
+int bp_arena_array_init(bp_arena_t *arena, bp_array_t *array, size_t element_size,
+                        size_t capacity);
+
+/*!
+ * Initialize an empty stack over a buffer allocated from the arena.
+ * @param arena Reference to bp_arena.
+ * @param stack [out] Reference to the stack.
+ * @param element_size Size (in bytes) of a single element.
+ * @param capacity Maximum number of elements in the stack.
+ * @return 0 on success.
+ * @return -ENODEV if the 'arena' or the 'stack' argument is NULL.
+ * @return -ENOMEM if the arena doesn't have enough space.
+ */
+int bp_arena_stack_init(bp_arena_t *arena, bp_stack_t *stack, size_t element_size,
+                        size_t capacity);
+
+/*!
+ * Initialize an empty ring buffer over a buffer allocated from the arena.
+ * @param arena Reference to bp_arena.
+ * @param ring [out] Reference to the ring buffer.
+ * @param element_size Size (in bytes) of a single element.
+ * @param capacity Maximum number of elements in the ring buffer.
+ * @return 0 on success.
+ * @return -ENODEV if the 'arena' or the 'ring' argument is NULL.
+ * @return -ENOMEM if the arena doesn't have enough space.
+ */
+int bp_arena_ring_init(bp_arena_t *arena, bp_ring_t *ring, size_t element_size,
+                       size_t capacity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_ARENA_H
@@ -20,6 +20,7 @@ extern "C" {
 #include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
+#include "bp_block.h"
 #include "bp_iter.h"
 
 /*!
@@ -27,6 +28,11 @@ extern "C" {
  */
 #define BP_ARRAY_INVALID_INDEX 0xffFFffFF
 
+/*!
+ * Maximum number of keys resolved by each pass of bp_array_find_many.
+ */
+#define BP_ARRAY_FIND_MANY_BATCH 256U
+
 /*!
  * Macro to initialize a bp_array.
  * @param array_ buffer where the elements will be stored.
@@ -62,6 +68,13 @@ typedef struct {
     uint8_t *_array; /*!< Reference to the buffer, where the elements will be stored. */
 } bp_array_t;
 
+/*!
+ * Type for array compare function. The return must be 0 for equals values, less than 0 if
+ * the left is less than the right, and greater than 0 if the left is greater than the
+ * right.
+ */
+typedef int (*bp_array_cmp_t)(void *left, void *right);
+
 /*!
  * Push an element at the end of array.
  * @param array Reference to bp_array.
@@ -127,6 +140,110 @@ size_t bp_array_find_idx(bp_array_t *array, void *param,
  */
 void *bp_array_find(bp_array_t *array, void *param, bool (*cmp)(void *el, void *param));
 
+/*!
+ * Find the index of an element, using a block predicate. Instead of calling the compare
+ * function for each element, the cmp function receives up to BP_BLOCK_SIZE contiguous
+ * elements and returns a mask with the matches. If the cmp function pointer argument is
+ * null, then the elements will be compared with the parameter byte by byte.
+ * @param array Reference to bp_array.
+ * @param param Reference to the parameter used to compare elements.
+ * @param cmp Function to compare a block of elements with the parameter passed at
+ * argument param.
+ * @return The index of the first found element.
+ * @return BP_ARRAY_INVALID_INDEX if the element wasn't found or if the 'array' or the
+ * 'param' argument is NULL.
+ */
+size_t bp_array_find_block(bp_array_t *array, void *param, bp_block_cmp_t cmp);
+
+/*!
+ * Find the index of many keys in a single pass over the array. The keys are stored
+ * back-to-back in the 'keys' buffer, each one with 'key_size' bytes, and are compared
+ * byte by byte with the field at 'key_offset' of each element. The pending keys are
+ * kept in a small hash set, so each element is probed once against all of them, instead
+ * of scanning the array once for each key. The keys are processed in batches of
+ * BP_ARRAY_FIND_MANY_BATCH keys, and the scan stops as soon as all keys of the batch are
+ * found.
+ * @param array Reference to bp_array.
+ * @param keys Buffer with the keys to be found.
+ * @param key_offset Offset (in bytes) of the key field inside the element.
+ * @param key_size Size (in bytes) of a single key.
+ * @param nkeys Number of keys in the 'keys' buffer.
+ * @param out_idx [out] Buffer with 'nkeys' positions, where the index of the first
+ * element that matches each key will be put. The keys that weren't found receive
+ * BP_ARRAY_INVALID_INDEX.
+ * @return The number of keys found.
+ * @return 0 if the 'array', the 'keys' or the 'out_idx' argument is NULL, or if the key
+ * field doesn't fit in the element.
+ */
+size_t bp_array_find_many(bp_array_t *array, void *keys, size_t key_offset,
+                          size_t key_size, size_t nkeys, size_t *out_idx);
+
+/*!
+ * Sort the array in place, in ascending order. The sort is an introsort: a quicksort with
+ * median-of-three pivots, that switches to heapsort when the recursion gets too deep and
+ * to insertion sort for small ranges. The sort isn't stable.
+ * @param array Reference to bp_array.
+ * @param cmp Function to compare two elements.
+ * @return 0 on success.
+ * @return -ENODEV if the 'array' argument is NULL.
+ * @return -EINVAL if the 'cmp' argument is NULL.
+ */
+int bp_array_sort(bp_array_t *array, bp_array_cmp_t cmp);
+
+/*!
+ * Sort the array in place by an unsigned integer key field, in ascending order. The sort
+ * is a LSD radix sort, one byte at time, so it doesn't call any compare function. The
+ * sort is stable, and the bytes of the key that are equal in all elements are skipped.
+ *
+ * @note Signed keys are sorted as unsigned, so the negative values come after the
+ * positive ones.
+ *
+ * @param array Reference to bp_array.
+ * @param offset Offset (in bytes) of the key field inside the element.
+ * @param width Size (in bytes) of the key field: 1, 2, 4 or 8.
+ * @param scratch Buffer used by the sort, with at least the size of the array elements
+ * (size * element size) bytes.
+ * @return 0 on success.
+ * @return -ENODEV if the 'array' or the 'scratch' argument is NULL.
+ * @return -EINVAL if the width is invalid or the key field doesn't fit in the element.
+ */
+int bp_array_radix_sort_key(bp_array_t *array, size_t offset, size_t width,
+                            void *scratch);
+
+/*!
+ * Select the k-th smallest element of the array, in place (nth_element). After the
+ * call, the k-th element is at index 'k', the elements before it are less than or equal
+ * to it and the elements after it are greater than or equal to it. The selection is an
+ * introselect: a quickselect with median-of-three pivots, that switches to heapsort if
+ * the partitions get too unbalanced, so it's O(n) on average and O(n log n) at worst.
+ * @param array Reference to bp_array.
+ * @param k Rank of the desired element, starting from 0.
+ * @param cmp Function to compare two elements.
+ * @return A reference to the k-th element.
+ * @return NULL if the 'array' or the 'cmp' argument is NULL, or if 'k' is out of range.
+ */
+void *bp_array_select(bp_array_t *array, size_t k, bp_array_cmp_t cmp);
+
+/*!
+ * Select many quantiles of the array, in place, sharing the partitions among them. The
+ * quantile 'q' is the element with rank round(q * (size - 1)), so 0.5 is the median and
+ * 1.0 is the maximum. The array is partitioned once, and each side is only partitioned
+ * again if some of the requested ranks fall inside it.
+ * @param array Reference to bp_array.
+ * @param cmp Function to compare two elements.
+ * @param quantiles The quantiles, between 0.0 and 1.0, in ascending order.
+ * @param count Number of quantiles.
+ * @param out [out] Buffer with 'count' positions, where the reference to the element of
+ * each quantile will be put.
+ * @return 0 on success.
+ * @return -ENODEV if the 'array', the 'quantiles' or the 'out' argument is NULL.
+ * @return -EINVAL if the 'cmp' argument is NULL, or if the quantiles aren't between 0.0
+ * and 1.0 in ascending order.
+ * @return -ENOENT if the array is empty.
+ */
+int bp_array_percentiles(bp_array_t *array, bp_array_cmp_t cmp, const double *quantiles,
+                         size_t count, void **out);
+
 /*!
  * Drop all elements in the array.
  *
@@ -0,0 +1,104 @@
+/*!
+ * @file bp_array_par.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies the parallel algorithms over the array structure. The array is split
+ * in chunks, which are claimed by the workers of a bp_thread_pool in increasing order.
+ * The chunks are multiple of the cache line size, so two workers never write the same
+ * cache line.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_ARRAY_PAR_H
+#define BACKPACK_ARRAY_PAR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bp_array.h"
+#include "bp_thread_pool.h"
+
+/*!
+ * Approximated size (in bytes) of the chunks claimed by the workers.
+ */
+#define BP_ARRAY_PAR_CHUNK_SIZE (64U * 1024U)
+
+/*!
+ * Arrays smaller than this number of elements are sorted by a single worker.
+ */
+#define BP_ARRAY_PAR_SORT_MIN 8192U
+
+/*!
+ * Find the index of an element, splitting the search among the pool workers. The
+ * result is the same of bp_array_find_idx: the lowest index that matches. Once a match
+ * is found, the workers stop claiming the chunks after it.
+ * @param pool Reference to the worker pool.
+ * @param array Reference to bp_array.
+ * @param param Reference to the parameter used to compare elements.
+ * @param cmp Function to compare an element with the parameter passed at argument param.
+ * It's called from many threads at the same time. If it's NULL, then the elements will
+ * be compared with the parameter byte by byte.
+ * @return The index of found element.
+ * @return BP_ARRAY_INVALID_INDEX if the element wasn't found or if the 'pool', the
+ * 'array' or the 'param' argument is NULL.
+ */
+size_t bp_array_par_find_idx(bp_thread_pool_t *pool, bp_array_t *array, void *param,
+                             bool (*cmp)(void *el, void *param));
+
+/*!
+ * Count the elements that match a parameter, splitting the work among the pool
+ * workers.
+ * @param pool Reference to the worker pool.
+ * @param array Reference to bp_array.
+ * @param param Reference to the parameter used to compare elements.
+ * @param cmp Function to compare an element with the parameter passed at argument param.
+ * It's called from many threads at the same time. If it's NULL, then the elements will
+ * be compared with the parameter byte by byte.
+ * @return The number of elements that match.
+ * @return 0 if the 'pool', the 'array' or the 'param' argument is NULL.
+ */
+size_t bp_array_par_count(bp_thread_pool_t *pool, bp_array_t *array, void *param,
+                          bool (*cmp)(void *el, void *param));
+
+/*!
+ * Call a function for each element of the array, splitting the work among the pool
+ * workers. The order of the calls isn't defined.
+ * @param pool Reference to the worker pool.
+ * @param array Reference to bp_array.
+ * @param fn Function called for each element. It's called from many threads at the same
+ * time.
+ * @param param Parameter passed to each call of 'fn'.
+ * @return 0 on success.
+ * @return -ENODEV if the 'pool', the 'array' or the 'fn' argument is NULL.
+ */
+int bp_array_par_for_each(bp_thread_pool_t *pool, bp_array_t *array,
+                          void (*fn)(void *el, void *param), void *param);
+
+/*!
+ * Sort the array in place, in ascending order, splitting the work among the pool
+ * workers. Each worker sorts one run of the array with bp_array_sort, and then the runs
+ * are merged in pairs, in log2(workers) rounds. In each round the output is split evenly
+ * among the workers, using a binary search to find where each worker starts merging, so
+ * all workers stay busy until the last round. The merges alternate between the array
+ * buffer and the scratch buffer, so the function doesn't allocate any memory.
+ * @param pool Reference to the worker pool.
+ * @param array Reference to bp_array.
+ * @param cmp Function to compare two elements. It's called from many threads at the
+ * same time.
+ * @param scratch Buffer used by the merges, with at least the size of the array elements
+ * (size * element size) bytes.
+ * @return 0 on success.
+ * @return -ENODEV if the 'pool', the 'array' or the 'scratch' argument is NULL.
+ * @return -EINVAL if the 'cmp' argument is NULL.
+ */
+int bp_array_par_sort(bp_thread_pool_t *pool, bp_array_t *array, bp_array_cmp_t cmp,
+                      void *scratch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_ARRAY_PAR_H
@@ -0,0 +1,161 @@
+/*!
+ * @file bp_bcast.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies the broadcast ring. One writer publishes records with increasing
+ * sequence numbers, and every reader sees all of them through its own cursor, so reading
+ * never removes a record for the other readers. In the gated mode the writer never passes
+ * the slowest reader. In the lossy mode it never waits: it overwrites the oldest records,
+ * and a reader that fell behind is told how many records it missed. The readers claim
+ * the records in batches, and use them in place.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_BCAST_H
+#define BACKPACK_BCAST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bp_cpu.h"
+
+/*!
+ * Cursor of a reader. It's padded by a cache line on both sides, so it never shares a
+ * line with another cursor or with the records, whatever the alignment of the buffer.
+ */
+typedef struct {
+    uint8_t _lpad[BP_CACHE_LINE_SIZE]; /*!< Padding. */
+    uint64_t _seq; /*!< Sequence number of the next record to be read. */
+    uint8_t _rpad[BP_CACHE_LINE_SIZE - sizeof(uint64_t)]; /*!< Padding. */
+} bp_bcast_cursor_t;
+
+/*!
+ * Declare the type of a broadcast ring buffer.
+ * @param type_ Type of the records.
+ * @param capacity_ Number of records kept. It must be a power of two.
+ * @param readers_ Number of readers.
+ */
+#define BP_BCAST_BUFFER(type_, capacity_, readers_)                            \
+    struct {                                                                   \
+        type_ slots[capacity_];                                                \
+        bp_bcast_cursor_t cursors[readers_];                                   \
+    }
+
+/*!
+ * Macro to initialize an empty broadcast ring. The buffer must be zeroed, like any
+ * static buffer.
+ * @param buffer_ Buffer declared with BP_BCAST_BUFFER.
+ * @param lossy_ true for the lossy mode, false for the gated mode.
+ */
+#define BP_BCAST_INIT(buffer_, lossy_)                                              \
+    {                                                                               \
+        ._array = (uint8_t *) (buffer_).slots,                                      \
+        ._element_size = sizeof((buffer_).slots[0]),                                \
+        ._capacity = sizeof((buffer_).slots) / sizeof((buffer_).slots[0]),          \
+        ._cursors = (buffer_).cursors,                                              \
+        ._nreaders = sizeof((buffer_).cursors) / sizeof((buffer_).cursors[0]),      \
+        ._lossy = (lossy_),                                                         \
+    }
+
+/*!
+ * Batch of records claimed by a reader.
+ */
+typedef struct {
+    void *els;       /*!< First record. The records are contiguous in the buffer. */
+    size_t count;    /*!< Number of records. */
+    uint64_t seq;    /*!< Sequence number of the first record. */
+    uint64_t missed; /*!< Number of records overwritten before the reader got to them. */
+} bp_bcast_batch_t;
+
+/*!
+ * Struct with metadata about the broadcast ring. The fields written by the writer are
+ * padded by a cache line on both sides, so, whatever the alignment of the struct, they
+ * are kept apart from the ones the readers only read and from the surrounding data.
+ */
+typedef struct {
+    uint8_t _lpad[BP_CACHE_LINE_SIZE]; /*!< Padding. */
+    uint64_t _published; /*!< Sequence number after the last published record. */
+    uint64_t _claimed;   /*!< Sequence number after the last record being written. */
+    uint64_t _gate;      /*!< Slowest cursor seen by the writer. */
+    uint8_t _rpad[BP_CACHE_LINE_SIZE]; /*!< Padding. */
+    uint8_t *_array;               /*!< Reference to the buffer itself. */
+    size_t _element_size;          /*!< Size (in bytes) of a single record. */
+    size_t _capacity;              /*!< Number of records kept. */
+    bp_bcast_cursor_t *_cursors;   /*!< Cursor of each reader. */
+    size_t _nreaders;              /*!< Number of readers. */
+    bool _lossy;                   /*!< Set in the lossy mode. */
+} bp_bcast_t;
+
+/*!
+ * Publish a sequence of records. It must only be called by the writer thread. Either all
+ * the records are published or none is.
+ * @param bcast Reference to bp_bcast.
+ * @param els Reference to the records.
+ * @param count Number of records.
+ * @return 0 on success.
+ * @return -ENODEV if the 'bcast' or the 'els' argument is NULL.
+ * @return -EINVAL if the capacity isn't a power of two or if 'count' is greater than it.
+ * @return -EAGAIN if, in the gated mode, the slowest reader hasn't freed enough room.
+ */
+int bp_bcast_publish(bp_bcast_t *bcast, const void *els, size_t count);
+
+/*!
+ * Claim the next records of a reader, without copying them. The batch stops at the end of
+ * the buffer, so the rest is claimed by the next call. The reader keeps its place until
+ * it releases the batch.
+ * @param bcast Reference to bp_bcast.
+ * @param reader Index of the reader. Each reader must be used by one thread at a time.
+ * @param max Maximum number of records in the batch, or 0 for no limit.
+ * @param batch [out] Reference to a variable where the batch will be put.
+ * @return 0 on success.
+ * @return -ENODEV if the 'bcast' or the 'batch' argument is NULL.
+ * @return -EINVAL if the reader doesn't exist.
+ * @return -ENOENT if there are no new records.
+ */
+int bp_bcast_claim(bp_bcast_t *bcast, size_t reader, size_t max, bp_bcast_batch_t *batch);
+
+/*!
+ * Release a batch, moving the cursor of the reader past it. In the gated mode, it frees
+ * room for the writer.
+ * @param bcast Reference to bp_bcast.
+ * @param reader Index of the reader.
+ * @param batch Reference to the batch, from bp_bcast_claim.
+ * @return 0 on success.
+ * @return -ENODEV if the 'bcast' or the 'batch' argument is NULL.
+ * @return -EINVAL if the reader doesn't exist.
+ * @return -ESTALE if, in the lossy mode, the writer overwrote records of the batch while
+ * the reader held it. The cursor is still moved, and the batch must be discarded.
+ */
+int bp_bcast_release(bp_bcast_t *bcast, size_t reader, bp_bcast_batch_t *batch);
+
+/*!
+ * Get the number of records a reader hasn't read yet. In the lossy mode it counts only
+ * the records still in the buffer.
+ * @param bcast Reference to bp_bcast.
+ * @param reader Index of the reader.
+ * @return The number of records.
+ * @return 0 if the 'bcast' argument is NULL or if the reader doesn't exist.
+ */
+size_t bp_bcast_pending(bp_bcast_t *bcast, size_t reader);
+
+/*!
+ * Get the number of records ever published.
+ * @param bcast Reference to bp_bcast.
+ * @return The sequence number after the last published record.
+ * @return 0 if the 'bcast' argument is NULL.
+ */
+uint64_t bp_bcast_published(bp_bcast_t *bcast);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_BCAST_H
@@ -0,0 +1,85 @@
+/*!
+ * @file bp_bits.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Bit manipulation helpers shared by the backpack structures. They wrap the
+ * compiler builtins, so the structures don't need to care about the compiler in use.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_BITS_H
+#define BACKPACK_BITS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/*!
+ * Count the trailing zero bits of a 64 bits word.
+ * @param word The word to be inspected. Must be different of zero.
+ * @return The index of the least significant set bit.
+ */
+static inline unsigned int bp_ctz64(uint64_t word)
+{
+#ifdef _MSC_VER
+    unsigned long idx;
+    _BitScanForward64(&idx, word);
+    return (unsigned int) idx;
+#else
+    return (unsigned int) __builtin_ctzll(word);
+#endif
+}
+
+/*!
+ * Count the leading zero bits of a 64 bits word.
+ * @param word The word to be inspected. Must be different of zero.
+ * @return The number of zero bits above the most significant set bit.
+ */
+static inline unsigned int bp_clz64(uint64_t word)
+{
+#ifdef _MSC_VER
+    unsigned long idx;
+    _BitScanReverse64(&idx, word);
+    return 63U - (unsigned int) idx;
+#else
+    return (unsigned int) __builtin_clzll(word);
+#endif
+}
+
+/*!
+ * Count the set bits of a 64 bits word.
+ * @param word The word to be inspected.
+ * @return The number of bits set in the word.
+ */
+static inline unsigned int bp_popcount64(uint64_t word)
+{
+#ifdef _MSC_VER
+    return (unsigned int) __popcnt64(word);
+#else
+    return (unsigned int) __builtin_popcountll(word);
+#endif
+}
+
+/*!
+ * Get a mask with the lowest n bits set.
+ * @param n Number of bits in the mask, from 0 to 64.
+ * @return The mask.
+ */
+static inline uint64_t bp_mask64(unsigned int n)
+{
+    return (n >= 64U) ? UINT64_MAX : ((UINT64_C(1) << n) - 1U);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_BITS_H
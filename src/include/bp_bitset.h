@@ -0,0 +1,194 @@
+/*!
+ * @file bp_bitset.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies the bitset structure. The bits are packed in 64-bit words, so the
+ * scans skip a whole word of zeros at once, and count the bits with popcount.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_BITSET_H
+#define BACKPACK_BITSET_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*!
+ * Number of bits in a bitset word.
+ */
+#define BP_BITSET_WORD_BITS 64U
+
+/*!
+ * Get the number of words needed to store a number of bits.
+ * @param bits_ Number of bits.
+ */
+#define BP_BITSET_WORDS(bits_) (((bits_) + BP_BITSET_WORD_BITS - 1U) / BP_BITSET_WORD_BITS)
+
+/*!
+ * Macro to initialize a bitset, with all the bits cleared.
+ * @param buffer_ Array of uint64_t, with at least BP_BITSET_WORDS(bits_) words. It must be
+ * zeroed, like any static buffer.
+ * @param bits_ Number of bits.
+ */
+#define BP_BITSET_INIT(buffer_, bits_)                                          \
+    {                                                                           \
+        ._words = (buffer_), ._bits = (bits_),                                  \
+        ._nwords = BP_BITSET_WORDS(bits_),                                      \
+    }
+
+/*!
+ * Struct with metadata about the bitset.
+ */
+typedef struct {
+    uint64_t *_words; /*!< Reference to the buffer, where the bits are stored. */
+    size_t _bits;     /*!< Number of bits. */
+    size_t _nwords;   /*!< Number of words. */
+} bp_bitset_t;
+
+/*!
+ * Set a bit.
+ * @param bitset Reference to bp_bitset.
+ * @param idx Index of the bit.
+ * @return 0 on success.
+ * @return -ENODEV if the 'bitset' argument is NULL.
+ * @return -EINVAL if the index is out of the bitset.
+ */
+int bp_bitset_set(bp_bitset_t *bitset, size_t idx);
+
+/*!
+ * Clear a bit.
+ * @param bitset Reference to bp_bitset.
+ * @param idx Index of the bit.
+ * @return 0 on success.
+ * @return -ENODEV if the 'bitset' argument is NULL.
+ * @return -EINVAL if the index is out of the bitset.
+ */
+int bp_bitset_unset(bp_bitset_t *bitset, size_t idx);
+
+/*!
+ * Check if a bit is set.
+ * @param bitset Reference to bp_bitset.
+ * @param idx Index of the bit.
+ * @return true if the bit is set, false otherwise, if the 'bitset' argument is NULL or
+ * if the index is out of the bitset.
+ */
+bool bp_bitset_test(bp_bitset_t *bitset, size_t idx);
+
+/*!
+ * Set all the bits.
+ * @param bitset Reference to bp_bitset.
+ * @return 0 on success.
+ * @return -ENODEV if the 'bitset' argument is NULL.
+ */
+int bp_bitset_fill(bp_bitset_t *bitset);
+
+/*!
+ * Clear all the bits.
+ * @param bitset Reference to bp_bitset.
+ * @return 0 on success.
+ * @return -ENODEV if the 'bitset' argument is NULL.
+ */
+int bp_bitset_clear(bp_bitset_t *bitset);
+
+/*!
+ * Find the first set bit.
+ * @param bitset Reference to bp_bitset.
+ * @return Index of the first set bit.
+ * @return The number of bits if no bit is set.
+ * @return 0 if the 'bitset' argument is NULL.
+ */
+size_t bp_bitset_find_first(bp_bitset_t *bitset);
+
+/*!
+ * Find the first set bit at or after an index. It's used to visit every set bit:
+ * @code
+ * for (size_t i = bp_bitset_find_first(&bs); i < n; i = bp_bitset_find_next(&bs, i + 1))
+ * @endcode
+ * @param bitset Reference to bp_bitset.
+ * @param idx Index where the search starts.
+ * @return Index of the set bit.
+ * @return The number of bits if there is no such bit.
+ * @return 0 if the 'bitset' argument is NULL.
+ */
+size_t bp_bitset_find_next(bp_bitset_t *bitset, size_t idx);
+
+/*!
+ * Count the set bits.
+ * @param bitset Reference to bp_bitset.
+ * @return The number of set bits.
+ * @return 0 if the 'bitset' argument is NULL.
+ */
+size_t bp_bitset_count(bp_bitset_t *bitset);
+
+/*!
+ * Count the set bits before an index.
+ * @param bitset Reference to bp_bitset.
+ * @param idx Index of the bit. The bit itself isn't counted.
+ * @return The number of set bits in [0, idx). An index past the end counts every bit.
+ * @return 0 if the 'bitset' argument is NULL.
+ */
+size_t bp_bitset_rank(bp_bitset_t *bitset, size_t idx);
+
+/*!
+ * Find the n-th set bit. It's the inverse of bp_bitset_rank.
+ * @param bitset Reference to bp_bitset.
+ * @param nth Rank of the bit, starting at zero.
+ * @return Index of the set bit.
+ * @return The number of bits if there are not enough set bits.
+ * @return 0 if the 'bitset' argument is NULL.
+ */
+size_t bp_bitset_select(bp_bitset_t *bitset, size_t nth);
+
+/*!
+ * Compute dst = dst & src.
+ * @param dst Reference to the bitset with the result.
+ * @param src Reference to the other operand.
+ * @return 0 on success.
+ * @return -ENODEV if any argument is NULL.
+ * @return -EINVAL if the bitsets don't have the same number of bits.
+ */
+int bp_bitset_and(bp_bitset_t *dst, bp_bitset_t *src);
+
+/*!
+ * Compute dst = dst | src.
+ * @param dst Reference to the bitset with the result.
+ * @param src Reference to the other operand.
+ * @return 0 on success.
+ * @return -ENODEV if any argument is NULL.
+ * @return -EINVAL if the bitsets don't have the same number of bits.
+ */
+int bp_bitset_or(bp_bitset_t *dst, bp_bitset_t *src);
+
+/*!
+ * Compute dst = dst ^ src.
+ * @param dst Reference to the bitset with the result.
+ * @param src Reference to the other operand.
+ * @return 0 on success.
+ * @return -ENODEV if any argument is NULL.
+ * @return -EINVAL if the bitsets don't have the same number of bits.
+ */
+int bp_bitset_xor(bp_bitset_t *dst, bp_bitset_t *src);
+
+/*!
+ * Compute dst = dst & ~src, clearing in dst the bits set in src.
+ * @param dst Reference to the bitset with the result.
+ * @param src Reference to the other operand.
+ * @return 0 on success.
+ * @return -ENODEV if any argument is NULL.
+ * @return -EINVAL if the bitsets don't have the same number of bits.
+ */
+int bp_bitset_andnot(bp_bitset_t *dst, bp_bitset_t *src);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_BITSET_H
@@ -0,0 +1,41 @@
+/*!
+ * @file bp_block.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies the block predicate. A block predicate compares many contiguous
+ * elements in a single call, so the user could write it with SIMD instructions, instead
+ * of paying one call for each element.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_BLOCK_H
+#define BACKPACK_BLOCK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*!
+ * Maximum number of elements passed to a block predicate in a single call. It's the
+ * number of bits in the match mask.
+ */
+#define BP_BLOCK_SIZE 64U
+
+/*!
+ * Type for block compare function. The function receives 'count' contiguous elements,
+ * where 'count' is between 1 and BP_BLOCK_SIZE, and must return a mask where the i-th
+ * bit is set if the i-th element matches the parameter. The bits above 'count' are
+ * ignored.
+ */
+typedef uint64_t (*bp_block_cmp_t)(void *els, size_t count, void *param);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_BLOCK_H
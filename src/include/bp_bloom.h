@@ -0,0 +1,135 @@
+/*!
+ * @file bp_bloom.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies the Bloom filter structure. The Bloom filter tells if a key may have
+ * been added to it, or if it surely wasn't. It's a split block filter: each key sets
+ * one bit in each of the 8 words of a single block, so a query reads a single cache
+ * line. It's used to skip the search of keys that aren't in a bp_array.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_BLOOM_H
+#define BACKPACK_BLOOM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bp_array.h"
+#include "bp_cpu.h"
+
+/*!
+ * Number of 32 bits words in a block of the filter.
+ */
+#define BP_BLOOM_BLOCK_WORDS 8U
+
+/*!
+ * Macro to initialize a bp_bloom.
+ * @param blocks_ Buffer of bp_bloom_block_t. About one block for each 16 keys keeps the
+ * false positive rate under 1%.
+ */
+#define BP_BLOOM_INIT(blocks_)                                                  \
+    {                                                                           \
+        ._blocks = (blocks_), ._nblocks = sizeof(blocks_) / sizeof((blocks_)[0]), \
+    }
+
+/*!
+ * A block of the filter. It's aligned to its size, so it never straddles two cache lines
+ * and a lookup costs a single cache miss.
+ */
+typedef struct BP_ALIGNED(32) {
+    uint32_t words[BP_BLOOM_BLOCK_WORDS]; /*!< Bits of the block. */
+} bp_bloom_block_t;
+
+/*!
+ * Struct with metadata about the Bloom filter.
+ */
+typedef struct {
+    bp_bloom_block_t *_blocks; /*!< Reference to the buffer with the blocks. */
+    size_t _nblocks;           /*!< Number of blocks. */
+} bp_bloom_t;
+
+/*!
+ * Add a key to the filter.
+ * @param bloom Reference to bp_bloom.
+ * @param key Reference to the key.
+ * @param key_size Size (in bytes) of the key.
+ * @return 0 on success.
+ * @return -ENODEV if the 'bloom' argument is NULL.
+ * @return -EINVAL if the 'key' argument is NULL, or if the filter doesn't have blocks.
+ */
+int bp_bloom_add(bp_bloom_t *bloom, const void *key, size_t key_size);
+
+/*!
+ * Check if a key may have been added to the filter.
+ * @param bloom Reference to bp_bloom.
+ * @param key Reference to the key.
+ * @param key_size Size (in bytes) of the key.
+ * @return false if the key surely wasn't added, true if it may have been added.
+ * @return true if the 'bloom' or the 'key' argument is NULL, or if the filter doesn't
+ * have blocks, so the caller falls back to a full search.
+ */
+bool bp_bloom_contains(bp_bloom_t *bloom, const void *key, size_t key_size);
+
+/*!
+ * Remove all the keys from the filter.
+ * @param bloom Reference to bp_bloom.
+ * @return 0 on success.
+ * @return -ENODEV if the 'bloom' argument is NULL.
+ */
+int bp_bloom_clear(bp_bloom_t *bloom);
+
+/*!
+ * Push an element to an array and add its key to the filter.
+ * @param bloom Reference to bp_bloom.
+ * @param array Reference to bp_array.
+ * @param el Reference to the element.
+ * @param key_offset Offset (in bytes) of the key inside each element.
+ * @param key_size Size (in bytes) of the key.
+ * @return 0 on success.
+ * @return -ENODEV if the 'bloom' or the 'array' argument is NULL.
+ * @return -EINVAL if the key doesn't fit inside an element, if the 'el' argument is
+ * NULL, or if the filter doesn't have blocks. The element isn't pushed then.
+ * @return The error of bp_array_push.
+ */
+int bp_bloom_array_push(bp_bloom_t *bloom, bp_array_t *array, void *el, size_t key_offset,
+                        size_t key_size);
+
+/*!
+ * Find the first element of an array with a key, checking the filter first. A key that
+ * isn't in the filter costs a single block read, instead of a scan of the array.
+ * @param bloom Reference to bp_bloom, with the keys of all the array elements.
+ * @param array Reference to bp_array.
+ * @param key Reference to the key.
+ * @param key_offset Offset (in bytes) of the key inside each element.
+ * @param key_size Size (in bytes) of the key.
+ * @return Reference to the element.
+ * @return NULL if any argument is NULL, if the key doesn't fit inside an element or if
+ * the key isn't found.
+ */
+void *bp_bloom_array_find(bp_bloom_t *bloom, bp_array_t *array, const void *key,
+                          size_t key_offset, size_t key_size);
+
+/*!
+ * Rebuild the filter with the keys of an array. The filter can't forget a key, so the
+ * deleted elements only make it less precise until it's rebuilt.
+ * @param bloom Reference to bp_bloom.
+ * @param array Reference to bp_array.
+ * @param key_offset Offset (in bytes) of the key inside each element.
+ * @param key_size Size (in bytes) of the key.
+ * @return 0 on success.
+ * @return -ENODEV if the 'bloom' or the 'array' argument is NULL.
+ * @return -EINVAL if the key doesn't fit inside an element, or if the filter doesn't
+ * have blocks.
+ */
+int bp_bloom_array_rebuild(bp_bloom_t *bloom, bp_array_t *array, size_t key_offset,
+                           size_t key_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_BLOOM_H
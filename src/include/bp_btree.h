@@ -0,0 +1,176 @@
+/*!
+ * @file bp_btree.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies the B+tree structure. It's an ordered map from uint64_t keys to
+ * uint64_t values, with the nodes taken from a static pool. The values are kept in the
+ * leaves, which are linked to each other, so a range of keys is walked in order without
+ * going back to the root. Insert, erase and lookup are O(log n).
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_BTREE_H
+#define BACKPACK_BTREE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bp_cpu.h"
+#include "bp_iter2.h"
+
+/*!
+ * Maximum number of keys in a node. The keys of a node fill two cache lines, and they are
+ * searched all at once with SIMD compares.
+ */
+#define BP_BTREE_KEYS 16U
+
+/*!
+ * Node of the B+tree. Its size is a multiple of 64 bytes, so the nodes of a pool aligned to
+ * the cache line, as declared by BP_BTREE_POOL, never straddle one.
+ */
+typedef struct {
+    uint64_t keys[BP_BTREE_KEYS]; /*!< Sorted keys. The unused ones are UINT64_MAX. */
+    union {
+        uint64_t values[BP_BTREE_KEYS];        /*!< Values of the keys, in a leaf. */
+        uint32_t children[BP_BTREE_KEYS + 1U]; /*!< Child nodes plus one, in an inner node. */
+    } u;                                       /*!< Payload of the node. */
+    uint32_t next;                             /*!< Next leaf plus one, or next free node. */
+    uint32_t prev;                             /*!< Previous leaf plus one. */
+    uint16_t count;                            /*!< Number of keys. */
+    uint8_t leaf;                              /*!< Set if the node is a leaf. */
+    uint8_t _pad[53];                          /*!< Padding up to 320 bytes. */
+} bp_btree_node_t;
+
+/*!
+ * Declare a node pool aligned to the cache line.
+ * @param name_ Name of the pool.
+ * @param nodes_ Number of nodes in the pool.
+ */
+#define BP_BTREE_POOL(name_, nodes_) BP_ALIGNED(64) bp_btree_node_t name_[nodes_]
+
+/*!
+ * Macro to initialize an empty B+tree.
+ * @param nodes_ Pool declared with BP_BTREE_POOL. Each node holds up to 16
+ * elements, and about one node in eight is an inner node.
+ */
+#define BP_BTREE_INIT(nodes_)                                                   \
+    {                                                                           \
+        ._nodes = (nodes_), ._capacity = sizeof(nodes_) / sizeof((nodes_)[0]),  \
+    }
+
+/*!
+ * Struct with metadata about the B+tree.
+ */
+typedef struct {
+    bp_btree_node_t *_nodes; /*!< Node pool. */
+    size_t _capacity;        /*!< Number of nodes in the pool. */
+    size_t _used;            /*!< Number of nodes ever taken from the pool. */
+    size_t _live;            /*!< Number of nodes in the tree. */
+    uint32_t _free;          /*!< First free node plus one, or zero. */
+    uint32_t _root;          /*!< Root node plus one, or zero if the tree is empty. */
+    size_t _height;          /*!< Number of levels. */
+    size_t _size;            /*!< Number of elements. */
+} bp_btree_t;
+
+/*!
+ * Range of keys [lo, hi), walked by bp_btree_range_iterator.
+ */
+typedef struct {
+    bp_btree_t *tree; /*!< Reference to the B+tree. */
+    uint64_t lo;      /*!< First key of the range. */
+    uint64_t hi;      /*!< Key after the range. It isn't included. */
+} bp_btree_range_t;
+
+/*!
+ * Insert an element.
+ * @param tree Reference to bp_btree.
+ * @param key The key.
+ * @param value The value.
+ * @return 0 on success.
+ * @return -ENODEV if the 'tree' argument is NULL.
+ * @return -EEXIST if the key is already in the tree.
+ * @return -ENOMEM if the node pool may not have enough nodes for the insertion.
+ */
+int bp_btree_insert(bp_btree_t *tree, uint64_t key, uint64_t value);
+
+/*!
+ * Find the value of a key.
+ * @param tree Reference to bp_btree.
+ * @param key The key.
+ * @return Reference to the value. It's valid until the next insert or erase.
+ * @return NULL if the 'tree' argument is NULL or if the key isn't found.
+ */
+uint64_t *bp_btree_find(bp_btree_t *tree, uint64_t key);
+
+/*!
+ * Find the first element with a key not less than a given key.
+ * @param tree Reference to bp_btree.
+ * @param key The key.
+ * @param found [out] Key of the element found. It can be NULL.
+ * @return Reference to the value of the element found.
+ * @return NULL if the 'tree' argument is NULL or if every key is less than 'key'.
+ */
+uint64_t *bp_btree_lower_bound(bp_btree_t *tree, uint64_t key, uint64_t *found);
+
+/*!
+ * Erase an element.
+ * @param tree Reference to bp_btree.
+ * @param key The key.
+ * @return 0 on success.
+ * @return -ENODEV if the 'tree' argument is NULL.
+ * @return -ENOENT if the key isn't found.
+ */
+int bp_btree_erase(bp_btree_t *tree, uint64_t key);
+
+/*!
+ * Remove all the elements, returning every node to the pool.
+ * @param tree Reference to bp_btree.
+ * @return 0 on success.
+ * @return -ENODEV if the 'tree' argument is NULL.
+ */
+int bp_btree_clear(bp_btree_t *tree);
+
+/*!
+ * Get the number of elements.
+ * @param tree Reference to bp_btree.
+ * @return The number of elements.
+ * @return 0 if the 'tree' argument is NULL.
+ */
+size_t bp_btree_size(bp_btree_t *tree);
+
+/*!
+ * Get an iterator over all the elements, in key order. It yields references to the values.
+ * @param tree Reference to bp_btree.
+ * @return Iterator to the B+tree. The tree must not be changed while iterating.
+ */
+bp_iterator_t bp_btree_iterator(bp_btree_t *tree);
+
+/*!
+ * Get an iterator over the elements with keys in [lo, hi), in key order. It yields
+ * references to the values.
+ * @param range Reference to the range. It must outlive the iterator.
+ * @return Iterator to the range. The tree must not be changed while iterating.
+ */
+bp_iterator_t bp_btree_range_iterator(bp_btree_range_t *range);
+
+/*!
+ * Get the key of the current element of an iterator.
+ * @param it Reference to an iterator from bp_btree_iterator or bp_btree_range_iterator.
+ * @return The key.
+ * @return 0 if the 'it' argument is NULL or if it isn't at an element.
+ */
+uint64_t bp_btree_iterator_key(bp_iterator_t *it);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_BTREE_H
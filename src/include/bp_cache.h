@@ -0,0 +1,166 @@
+/*!
+ * @file bp_cache.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies the cache structure. The cache keeps up to a fixed number of
+ * elements, found by their keys through a chained hash index. When it's full, a new
+ * element replaces the least recently used one (LRU), or an approximation of it (CLOCK).
+ * All the links are indexes into static buffers, and every operation is O(1).
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_CACHE_H
+#define BACKPACK_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/*!
+ * Enumerate the kinds of cache.
+ */
+typedef enum {
+    BP_LRU_CACHE,   /*!< Evict the least recently used element. Each hit moves the element
+                         to the front of a list. */
+    BP_CLOCK_CACHE, /*!< Evict an element not used since the last sweep of the clock
+                         hand. Each hit only sets a flag, without touching any list. */
+} bp_cache_kind_t;
+
+/*!
+ * Links of a cache slot. The links hold the slot index plus one, so zero means none.
+ */
+typedef struct {
+    uint32_t prev;  /*!< Previous slot in the recency list. */
+    uint32_t next;  /*!< Next slot in the recency list, or in the free list. */
+    uint32_t chain; /*!< Next slot in the same hash bucket. */
+    uint32_t ref;   /*!< Set when the slot is used, for the CLOCK cache. */
+} bp_cache_node_t;
+
+/*!
+ * Declare the type of a cache buffer.
+ * @param type_ Type of the elements. The key must be the first member of the element.
+ * @param capacity_ Maximum number of elements.
+ * @param buckets_ Number of hash buckets. Must be a power of two. About the capacity
+ * keeps the chains short.
+ */
+#define BP_CACHE_BUFFER(type_, capacity_, buckets_)                             \
+    struct {                                                                    \
+        type_ slots[capacity_];                                                 \
+        bp_cache_node_t nodes[capacity_];                                       \
+        uint32_t buckets[buckets_];                                             \
+    }
+
+/*!
+ * Macro to initialize a cache of a given kind.
+ * @param buffer_ Buffer declared with BP_CACHE_BUFFER. It must be zeroed, like any
+ * static buffer.
+ * @param key_size_ Size (in bytes) of the key, at the start of each element.
+ * @param kind_ Kind of the cache.
+ */
+#define BP_CACHE_INIT(buffer_, key_size_, kind_)                                        \
+    {                                                                                   \
+        ._slots = (uint8_t *) (buffer_).slots, ._nodes = (buffer_).nodes,               \
+        ._buckets = (buffer_).buckets, ._element_size = sizeof((buffer_).slots[0]),     \
+        ._capacity = sizeof((buffer_).slots) / sizeof((buffer_).slots[0]),              \
+        ._nbuckets = sizeof((buffer_).buckets) / sizeof((buffer_).buckets[0]),          \
+        ._key_size = (key_size_), ._kind = (kind_),                                     \
+    }
+
+/*!
+ * Macro to initialize a LRU cache.
+ * @param buffer_ Buffer declared with BP_CACHE_BUFFER.
+ * @param key_size_ Size (in bytes) of the key, at the start of each element.
+ */
+#define BP_LRU_CACHE_INIT(buffer_, key_size_) BP_CACHE_INIT(buffer_, key_size_, BP_LRU_CACHE)
+
+/*!
+ * Macro to initialize a CLOCK cache.
+ * @param buffer_ Buffer declared with BP_CACHE_BUFFER.
+ * @param key_size_ Size (in bytes) of the key, at the start of each element.
+ */
+#define BP_CLOCK_CACHE_INIT(buffer_, key_size_)                                 \
+    BP_CACHE_INIT(buffer_, key_size_, BP_CLOCK_CACHE)
+
+/*!
+ * Struct with metadata about the cache.
+ */
+typedef struct {
+    uint8_t *_slots;          /*!< Reference to the buffer, where the elements are stored. */
+    bp_cache_node_t *_nodes;  /*!< Links of each slot. */
+    uint32_t *_buckets;       /*!< First slot of each hash bucket. */
+    size_t _element_size;     /*!< Size (in bytes) of a single element. */
+    size_t _capacity;         /*!< Maximum number of elements. */
+    size_t _nbuckets;         /*!< Number of hash buckets. */
+    size_t _key_size;         /*!< Size (in bytes) of the key. */
+    bp_cache_kind_t _kind;    /*!< Kind of the cache. */
+    size_t _size;             /*!< Current number of elements. */
+    size_t _used;             /*!< Number of slots ever used. */
+    uint32_t _head;           /*!< Most recently used slot (LRU). */
+    uint32_t _tail;           /*!< Least recently used slot (LRU). */
+    uint32_t _free;           /*!< First slot of the free list. */
+    size_t _hand;             /*!< Next slot inspected by the clock hand (CLOCK). */
+} bp_cache_t;
+
+/*!
+ * Put an element in the cache. If there is an element with the same key, it's replaced.
+ * If the cache is full, an element is evicted to make room.
+ * @param cache Reference to bp_cache.
+ * @param el Reference to the element, starting with its key.
+ * @param evicted [out] Buffer where the evicted element is copied to. It can be NULL.
+ * @return 0 on success, without evicting any element.
+ * @return 1 on success, when an element was evicted.
+ * @return -ENODEV if the 'cache' argument is NULL.
+ * @return -EINVAL if the 'el' argument is NULL, if the capacity is zero or if the
+ * number of buckets isn't a power of two.
+ */
+int bp_cache_put(bp_cache_t *cache, void *el, void *evicted);
+
+/*!
+ * Get an element by its key, marking it as recently used.
+ * @param cache Reference to bp_cache.
+ * @param key Reference to the key.
+ * @return Reference to the element. Its value can be changed, but its key must not.
+ * @return NULL if the 'cache' or the 'key' argument is NULL, if the cache isn't valid or
+ * if the key isn't found.
+ */
+void *bp_cache_get(bp_cache_t *cache, void *key);
+
+/*!
+ * Delete an element by its key.
+ * @param cache Reference to bp_cache.
+ * @param key Reference to the key.
+ * @return 0 on success.
+ * @return -ENODEV if the 'cache' argument is NULL.
+ * @return -EINVAL if the 'key' argument is NULL, or if the cache isn't valid.
+ * @return -ENOENT if the key isn't found.
+ */
+int bp_cache_del(bp_cache_t *cache, void *key);
+
+/*!
+ * Remove all the elements.
+ * @param cache Reference to bp_cache.
+ * @return 0 on success.
+ * @return -ENODEV if the 'cache' argument is NULL.
+ */
+int bp_cache_clear(bp_cache_t *cache);
+
+/*!
+ * Get the number of elements.
+ * @param cache Reference to bp_cache.
+ * @return The number of elements.
+ * @return 0 if the 'cache' argument is NULL.
+ */
+size_t bp_cache_size(bp_cache_t *cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_CACHE_H
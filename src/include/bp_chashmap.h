@@ -0,0 +1,155 @@
+/*!
+ * @file bp_chashmap.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies the concurrent hash map structure. The concurrent hash map splits the
+ * keys among stripes, and each stripe is a bp_hashmap guarded by a sequence lock.
+ * Writers of a stripe are serialized by the lock, while readers never write to shared
+ * memory: they copy the element out and retry if a writer changed the stripe meanwhile.
+ * As with any sequence lock, the read itself is done with plain loads while a writer may
+ * be changing the same bytes, so it can see a torn control byte, key or element (and
+ * race detectors such as TSan report it). A torn read is always discarded by the retry,
+ * and the keys are only compared with memcmp, so no user code ever sees one.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_CHASHMAP_H
+#define BACKPACK_CHASHMAP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bp_hashmap.h"
+#include "bp_cpu.h"
+
+/*!
+ * Declare the type of a concurrent hash map buffer.
+ * @param type_ Type of the elements. The key must be the first member of the element.
+ * @param stripes_ Number of stripes. More stripes means less contention among writers.
+ * @param stripe_capacity_ Number of slots of each stripe. Must be a power of two, not
+ * smaller than BP_HASHMAP_GROUP_SIZE.
+ */
+#define BP_CHASHMAP_BUFFER(type_, stripes_, stripe_capacity_)                   \
+    struct {                                                                    \
+        bp_chashmap_stripe_t stripes[stripes_];                                 \
+        struct {                                                                \
+            type_ slots[stripe_capacity_];                                      \
+            uint8_t ctrl[(stripe_capacity_) + BP_HASHMAP_GROUP_SIZE];           \
+        } maps[stripes_];                                                       \
+    }
+
+/*!
+ * Macro to initialize a bp_chashmap. The buffer must be zeroed, like any static buffer.
+ * @param buffer_ Buffer declared with BP_CHASHMAP_BUFFER.
+ * @param key_size_ Size (in bytes) of the key, at the start of each element.
+ */
+#define BP_CHASHMAP_INIT(buffer_, key_size_)                                         \
+    {                                                                                \
+        ._stripes = (buffer_).stripes, ._maps = (uint8_t *) (buffer_).maps,          \
+        ._map_size       = sizeof((buffer_).maps[0]),                                \
+        ._ctrl_offset    = sizeof((buffer_).maps[0].slots),                          \
+        ._element_size   = sizeof((buffer_).maps[0].slots[0]),                       \
+        ._stripe_capacity = sizeof((buffer_).maps[0].slots) /                        \
+                            sizeof((buffer_).maps[0].slots[0]),                      \
+        ._nstripes = sizeof((buffer_).stripes) / sizeof((buffer_).stripes[0]),       \
+        ._key_size = (key_size_),                                                    \
+    }
+
+/*!
+ * Struct with the state of a stripe. It takes a whole cache line, so writers of
+ * different stripes don't disturb each other.
+ */
+typedef struct {
+    size_t _seq;     /*!< Sequence counter. It's odd while a writer holds the stripe. */
+    size_t _size;    /*!< Number of elements in the stripe. */
+    size_t _deleted; /*!< Number of deleted slots in the stripe. */
+    uint8_t _pad[BP_CACHE_LINE_SIZE - 3U * sizeof(size_t)]; /*!< Padding. */
+} bp_chashmap_stripe_t;
+
+/*!
+ * Struct with metadata about the concurrent hash map.
+ */
+typedef struct {
+    bp_chashmap_stripe_t *_stripes; /*!< State of each stripe. */
+    uint8_t *_maps;                 /*!< Buffer with the slots and control bytes. */
+    size_t _map_size;               /*!< Size (in bytes) of the buffer of a stripe. */
+    size_t _ctrl_offset;     /*!< Offset of the control bytes in the buffer of a stripe. */
+    size_t _element_size;    /*!< Size (in bytes) of a single element. */
+    size_t _stripe_capacity; /*!< Number of slots of each stripe. */
+    size_t _nstripes;        /*!< Number of stripes. */
+    size_t _key_size;        /*!< Size (in bytes) of the key. */
+} bp_chashmap_t;
+
+/*!
+ * Insert an element. The element is copied to the hash map.
+ * @param map Reference to bp_chashmap.
+ * @param el Reference to the element, starting with its key.
+ * @return 0 on success.
+ * @return -ENODEV if the 'map' argument is NULL.
+ * @return -EINVAL if the 'el' argument is NULL, or if the capacity isn't valid.
+ * @return -EEXIST if there is an element with the same key.
+ * @return -ENOMEM if the stripe of the key is full.
+ */
+int bp_chashmap_insert(bp_chashmap_t *map, void *el);
+
+/*!
+ * Insert an element, or replace the element with the same key.
+ * @param map Reference to bp_chashmap.
+ * @param el Reference to the element, starting with its key.
+ * @return 0 on success.
+ * @return -ENODEV if the 'map' argument is NULL.
+ * @return -EINVAL if the 'el' argument is NULL, or if the capacity isn't valid.
+ * @return -ENOMEM if the stripe of the key is full.
+ */
+int bp_chashmap_put(bp_chashmap_t *map, void *el);
+
+/*!
+ * Find an element by its key and copy it out. Readers don't block each other, and
+ * they are never blocked by writers of other stripes. The probe and the copy may read a
+ * torn element while a writer changes the stripe, but then they are retried, so 'el' only
+ * receives a consistent element.
+ * @param map Reference to bp_chashmap.
+ * @param key Reference to the key.
+ * @param el [out] Buffer where the element will be copied to.
+ * @return 0 on success.
+ * @return -ENODEV if the 'map' argument is NULL.
+ * @return -EINVAL if the 'key' or the 'el' argument is NULL.
+ * @return -ENOENT if the key isn't found.
+ */
+int bp_chashmap_find(bp_chashmap_t *map, void *key, void *el);
+
+/*!
+ * Erase an element by its key.
+ * @param map Reference to bp_chashmap.
+ * @param key Reference to the key.
+ * @return 0 on success.
+ * @return -ENODEV if the 'map' argument is NULL.
+ * @return -EINVAL if the 'key' argument is NULL, or if the capacity isn't valid.
+ * @return -ENOENT if the key isn't found.
+ */
+int bp_chashmap_erase(bp_chashmap_t *map, void *key);
+
+/*!
+ * Remove all the elements, one stripe at a time.
+ * @param map Reference to bp_chashmap.
+ * @return 0 on success.
+ * @return -ENODEV if the 'map' argument is NULL.
+ */
+int bp_chashmap_clear(bp_chashmap_t *map);
+
+/*!
+ * Get the number of elements. With concurrent writers, it's only an estimate.
+ * @param map Reference to bp_chashmap.
+ * @return The number of elements.
+ * @return 0 if the 'map' argument is NULL.
+ */
+size_t bp_chashmap_size(bp_chashmap_t *map);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_CHASHMAP_H
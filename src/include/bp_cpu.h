@@ -0,0 +1,51 @@
+/*!
+ * @file bp_cpu.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Processor details used by the structures shared between threads: the cache line
+ * size and a spin hint. It doesn't depend on pthreads, so the lock-free structures can
+ * use it on any target.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_CPU_H
+#define BACKPACK_CPU_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Size (in bytes) of a cache line. Used to align the data shared by the threads.
+ */
+#define BP_CACHE_LINE_SIZE 64U
+
+/*!
+ * Align a type or a variable to 'n' bytes. It goes right after the 'struct' keyword, or
+ * before the declaration of a variable. 'n' must be a plain number, for MSVC.
+ */
+#if defined(_MSC_VER)
+#define BP_ALIGNED(n) __declspec(align(n))
+#else
+#define BP_ALIGNED(n) __attribute__((aligned(n)))
+#endif
+
+/*!
+ * Hint the processor that the thread is spinning, waiting for another thread.
+ */
+static inline void bp_cpu_relax(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_CPU_H
@@ -0,0 +1,156 @@
+/*!
+ * @file bp_hashmap.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies the hash map structure. The hash map is a fixed-capacity
+ * open-addressing table over a static buffer. Each slot has a control byte, which tells
+ * if the slot is empty, deleted or full, and in the last case keeps 7 bits of the key
+ * hash. The control bytes are probed in groups of BP_HASHMAP_GROUP_SIZE, so a lookup
+ * usually compares a single key. A zeroed buffer is an empty hash map.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_HASHMAP_H
+#define BACKPACK_HASHMAP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/*!
+ * Number of control bytes probed at once.
+ */
+#define BP_HASHMAP_GROUP_SIZE 16U
+
+/*!
+ * Declare the type of a hash map buffer, with the control bytes and the slots.
+ * @param type_ Type of the elements. The key must be the first member of the element.
+ * @param capacity_ Number of slots. Must be a power of two, not smaller than
+ * BP_HASHMAP_GROUP_SIZE. Up to 7/8 of the slots can be used.
+ */
+#define BP_HASHMAP_BUFFER(type_, capacity_)                                     \
+    struct {                                                                    \
+        uint8_t ctrl[(capacity_) + BP_HASHMAP_GROUP_SIZE];                      \
+        type_ slots[capacity_];                                                 \
+    }
+
+/*!
+ * Macro to initialize a bp_hashmap. The buffer must be zeroed, like any static buffer.
+ * @param buffer_ Buffer declared with BP_HASHMAP_BUFFER.
+ * @param key_size_ Size (in bytes) of the key, at the start of each element.
+ */
+#define BP_HASHMAP_INIT(buffer_, key_size_)                                          \
+    {                                                                                \
+        ._ctrl = (buffer_).ctrl, ._slots = (uint8_t *) (buffer_).slots,              \
+        ._element_size = sizeof((buffer_).slots[0]),                                 \
+        ._capacity = sizeof((buffer_).slots) / sizeof((buffer_).slots[0]),           \
+        ._key_size = (key_size_), ._size = 0, ._deleted = 0,                         \
+    }
+
+/*!
+ * Struct with metadata about the hash map.
+ */
+typedef struct {
+    uint8_t *_ctrl;       /*!< Control bytes, one per slot plus a mirror of the first group. */
+    uint8_t *_slots;      /*!< Reference to the buffer, where the elements are stored. */
+    size_t _element_size; /*!< Size (in bytes) of a single element. */
+    size_t _capacity;     /*!< Number of slots. */
+    size_t _key_size;     /*!< Size (in bytes) of the key. */
+    size_t _size;         /*!< Current number of elements. */
+    size_t _deleted;      /*!< Number of deleted slots. */
+} bp_hashmap_t;
+
+/*!
+ * Initialize a hash map over buffers allocated at runtime.
+ * @param map Reference to bp_hashmap.
+ * @param ctrl Buffer with 'capacity' + BP_HASHMAP_GROUP_SIZE control bytes. It's zeroed
+ * by this function.
+ * @param slots Buffer with 'capacity' elements.
+ * @param element_size Size (in bytes) of a single element.
+ * @param capacity Number of slots. Must be a power of two, not smaller than
+ * BP_HASHMAP_GROUP_SIZE.
+ * @param key_size Size (in bytes) of the key, at the start of each element.
+ * @return 0 on success.
+ * @return -ENODEV if the 'map' argument is NULL.
+ * @return -EINVAL if a buffer is NULL, if the capacity isn't valid or if the key is
+ * larger than the element.
+ */
+int bp_hashmap_init(bp_hashmap_t *map, uint8_t *ctrl, void *slots, size_t element_size,
+                    size_t capacity, size_t key_size);
+
+/*!
+ * Insert an element. The element is copied to the hash map.
+ * @param map Reference to bp_hashmap.
+ * @param el Reference to the element, starting with its key.
+ * @return 0 on success.
+ * @return -ENODEV if the 'map' argument is NULL.
+ * @return -EINVAL if the 'el' argument is NULL, or if the capacity isn't valid.
+ * @return -EEXIST if there is an element with the same key.
+ * @return -ENOMEM if the hash map is full.
+ */
+int bp_hashmap_insert(bp_hashmap_t *map, void *el);
+
+/*!
+ * Find an element by its key.
+ * @param map Reference to bp_hashmap.
+ * @param key Reference to the key.
+ * @return Reference to the element. Its value can be changed, but its key must not.
+ * @return NULL if the 'map' or 'key' argument is NULL, or if the key isn't found.
+ */
+void *bp_hashmap_find(bp_hashmap_t *map, void *key);
+
+/*!
+ * Erase an element by its key.
+ * @param map Reference to bp_hashmap.
+ * @param key Reference to the key.
+ * @return 0 on success.
+ * @return -ENODEV if the 'map' argument is NULL.
+ * @return -EINVAL if the 'key' argument is NULL.
+ * @return -ENOENT if the key isn't found.
+ */
+int bp_hashmap_erase(bp_hashmap_t *map, void *key);
+
+/*!
+ * Remove all the elements.
+ * @param map Reference to bp_hashmap.
+ * @return 0 on success.
+ * @return -ENODEV if the 'map' argument is NULL.
+ */
+int bp_hashmap_clear(bp_hashmap_t *map);
+
+/*!
+ * Get the number of elements.
+ * @param map Reference to bp_hashmap.
+ * @return The number of elements.
+ * @return 0 if the 'map' argument is NULL.
+ */
+size_t bp_hashmap_size(bp_hashmap_t *map);
+
+/*!
+ * Get the number of slots.
+ * @param map Reference to bp_hashmap.
+ * @return The number of slots.
+ * @return 0 if the 'map' argument is NULL.
+ */
+size_t bp_hashmap_capacity(bp_hashmap_t *map);
+
+/*!
+ * Get the hash used by the hash map for a key.
+ * @param key Reference to the key.
+ * @param key_size Size (in bytes) of the key.
+ * @return The hash of the key.
+ */
+uint64_t bp_hashmap_hash(const void *key, size_t key_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_HASHMAP_H
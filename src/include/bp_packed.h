@@ -0,0 +1,147 @@
+/*!
+ * @file bp_packed.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies the packed array structure. It stores unsigned integers of a fixed
+ * width, from 1 to 64 bits, one after the other without padding, so a 12-bit code takes
+ * 12 bits instead of 16.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_PACKED_H
+#define BACKPACK_PACKED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*!
+ * Get the number of uint64_t words of a packed array buffer. It includes an extra word
+ * at the end, so a value can always be read with a single unaligned load.
+ * @param capacity_ Maximum number of elements.
+ * @param bits_ Width of each element, in bits.
+ */
+#define BP_PACKED_WORDS(capacity_, bits_) (((capacity_) * (bits_) + 63U) / 64U + 1U)
+
+/*!
+ * Macro to initialize an empty packed array.
+ * @param buffer_ Array of uint64_t, declared with BP_PACKED_WORDS words. It must be
+ * zeroed, like any static buffer.
+ * @param bits_ Width of each element, in bits, from 1 to 64.
+ */
+#define BP_PACKED_INIT(buffer_, bits_)                                          \
+    {                                                                           \
+        ._words = (buffer_), ._bits = (bits_),                                  \
+        ._capacity = ((bits_) == 0 || (bits_) > 64U)                            \
+                         ? 0                                                    \
+                         : (sizeof(buffer_) / 8U - 1U) * 64U / (bits_),         \
+    }
+
+/*!
+ * Struct with metadata about the packed array.
+ */
+typedef struct {
+    uint64_t *_words; /*!< Reference to the buffer, where the bits are stored. */
+    size_t _bits;     /*!< Width of each element, in bits. */
+    size_t _capacity; /*!< Maximum number of elements. */
+    size_t _size;     /*!< Current number of elements. */
+} bp_packed_t;
+
+/*!
+ * Append an element.
+ * @param packed Reference to bp_packed.
+ * @param value The element.
+ * @return 0 on success.
+ * @return -ENODEV if the 'packed' argument is NULL.
+ * @return -EINVAL if the width isn't valid or if the value doesn't fit in it.
+ * @return -ENOMEM if the array is full.
+ */
+int bp_packed_push(bp_packed_t *packed, uint64_t value);
+
+/*!
+ * Append many elements at once. It packs a whole word at a time.
+ * @param packed Reference to bp_packed.
+ * @param values Reference to the elements.
+ * @param count Number of elements.
+ * @return 0 on success.
+ * @return -ENODEV if the 'packed' argument is NULL.
+ * @return -EINVAL if the 'values' argument is NULL, if the width isn't valid or if any
+ * value doesn't fit in it. Nothing is appended in this case.
+ * @return -ENOMEM if there isn't room for all the elements.
+ */
+int bp_packed_append(bp_packed_t *packed, const uint64_t *values, size_t count);
+
+/*!
+ * Get an element.
+ * @param packed Reference to bp_packed.
+ * @param idx Index of the element.
+ * @return The element.
+ * @return 0 if the 'packed' argument is NULL or if the index is out of the array.
+ */
+uint64_t bp_packed_get(bp_packed_t *packed, size_t idx);
+
+/*!
+ * Change an element.
+ * @param packed Reference to bp_packed.
+ * @param idx Index of the element.
+ * @param value The new value.
+ * @return 0 on success.
+ * @return -ENODEV if the 'packed' argument is NULL.
+ * @return -EINVAL if the index is out of the array or if the value doesn't fit in the
+ * width.
+ */
+int bp_packed_set(bp_packed_t *packed, size_t idx, uint64_t value);
+
+/*!
+ * Copy a range of elements to a buffer, unpacked as uint64_t.
+ * @param packed Reference to bp_packed.
+ * @param start Index of the first element.
+ * @param count Number of elements.
+ * @param out [out] Buffer with room for 'count' elements.
+ * @return 0 on success.
+ * @return -ENODEV if the 'packed' argument is NULL.
+ * @return -EINVAL if the 'out' argument is NULL or if the range is out of the array.
+ */
+int bp_packed_unpack(bp_packed_t *packed, size_t start, size_t count, uint64_t *out);
+
+/*!
+ * Copy a range of elements to a buffer, unpacked as uint32_t. It unpacks 8 elements at a
+ * time with AVX2 when the width is up to 25 bits.
+ * @param packed Reference to bp_packed.
+ * @param start Index of the first element.
+ * @param count Number of elements.
+ * @param out [out] Buffer with room for 'count' elements.
+ * @return 0 on success.
+ * @return -ENODEV if the 'packed' argument is NULL.
+ * @return -EINVAL if the 'out' argument is NULL, if the range is out of the array or if
+ * the width is greater than 32 bits.
+ */
+int bp_packed_unpack32(bp_packed_t *packed, size_t start, size_t count, uint32_t *out);
+
+/*!
+ * Remove all the elements.
+ * @param packed Reference to bp_packed.
+ * @return 0 on success.
+ * @return -ENODEV if the 'packed' argument is NULL.
+ */
+int bp_packed_clear(bp_packed_t *packed);
+
+/*!
+ * Get the number of elements.
+ * @param packed Reference to bp_packed.
+ * @return The number of elements.
+ * @return 0 if the 'packed' argument is NULL.
+ */
+size_t bp_packed_size(bp_packed_t *packed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_PACKED_H
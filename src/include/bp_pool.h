@@ -0,0 +1,173 @@
+/*!
+ * @file bp_pool.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies the pool structure. The pool hands out fixed-size blocks from a
+ * static buffer, in constant time. The indexes of the released blocks are kept in a
+ * bp_stack, so the last released block is the first to be reused, while it's still hot
+ * in the cache.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_POOL_H
+#define BACKPACK_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bp_array.h"
+#include "bp_cpu.h"
+#include "bp_ring.h"
+#include "bp_stack.h"
+
+/*!
+ * Alignment (in bytes) of the blocks of a buffer declared with BP_POOL_BUFFER. It's
+ * enough for any scalar type, like the one of BP_ARENA_ALIGN.
+ */
+#define BP_POOL_ALIGN 16U
+
+/*!
+ * Declare a buffer of blocks aligned to BP_POOL_ALIGN, so the containers carved out of
+ * them hand out aligned elements. It fails to compile if the block size isn't a multiple
+ * of BP_POOL_ALIGN.
+ * @param name_ Name of the buffer.
+ * @param nblocks_ Number of blocks.
+ * @param block_size_ Size (in bytes) of a block.
+ */
+#define BP_POOL_BUFFER(name_, nblocks_, block_size_)                            \
+    BP_ALIGNED(16)                                                              \
+    uint8_t name_[nblocks_][((block_size_) % BP_POOL_ALIGN == 0) ? (block_size_) : -1]
+
+/*!
+ * Evaluate to zero, failing to compile if a condition known at compile time is false.
+ * @param cond_ The condition.
+ */
+#define BP_POOL_CHECK(cond_) (0U * sizeof(char[(cond_) ? 1 : -1]))
+
+/*!
+ * Macro to initialize a bp_pool. It fails to compile if the free buffer isn't made of
+ * uint32_t, or if it has less elements than there are blocks.
+ * @param blocks_ Buffer with the blocks, declared with BP_POOL_BUFFER, or any
+ * two-dimensional buffer like uint8_t blocks[N][SIZE] if the blocks only hold bytes.
+ * @param free_buffer_ Buffer of uint32_t with (at least) one element per block, where the
+ * indexes of the released blocks are stored.
+ */
+#define BP_POOL_INIT(blocks_, free_buffer_)                                     \
+    {                                                                           \
+        ._blocks = (uint8_t *) (blocks_), ._block_size = sizeof((blocks_)[0]),  \
+        ._capacity = sizeof(blocks_) / sizeof((blocks_)[0]) +                   \
+                     BP_POOL_CHECK(sizeof((free_buffer_)[0]) == sizeof(uint32_t) && \
+                                   sizeof(free_buffer_) >=                      \
+                                       sizeof((free_buffer_)[0]) *              \
+                                           (sizeof(blocks_) / sizeof((blocks_)[0]))), \
+        ._next = 0, ._free = BP_STACK_INIT(free_buffer_),                       \
+    }
+
+/*!
+ * Struct with metadata about the pool.
+ */
+typedef struct {
+    uint8_t *_blocks;   /*!< Reference to the buffer, where the blocks are stored. */
+    size_t _block_size; /*!< Size (in bytes) of a single block. */
+    size_t _capacity;   /*!< Number of blocks in the pool. */
+    size_t _next;       /*!< Index of the first block never allocated. */
+    bp_stack_t _free;   /*!< Stack with the indexes (uint32_t) of the released blocks. */
+} bp_pool_t;
+
+/*!
+ * Allocate a block from the pool.
+ * @param pool Reference to bp_pool.
+ * @return A reference to the block.
+ * @return NULL if the 'pool' argument is NULL, or if there isn't any free block.
+ */
+void *bp_pool_alloc(bp_pool_t *pool);
+
+/*!
+ * Release a block back to the pool. Releasing a block twice isn't detected, unless it
+ * makes more blocks free than were ever allocated, and it hands the block to two owners.
+ * @param pool Reference to bp_pool.
+ * @param block Reference to the block, returned by bp_pool_alloc.
+ * @return 0 on success.
+ * @return -ENODEV if the 'pool' argument is NULL.
+ * @return -EFAULT if the 'block' argument isn't a block of the pool, or if every
+ * allocated block is already free.
+ */
+int bp_pool_free(bp_pool_t *pool, void *block);
+
+/*!
+ * Release all the blocks of the pool.
+ * @param pool Reference to bp_pool.
+ * @return 0 on success.
+ * @return -ENODEV if the 'pool' argument is NULL.
+ */
+int bp_pool_reset(bp_pool_t *pool);
+
+/*!
+ * Get the number of free blocks in the pool.
+ * @param pool Reference to bp_pool.
+ * @return The number of free blocks.
+ * @return 0 if the 'pool' argument is NULL.
+ */
+size_t bp_pool_available(bp_pool_t *pool);
+
+/*!
+ * Get the size of a single block of the pool.
+ * @param pool Reference to bp_pool.
+ * @return The size (in bytes) of a block.
+ * @return 0 if the 'pool' argument is NULL.
+ */
+size_t bp_pool_block_size(bp_pool_t *pool);
+
+/*!
+ * Initialize an empty array over a block of the pool. The array capacity is the number
+ * of elements that fit in a block. Release the block with bp_pool_free, passing the
+ * array buffer.
+ * @param pool Reference to bp_pool.
+ * @param array [out] Reference to the array.
+ * @param element_size Size (in bytes) of a single element.
+ * @return 0 on success.
+ * @return -ENODEV if the 'pool' or the 'array' argument is NULL.
+ * @return -EINVAL if the 'element_size' argument is zero, or larger than a block, or if
+ * the blocks aren't aligned for the elements (see BP_POOL_BUFFER).
+ * @return -ENOMEM if there isn't any free block.
+ */
+int bp_pool_array_init(bp_pool_t *pool, bp_array_t *array, size_t element_size);
+
+/*!
+ * Initialize an empty stack over a block of the pool. The stack capacity is the number
+ * of elements that fit in a block. Release the block with bp_pool_free, passing the
+ * stack buffer.
+ * @param pool Reference to bp_pool.
+ * @param stack [out] Reference to the stack.
+ * @param element_size Size (in bytes) of a single element.
+ * @return 0 on success.
+ * @return -ENODEV if the 'pool' or the 'stack' argument is NULL.
+ * @return -EINVAL if the 'element_size' argument is zero, or larger than a block, or if
+ * the blocks aren't aligned for the elements (see BP_POOL_BUFFER).
+ * @return -ENOMEM if there isn't any free block.
+ */
+int bp_pool_stack_init(bp_pool_t *pool, bp_stack_t *stack, size_t element_size);
+
+/*!
+ * Initialize an empty ring buffer over a block of the pool. The ring capacity is the
+ * number of elements that fit in a block. Release the block with bp_pool_free, passing
+ * the ring buffer.
+ * @param pool Reference to bp_pool.
+ * @param ring [out] Reference to the ring buffer.
+ * @param element_size Size (in bytes) of a single element.
+ * @return 0 on success.
+ * @return -ENODEV if the 'pool' or the 'ring' argument is NULL.
+ * @return -EINVAL if the 'element_size' argument is zero, or larger than a block, or if
+ * the blocks aren't aligned for the elements (see BP_POOL_BUFFER).
+ * @return -ENOMEM if there isn't any free block.
+ */
+int bp_pool_ring_init(bp_pool_t *pool, bp_ring_t *ring, size_t element_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_POOL_H
@@ -0,0 +1,131 @@
+/*!
+ * @file bp_prioq.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies the multi-level priority queue. Each priority level is a bp_ring, and
+ * a bitmap marks the levels that have elements, so the highest priority level is found
+ * with a single count of trailing zeros. Push and pop are O(1), and the elements of a
+ * level leave in the order they came in, as the ready queue of a scheduler.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_PRIOQ_H
+#define BACKPACK_PRIOQ_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bp_ring.h"
+
+/*!
+ * Maximum number of priority levels.
+ */
+#define BP_PRIOQ_MAX_LEVELS 64U
+
+/*!
+ * Macro to initialize an empty priority queue.
+ * @param levels_ Array of bp_ring_t, one for each level, with up to BP_PRIOQ_MAX_LEVELS
+ * rings. The level 0 has the highest priority. Each ring is initialized with BP_RING_INIT,
+ * so the levels may have different capacities, but all must have the same element size.
+ */
+#define BP_PRIOQ_INIT(levels_)                                                       \
+    {                                                                                \
+        ._levels = (levels_), ._nlevels = sizeof(levels_) / sizeof((levels_)[0]),    \
+        ._bitmap = 0, ._size = 0,                                                    \
+    }
+
+/*!
+ * Struct with metadata about the priority queue.
+ */
+typedef struct {
+    bp_ring_t *_levels; /*!< Ring of each level. */
+    size_t _nlevels;    /*!< Number of levels. */
+    uint64_t _bitmap;   /*!< Bit i is set if the level i has elements. */
+    size_t _size;       /*!< Number of elements in all the levels. */
+} bp_prioq_t;
+
+/*!
+ * Push an element at the end of its level. It never replaces an element.
+ * @param queue Reference to bp_prioq.
+ * @param level Priority level of the element. The level 0 has the highest priority.
+ * @param el Reference to the element to be pushed.
+ * @return 0 on success.
+ * @return -ENODEV if the 'queue' or the 'el' argument is NULL.
+ * @return -EINVAL if the level doesn't exist.
+ * @return -ENOMEM if the ring of the level is full.
+ */
+int bp_prioq_push(bp_prioq_t *queue, size_t level, void *el);
+
+/*!
+ * Get the oldest element of the highest priority level.
+ * @param queue Reference to bp_prioq.
+ * @param level [out] Level of the element. It can be NULL.
+ * @return A reference to the element.
+ * @return NULL if the 'queue' argument is NULL or if the queue is empty.
+ */
+void *bp_prioq_peek(bp_prioq_t *queue, size_t *level);
+
+/*!
+ * Remove the oldest element of the highest priority level and put it in el argument
+ * variable.
+ * @param queue Reference to bp_prioq.
+ * @param el [out] Reference to a variable where the removed element will be put. It can
+ * be NULL.
+ * @param level [out] Level of the element. It can be NULL.
+ * @return 0 on success.
+ * @return -ENODEV if the 'queue' argument is NULL.
+ * @return -ENOENT if the queue is empty.
+ */
+int bp_prioq_pop(bp_prioq_t *queue, void *el, size_t *level);
+
+/*!
+ * Remove the oldest element of a given level and put it in el argument variable.
+ * @param queue Reference to bp_prioq.
+ * @param level The level.
+ * @param el [out] Reference to a variable where the removed element will be put. It can
+ * be NULL.
+ * @return 0 on success.
+ * @return -ENODEV if the 'queue' argument is NULL.
+ * @return -EINVAL if the level doesn't exist.
+ * @return -ENOENT if the level is empty.
+ */
+int bp_prioq_pop_level(bp_prioq_t *queue, size_t level, void *el);
+
+/*!
+ * Drop all elements in the priority queue.
+ * @param queue Reference to bp_prioq.
+ * @return 0 on success.
+ * @return -ENODEV if the 'queue' argument is NULL.
+ */
+int bp_prioq_clear(bp_prioq_t *queue);
+
+/*!
+ * Get the number of elements in all the levels.
+ * @param queue Reference to bp_prioq.
+ * @return The number of elements.
+ * @return 0 if the 'queue' argument is NULL.
+ */
+size_t bp_prioq_size(bp_prioq_t *queue);
+
+/*!
+ * Get the number of elements in a level.
+ * @param queue Reference to bp_prioq.
+ * @param level The level.
+ * @return The number of elements.
+ * @return 0 if the 'queue' argument is NULL or if the level doesn't exist.
+ */
+size_t bp_prioq_level_size(bp_prioq_t *queue, size_t level);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_PRIOQ_H
@@ -0,0 +1,128 @@
+/*!
+ * @file bp_quantile.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies the sliding window quantile estimator. The samples are quantized into
+ * equal-width buckets over a fixed range, and the last N bucket indices are kept in a
+ * bp_ring. A Fenwick tree holds the count of each bucket, so adding a sample, evicting the
+ * oldest one and finding the bucket of a quantile are all O(log buckets), without sorting
+ * or copying the window. The answer is off by at most half a bucket width.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_QUANTILE_H
+#define BACKPACK_QUANTILE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bp_ring.h"
+
+/*!
+ * Declare the type of a quantile estimator buffer.
+ * @param window_ Number of samples in a full window.
+ * @param buckets_ Number of buckets. It must be a power of two, or the declaration fails
+ * to compile.
+ */
+#define BP_QUANTILE_BUFFER(window_, buckets_)                                   \
+    struct {                                                                    \
+        uint32_t samples[window_];                                              \
+        uint32_t tree[(buckets_) +                                              \
+                      0U * sizeof(char[((buckets_) > 0 &&                       \
+                                        ((buckets_) & ((buckets_) - 1U)) == 0)  \
+                                           ? 1                                  \
+                                           : -1])];                             \
+    }
+
+/*!
+ * Macro to initialize an empty quantile estimator.
+ * @param buffer_ Buffer declared with BP_QUANTILE_BUFFER. It must be zeroed, like any
+ * static buffer.
+ * @param lo_ Lower edge of the first bucket. Smaller samples count in the first bucket.
+ * @param hi_ Upper edge of the last bucket. Larger samples count in the last bucket.
+ */
+#define BP_QUANTILE_INIT(buffer_, lo_, hi_)                                      \
+    {                                                                            \
+        ._samples = BP_RING_INIT((buffer_).samples), ._tree = (buffer_).tree,    \
+        ._buckets = sizeof((buffer_).tree) / sizeof((buffer_).tree[0]),          \
+        ._lo = (lo_), ._hi = (hi_),                                              \
+    }
+
+/*!
+ * Struct with metadata about the quantile estimator.
+ */
+typedef struct {
+    bp_ring_t _samples; /*!< Bucket of each sample in the window, as uint32_t. */
+    uint32_t *_tree;    /*!< Fenwick tree with the count of each bucket. */
+    size_t _buckets;    /*!< Number of buckets. */
+    double _lo;         /*!< Lower edge of the first bucket. */
+    double _hi;         /*!< Upper edge of the last bucket. */
+} bp_quantile_t;
+
+/*!
+ * Check the configuration given to BP_QUANTILE_INIT. Call it once after the
+ * initialization: the other functions trust it.
+ * @param quantile Reference to bp_quantile.
+ * @return 0 on success.
+ * @return -ENODEV if the 'quantile' argument is NULL.
+ * @return -EINVAL if the number of buckets isn't a power of two, or if the range is empty,
+ * isn't finite or is too wide for its width to be finite.
+ */
+int bp_quantile_check(bp_quantile_t *quantile);
+
+/*!
+ * Push a sample into the window. If the window is full, its oldest sample leaves it.
+ * @param quantile Reference to bp_quantile.
+ * @param value The sample.
+ * @return 0 on success.
+ * @return -ENODEV if the 'quantile' argument is NULL.
+ * @return -EINVAL if the sample is NaN or infinite.
+ */
+int bp_quantile_push(bp_quantile_t *quantile, double value);
+
+/*!
+ * Estimate many quantiles of the samples in the window. The quantile 'q' is the sample
+ * with rank round(q * (size - 1)), as in bp_array_percentiles, and the estimate is the
+ * middle of its bucket.
+ * @param quantile Reference to bp_quantile.
+ * @param quantiles The quantiles, between 0.0 and 1.0, in any order.
+ * @param count Number of quantiles.
+ * @param out [out] Buffer with 'count' positions, where the estimate of each quantile
+ * will be put.
+ * @return 0 on success.
+ * @return -ENODEV if the 'quantile', the 'quantiles' or the 'out' argument is NULL.
+ * @return -EINVAL if a quantile isn't between 0.0 and 1.0.
+ * @return -ENOENT if the window is empty.
+ */
+int bp_quantile_query(bp_quantile_t *quantile, const double *quantiles, size_t count,
+                      double *out);
+
+/*!
+ * Drop all samples in the window.
+ * @param quantile Reference to bp_quantile.
+ * @return 0 on success.
+ * @return -ENODEV if the 'quantile' argument is NULL.
+ */
+int bp_quantile_clear(bp_quantile_t *quantile);
+
+/*!
+ * Get the number of samples in the window.
+ * @param quantile Reference to bp_quantile.
+ * @return The number of samples.
+ * @return 0 if the 'quantile' argument is NULL.
+ */
+size_t bp_quantile_size(bp_quantile_t *quantile);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_QUANTILE_H
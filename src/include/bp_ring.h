@@ -3,7 +3,9 @@
  * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
  * @brief Specifies the ring structure. This structure works as a circular buffer. When
  * the buffer is in its maximum capacity, and a new element need be pushed into the
- * buffer, the oldest element is replaced by the new element.
+ * buffer, the oldest element is replaced by the new element. The ring can also be used as
+ * a double-ended queue, pushing and popping at both ends; those functions fail when the
+ * ring is full instead of replacing elements.
  * @version 0.1.0
  * @date 19/09/2021
  *
@@ -20,6 +22,7 @@ extern "C" {
 #include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
+#include "bp_block.h"
 #include "bp_iter.h"
 #include "bp_iter2.h"
 
@@ -88,6 +91,86 @@ void *bp_ring_peek(bp_ring_t *ring);
  */
 int bp_ring_pop(bp_ring_t *ring, void *el);
 
+/*!
+ * Push an element at the start (at tail) of the ring buffer, before the oldest element.
+ * Unlike bp_ring_push, it never replaces an element.
+ * @param ring Reference to bp_ring.
+ * @param el Reference to the element to be pushed.
+ * @return 0 on success.
+ * @return -ENODEV if the 'ring' or the 'el' argument is NULL.
+ * @return -ENOMEM if the ring is full.
+ */
+int bp_ring_push_front(bp_ring_t *ring, void *el);
+
+/*!
+ * Get the newest element (before head) in the ring buffer.
+ * @param ring Reference to bp_ring.
+ * @return A reference to the newest element.
+ * @return NULL if the 'ring' argument is NULL or if the ring is empty.
+ */
+void *bp_ring_peek_back(bp_ring_t *ring);
+
+/*!
+ * Remove the newest element (before head) of the ring buffer and put it in el argument
+ * variable.
+ * @param ring Reference to bp_ring.
+ * @param el [out] Reference to a variable where the removed element will be put. It can
+ * be NULL.
+ * @return 0 on success.
+ * @return -ENODEV if the 'ring' argument is NULL.
+ * @return -ENOENT if the ring is empty.
+ */
+int bp_ring_pop_back(bp_ring_t *ring, void *el);
+
+/*!
+ * Push a sequence of elements at the end (at head) of the ring buffer. Either all the
+ * elements are pushed or none is, so no element is ever replaced.
+ * @param ring Reference to bp_ring.
+ * @param els Reference to the elements to be pushed. The last one becomes the newest.
+ * @param count Number of elements.
+ * @return 0 on success.
+ * @return -ENODEV if the 'ring' or the 'els' argument is NULL.
+ * @return -ENOMEM if there isn't room for 'count' elements.
+ */
+int bp_ring_push_back_n(bp_ring_t *ring, const void *els, size_t count);
+
+/*!
+ * Push a sequence of elements at the start (at tail) of the ring buffer. Either all the
+ * elements are pushed or none is, so no element is ever replaced.
+ * @param ring Reference to bp_ring.
+ * @param els Reference to the elements to be pushed. The first one becomes the oldest, so
+ * their order is kept in the ring.
+ * @param count Number of elements.
+ * @return 0 on success.
+ * @return -ENODEV if the 'ring' or the 'els' argument is NULL.
+ * @return -ENOMEM if there isn't room for 'count' elements.
+ */
+int bp_ring_push_front_n(bp_ring_t *ring, const void *els, size_t count);
+
+/*!
+ * Remove the 'count' oldest elements of the ring buffer.
+ * @param ring Reference to bp_ring.
+ * @param els [out] Reference to a buffer for 'count' elements, oldest first. It can be
+ * NULL.
+ * @param count Number of elements.
+ * @return 0 on success.
+ * @return -ENODEV if the 'ring' argument is NULL.
+ * @return -ENOENT if the ring has less than 'count' elements. Nothing is removed.
+ */
+int bp_ring_pop_front_n(bp_ring_t *ring, void *els, size_t count);
+
+/*!
+ * Remove the 'count' newest elements of the ring buffer.
+ * @param ring Reference to bp_ring.
+ * @param els [out] Reference to a buffer for 'count' elements. They are put in the ring
+ * order, so the newest element is the last one. It can be NULL.
+ * @param count Number of elements.
+ * @return 0 on success.
+ * @return -ENODEV if the 'ring' argument is NULL.
+ * @return -ENOENT if the ring has less than 'count' elements. Nothing is removed.
+ */
+int bp_ring_pop_back_n(bp_ring_t *ring, void *els, size_t count);
+
 /*!
  * Find the index of an element, based at some parameter related to the element. This
  * parameter could be the element itself, or some field of its type. The match will be
@@ -116,6 +199,23 @@ size_t bp_ring_find_idx(bp_ring_t *ring, void *param, bool (*cmp)(void *el, void
  */
 void *bp_ring_find(bp_ring_t *ring, void *param, bool (*cmp)(void *el, void *param));
 
+/*!
+ * Find the index of an element, using a block predicate. Instead of calling the compare
+ * function for each element, the cmp function receives up to BP_BLOCK_SIZE contiguous
+ * elements and returns a mask with the matches. A block never crosses the end of the
+ * buffer, so the elements passed to cmp are always contiguous in memory. If the cmp
+ * function pointer argument is null, then the elements will be compared with the
+ * parameter byte by byte.
+ * @param ring Reference to bp_ring.
+ * @param param Reference to the parameter used to compare elements.
+ * @param cmp Function to compare a block of elements with the parameter passed at
+ * argument param.
+ * @return The index (starting from the oldest element) of the first found element.
+ * @return BP_RING_INVALID_INDEX if the element wasn't found or if the 'ring' or the
+ * 'param' argument is NULL.
+ */
+size_t bp_ring_find_block(bp_ring_t *ring, void *param, bp_block_cmp_t cmp);
+
 /*!
  * Drop all elements in the ring buffer.
  *
@@ -0,0 +1,160 @@
+/*!
+ * @file bp_slotmap.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies the slot map structure. The elements are kept packed in a bp_array,
+ * and found by stable handles through a sparse index of slots. Each slot has a
+ * generation counter, so a handle to a deleted element is never valid again, even when
+ * its slot is reused. Insert, delete and lookup are O(1).
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_SLOTMAP_H
+#define BACKPACK_SLOTMAP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "bp_array.h"
+#include "bp_iter.h"
+
+/*!
+ * Handle of an element. It packs the generation of the slot in the upper 32 bits and the
+ * slot index in the lower 32 bits.
+ */
+typedef uint64_t bp_slotmap_handle_t;
+
+/*!
+ * Handle that never refers to an element.
+ */
+#define BP_SLOTMAP_INVALID_HANDLE ((bp_slotmap_handle_t) 0)
+
+/*!
+ * Entry of the sparse index.
+ */
+typedef struct {
+    uint32_t idx; /*!< Index of the element in the dense array, or the next free slot
+                       plus one. */
+    uint32_t gen; /*!< Generation of the slot. It's odd while the slot is in use. */
+} bp_slotmap_slot_t;
+
+/*!
+ * Declare the type of a slot map buffer.
+ * @param type_ Type of the elements.
+ * @param capacity_ Maximum number of elements.
+ */
+#define BP_SLOTMAP_BUFFER(type_, capacity_)                                     \
+    struct {                                                                    \
+        type_ dense[capacity_];                                                 \
+        uint32_t owners[capacity_];                                             \
+        bp_slotmap_slot_t slots[capacity_];                                     \
+    }
+
+/*!
+ * Macro to initialize an empty slot map.
+ * @param buffer_ Buffer declared with BP_SLOTMAP_BUFFER. It must be zeroed, like any
+ * static buffer.
+ */
+#define BP_SLOTMAP_INIT(buffer_)                                                \
+    {                                                                           \
+        ._dense = BP_ARRAY_INIT((buffer_).dense), ._owners = (buffer_).owners,  \
+        ._slots = (buffer_).slots,                                              \
+    }
+
+/*!
+ * Struct with metadata about the slot map.
+ */
+typedef struct {
+    bp_array_t _dense;         /*!< Packed elements. */
+    uint32_t *_owners;         /*!< Slot of each element in the dense array. */
+    bp_slotmap_slot_t *_slots; /*!< Sparse index, from slots to elements. */
+    size_t _used;              /*!< Number of slots ever used. */
+    uint32_t _free;            /*!< First slot of the free list plus one, or zero. */
+} bp_slotmap_t;
+
+/*!
+ * Insert an element at the end of the dense array.
+ * @param map Reference to bp_slotmap.
+ * @param el Reference to the element.
+ * @param handle [out] Handle of the new element. It can be NULL.
+ * @return 0 on success.
+ * @return -ENODEV if the 'map' argument is NULL.
+ * @return -EINVAL if the 'el' argument is NULL.
+ * @return -ENOMEM if the slot map is full.
+ */
+int bp_slotmap_insert(bp_slotmap_t *map, void *el, bp_slotmap_handle_t *handle);
+
+/*!
+ * Get an element by its handle.
+ * @param map Reference to bp_slotmap.
+ * @param handle Handle of the element.
+ * @return Reference to the element. It's valid until the next insert or delete.
+ * @return NULL if the 'map' argument is NULL or if the handle isn't valid.
+ */
+void *bp_slotmap_get(bp_slotmap_t *map, bp_slotmap_handle_t handle);
+
+/*!
+ * Check if a handle refers to an element.
+ * @param map Reference to bp_slotmap.
+ * @param handle Handle of the element.
+ * @return true if the handle is valid, false otherwise.
+ */
+bool bp_slotmap_contains(bp_slotmap_t *map, bp_slotmap_handle_t handle);
+
+/*!
+ * Delete an element by its handle. The last element of the dense array is moved to its
+ * place, so the order of the elements isn't kept.
+ * @param map Reference to bp_slotmap.
+ * @param handle Handle of the element.
+ * @return 0 on success.
+ * @return -ENODEV if the 'map' argument is NULL.
+ * @return -ENOENT if the handle isn't valid.
+ */
+int bp_slotmap_del(bp_slotmap_t *map, bp_slotmap_handle_t handle);
+
+/*!
+ * Get the handle of an element of the dense array, as returned by the iterator.
+ * @param map Reference to bp_slotmap.
+ * @param el Reference to the element, inside the dense array.
+ * @return Handle of the element.
+ * @return BP_SLOTMAP_INVALID_HANDLE if any argument is NULL or if 'el' isn't an element
+ * of the slot map.
+ */
+bp_slotmap_handle_t bp_slotmap_handle_of(bp_slotmap_t *map, void *el);
+
+/*!
+ * Remove all the elements. Every handle becomes invalid.
+ * @param map Reference to bp_slotmap.
+ * @return 0 on success.
+ * @return -ENODEV if the 'map' argument is NULL.
+ */
+int bp_slotmap_clear(bp_slotmap_t *map);
+
+/*!
+ * Get the number of elements.
+ * @param map Reference to bp_slotmap.
+ * @return The number of elements.
+ * @return 0 if the 'map' argument is NULL.
+ */
+size_t bp_slotmap_size(bp_slotmap_t *map);
+
+/*!
+ * Get an iterator over the packed elements.
+ * @param map Reference to bp_slotmap.
+ * @return Iterator to the slot map. The slot map must not be changed while iterating.
+ */
+bp_iter_t bp_slotmap_iter(bp_slotmap_t *map);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_SLOTMAP_H
@@ -0,0 +1,205 @@
+/*!
+ * @file bp_soa.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies the structure-of-arrays. The structure-of-arrays stores records with
+ * many fields, like a bp_array of structs, but each field is stored in its own buffer
+ * (column). Scans that read a single field only bring that column to the cache.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_SOA_H
+#define BACKPACK_SOA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include "bp_array.h"
+
+/*!
+ * Invalid index, returned when an element isn't found.
+ */
+#define BP_SOA_INVALID_INDEX BP_ARRAY_INVALID_INDEX
+
+/*!
+ * Macro to describe a field of the record.
+ * @param type_ Type of the record.
+ * @param member_ Member of the record.
+ */
+#define BP_SOA_FIELD(type_, member_)                                            \
+    {                                                                           \
+        .offset = offsetof(type_, member_), .size = sizeof(((type_ *) 0)->member_), \
+    }
+
+/*!
+ * Macro to initialize a bp_soa.
+ * @param type_ Type of the record.
+ * @param fields_ Array of bp_soa_field_t, describing each field of the record.
+ * @param columns_ Array with one buffer per field, in the same order of 'fields_'.
+ * @param capacity_ Maximum number of records. Each column must hold this number of
+ * elements of its field.
+ */
+#define BP_SOA_INIT(type_, fields_, columns_, capacity_)                        \
+    {                                                                           \
+        ._fields = (fields_), ._columns = (columns_),                           \
+        ._nfields = sizeof(fields_) / sizeof((fields_)[0]),                     \
+        ._record_size = sizeof(type_), ._capacity = (capacity_), ._size = 0,    \
+    }
+
+/*!
+ * Description of a field of the record.
+ */
+typedef struct {
+    size_t offset; /*!< Offset (in bytes) of the field in the record. */
+    size_t size;   /*!< Size (in bytes) of the field. */
+} bp_soa_field_t;
+
+/*!
+ * Struct with metadata about the structure-of-arrays.
+ */
+typedef struct {
+    const bp_soa_field_t *_fields; /*!< Description of each field of the record. */
+    void *const *_columns;         /*!< Buffer of each field. */
+    size_t _nfields;               /*!< Number of fields of the record. */
+    size_t _record_size;           /*!< Size (in bytes) of the whole record. */
+    size_t _capacity;              /*!< Maximum number of records. */
+    size_t _size;                  /*!< Current number of records. */
+} bp_soa_t;
+
+/*!
+ * Check the description of the fields against the record type given to BP_SOA_INIT.
+ * Call it once after the initialization: the other functions trust the fields, and a
+ * field that doesn't fit inside the record makes them copy past it.
+ * @param soa Reference to bp_soa.
+ * @return 0 on success.
+ * @return -ENODEV if the 'soa' argument is NULL.
+ * @return -EINVAL if a field doesn't fit inside the record.
+ */
+int bp_soa_check(bp_soa_t *soa);
+
+/*!
+ * Push a record to the end of the structure-of-arrays, scattering its fields into the
+ * columns.
+ * @param soa Reference to bp_soa.
+ * @param record Reference to the record.
+ * @return 0 on success.
+ * @return -ENODEV if the 'soa' argument is NULL.
+ * @return -EINVAL if the 'record' argument is NULL.
+ * @return -ENOMEM if the structure-of-arrays is full.
+ */
+int bp_soa_push(bp_soa_t *soa, const void *record);
+
+/*!
+ * Get a record, gathering its fields from the columns.
+ * @param soa Reference to bp_soa.
+ * @param idx Index of the record.
+ * @param record [out] Reference to the record.
+ * @return 0 on success.
+ * @return -ENODEV if the 'soa' argument is NULL.
+ * @return -EINVAL if the 'record' argument is NULL.
+ * @return -EFAULT if the index is out of range.
+ */
+int bp_soa_get(bp_soa_t *soa, size_t idx, void *record);
+
+/*!
+ * Get a reference to a single field of a record.
+ * @param soa Reference to bp_soa.
+ * @param idx Index of the record.
+ * @param field Index of the field.
+ * @return Reference to the field.
+ * @return NULL if the 'soa' argument is NULL, or if the index or the field is out of
+ * range.
+ */
+void *bp_soa_get_field(bp_soa_t *soa, size_t idx, size_t field);
+
+/*!
+ * Delete a record, keeping the order of the remaining records.
+ * @param soa Reference to bp_soa.
+ * @param idx Index of the record.
+ * @return 0 on success.
+ * @return -ENODEV if the 'soa' argument is NULL.
+ * @return -EFAULT if the index is out of range.
+ */
+int bp_soa_del(bp_soa_t *soa, size_t idx);
+
+/*!
+ * Get a read-only bp_array view over a column. The view shares the column buffer, so it
+ * must not be changed, or the columns get out of sync.
+ * @param soa Reference to bp_soa.
+ * @param field Index of the field.
+ * @param view [out] Reference to the array view.
+ * @return 0 on success.
+ * @return -ENODEV if the 'soa' or the 'view' argument is NULL.
+ * @return -EINVAL if the field is out of range.
+ */
+int bp_soa_column(bp_soa_t *soa, size_t field, bp_array_t *view);
+
+/*!
+ * Find the first record whose field satisfies a condition. Only the field column is
+ * read.
+ * @param soa Reference to bp_soa.
+ * @param field Index of the field.
+ * @param param Parameter to the compare function.
+ * @param cmp Compare function. Called with a reference to the field of each record. If
+ * it's NULL, the field is compared byte to byte with 'param'.
+ * @return Index of the record.
+ * @return BP_SOA_INVALID_INDEX if the 'soa' argument is NULL, if the field is out of
+ * range or if there isn't any record that satisfies the condition.
+ */
+size_t bp_soa_find_idx(bp_soa_t *soa, size_t field, void *param,
+                       bool (*cmp)(void *el, void *param));
+
+/*!
+ * Find the first record whose field satisfies a condition, comparing a block of
+ * fields per call. See bp_array_find_block.
+ * @param soa Reference to bp_soa.
+ * @param field Index of the field.
+ * @param param Parameter to the compare function.
+ * @param cmp Block compare function. If it's NULL, the field is compared byte to byte
+ * with 'param'.
+ * @return Index of the record.
+ * @return BP_SOA_INVALID_INDEX if the 'soa' argument is NULL, if the field is out of
+ * range or if there isn't any record that satisfies the condition.
+ */
+size_t bp_soa_find_block(bp_soa_t *soa, size_t field, void *param, bp_block_cmp_t cmp);
+
+/*!
+ * Fold a column into an accumulator, calling a function with each field, in order. Only
+ * the field column is read.
+ * @param soa Reference to bp_soa.
+ * @param field Index of the field.
+ * @param acc Reference to the accumulator, with its initial value.
+ * @param fn Function that combines the accumulator with a field.
+ * @return 0 on success.
+ * @return -ENODEV if the 'soa' argument is NULL.
+ * @return -EINVAL if the field is out of range, or if the 'acc' or the 'fn' argument is
+ * NULL.
+ */
+int bp_soa_reduce(bp_soa_t *soa, size_t field, void *acc,
+                  void (*fn)(void *acc, void *el));
+
+/*!
+ * Remove all the records.
+ * @param soa Reference to bp_soa.
+ * @return 0 on success.
+ * @return -ENODEV if the 'soa' argument is NULL.
+ */
+int bp_soa_clear(bp_soa_t *soa);
+
+/*!
+ * Get the number of records.
+ * @param soa Reference to bp_soa.
+ * @return The number of records.
+ * @return 0 if the 'soa' argument is NULL.
+ */
+size_t bp_soa_size(bp_soa_t *soa);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_SOA_H
@@ -0,0 +1,124 @@
+/*!
+ * @file bp_sparse_set.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies the sparse set structure. It's a set of small integer IDs, kept
+ * packed in a dense array, with a sparse array mapping each ID to its place in the dense
+ * one. Add, remove, contains and clear are O(1), and the iteration only visits the
+ * members.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_SPARSE_SET_H
+#define BACKPACK_SPARSE_SET_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "bp_array.h"
+#include "bp_iter.h"
+
+/*!
+ * Declare the type of a sparse set buffer.
+ * @param capacity_ Maximum number of members.
+ * @param universe_ Number of possible IDs. The IDs go from 0 to universe_ - 1.
+ */
+#define BP_SPARSE_SET_BUFFER(capacity_, universe_)                              \
+    struct {                                                                    \
+        uint32_t dense[capacity_];                                              \
+        uint32_t sparse[universe_];                                             \
+    }
+
+/*!
+ * Macro to initialize an empty sparse set.
+ * @param buffer_ Buffer declared with BP_SPARSE_SET_BUFFER. Unlike the other static
+ * buffers, it doesn't need to be zeroed.
+ */
+#define BP_SPARSE_SET_INIT(buffer_)                                             \
+    {                                                                           \
+        ._dense = BP_ARRAY_INIT((buffer_).dense), ._sparse = (buffer_).sparse,  \
+        ._universe = sizeof((buffer_).sparse) / sizeof((buffer_).sparse[0]),    \
+    }
+
+/*!
+ * Struct with metadata about the sparse set.
+ */
+typedef struct {
+    bp_array_t _dense;  /*!< Packed members, as uint32_t. */
+    uint32_t *_sparse;  /*!< Index of each ID in the dense array. */
+    size_t _universe;   /*!< Number of possible IDs. */
+} bp_sparse_set_t;
+
+/*!
+ * Add an ID to the set.
+ * @param set Reference to bp_sparse_set.
+ * @param id ID to be added.
+ * @return 0 on success.
+ * @return -ENODEV if the 'set' argument is NULL.
+ * @return -EINVAL if the ID is out of the universe.
+ * @return -EEXIST if the ID is already in the set.
+ * @return -ENOMEM if the set is full.
+ */
+int bp_sparse_set_add(bp_sparse_set_t *set, uint32_t id);
+
+/*!
+ * Remove an ID from the set. The last member of the dense array is moved to its place.
+ * @param set Reference to bp_sparse_set.
+ * @param id ID to be removed.
+ * @return 0 on success.
+ * @return -ENODEV if the 'set' argument is NULL.
+ * @return -ENOENT if the ID isn't in the set.
+ */
+int bp_sparse_set_remove(bp_sparse_set_t *set, uint32_t id);
+
+/*!
+ * Check if an ID is in the set.
+ * @param set Reference to bp_sparse_set.
+ * @param id ID to be checked.
+ * @return true if the ID is in the set, false otherwise or if the 'set' argument is NULL.
+ */
+bool bp_sparse_set_contains(bp_sparse_set_t *set, uint32_t id);
+
+/*!
+ * Remove all the members. It doesn't touch the buffers.
+ * @param set Reference to bp_sparse_set.
+ * @return 0 on success.
+ * @return -ENODEV if the 'set' argument is NULL.
+ */
+int bp_sparse_set_clear(bp_sparse_set_t *set);
+
+/*!
+ * Get the number of members.
+ * @param set Reference to bp_sparse_set.
+ * @return The number of members.
+ * @return 0 if the 'set' argument is NULL.
+ */
+size_t bp_sparse_set_size(bp_sparse_set_t *set);
+
+/*!
+ * Get the members, packed in the dense array.
+ * @param set Reference to bp_sparse_set.
+ * @return Reference to the first member. There are bp_sparse_set_size members.
+ * @return NULL if the 'set' argument is NULL.
+ */
+const uint32_t *bp_sparse_set_data(bp_sparse_set_t *set);
+
+/*!
+ * Get an iterator over the members. Each element is a uint32_t.
+ * @param set Reference to bp_sparse_set.
+ * @return Iterator to the sparse set. The set must not be changed while iterating.
+ */
+bp_iter_t bp_sparse_set_iter(bp_sparse_set_t *set);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_SPARSE_SET_H
@@ -0,0 +1,115 @@
+/*!
+ * @file bp_thread_pool.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies a small worker pool, based on pthreads. The pool runs the same job
+ * on all of its workers, and the caller thread works as the first worker. The workers
+ * split the job among themselves, so the pool is used by the parallel algorithms of
+ * the library.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_THREAD_POOL_H
+#define BACKPACK_THREAD_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bp_cpu.h"
+
+/*!
+ * Maximum number of workers in a pool, including the caller thread.
+ */
+#define BP_THREAD_POOL_MAX_THREADS 64U
+
+/*!
+ * Type for the job executed by the workers. Each worker receives its index, from 0 up
+ * to 'nworkers' - 1. The worker 0 is always the caller thread.
+ */
+typedef void (*bp_thread_pool_job_t)(void *arg, size_t worker, size_t nworkers);
+
+struct bp_thread_pool;
+
+/*!
+ * Struct with the arguments of a worker thread.
+ */
+typedef struct {
+    struct bp_thread_pool *_pool; /*!< Reference to the pool of the worker. */
+    size_t _idx;                  /*!< Index of the worker in the pool. */
+} bp_thread_pool_worker_t;
+
+/*!
+ * Struct with metadata about the worker pool.
+ */
+typedef struct bp_thread_pool {
+    pthread_t _threads[BP_THREAD_POOL_MAX_THREADS]; /*!< Threads of the workers. */
+    bp_thread_pool_worker_t
+        _workers[BP_THREAD_POOL_MAX_THREADS]; /*!< Arguments of each worker thread. */
+    size_t _size;           /*!< Number of workers, including the caller thread. */
+    pthread_mutex_t _lock;  /*!< Lock for the fields below. */
+    pthread_cond_t _start;  /*!< Signaled when a new job is available. */
+    pthread_cond_t _done;   /*!< Signaled when the last worker finishes a job. */
+    bp_thread_pool_job_t _job; /*!< Current job. */
+    void *_arg;             /*!< Argument of the current job. */
+    size_t _generation;     /*!< Counter of submitted jobs. */
+    size_t _running;        /*!< Number of threads still running the current job. */
+    bool _stop;             /*!< Request the threads to exit. */
+} bp_thread_pool_t;
+
+/*!
+ * Start the worker threads of the pool.
+ * @param pool Reference to the pool.
+ * @param nthreads Number of workers, including the caller thread. If it's zero, then
+ * the number of online processors is used.
+ * @return 0 on success.
+ * @return -ENODEV if the 'pool' argument is NULL.
+ * @return -EINVAL if 'nthreads' is greater than BP_THREAD_POOL_MAX_THREADS.
+ * @return A negative errno if a thread could not be created.
+ */
+int bp_thread_pool_init(bp_thread_pool_t *pool, size_t nthreads);
+
+/*!
+ * Run a job on all workers of the pool and wait for them to finish it. The caller
+ * thread runs the job as the worker 0.
+ *
+ * @warning The pool runs one job at time. This function must not be called by two
+ * threads at the same time, nor from inside a job.
+ *
+ * @param pool Reference to the pool.
+ * @param job Function executed by each worker.
+ * @param arg Argument passed to the job.
+ * @return 0 on success.
+ * @return -ENODEV if the 'pool' or the 'job' argument is NULL.
+ */
+int bp_thread_pool_run(bp_thread_pool_t *pool, bp_thread_pool_job_t job, void *arg);
+
+/*!
+ * Get the number of workers in the pool, including the caller thread.
+ * @param pool Reference to the pool.
+ * @return The number of workers.
+ * @return 0 if the 'pool' argument is NULL.
+ */
+size_t bp_thread_pool_size(bp_thread_pool_t *pool);
+
+/*!
+ * Stop and join the worker threads of the pool.
+ * @param pool Reference to the pool.
+ * @return 0 on success.
+ * @return -ENODEV if the 'pool' argument is NULL.
+ */
+int bp_thread_pool_deinit(bp_thread_pool_t *pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_THREAD_POOL_H
@@ -0,0 +1,155 @@
+/*!
+ * @file bp_varray.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies the variable-length array structure. Its elements have different
+ * sizes: their bytes are stored back to back in a single heap buffer, and a table of
+ * {offset, length} entries finds each one in O(1).
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_VARRAY_H
+#define BACKPACK_VARRAY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/*!
+ * Entry of the offset table.
+ */
+typedef struct {
+    uint32_t offset; /*!< Offset of the element in the heap. */
+    uint32_t length; /*!< Length of the element, in bytes. */
+} bp_varray_entry_t;
+
+/*!
+ * Declare the type of a variable-length array buffer.
+ * @param capacity_ Maximum number of elements.
+ * @param bytes_ Size of the heap, in bytes. It must be less than 4 GiB.
+ */
+#define BP_VARRAY_BUFFER(capacity_, bytes_)                                     \
+    struct {                                                                    \
+        bp_varray_entry_t entries[capacity_];                                   \
+        uint8_t heap[bytes_];                                                   \
+    }
+
+/*!
+ * Macro to initialize an empty variable-length array.
+ * @param buffer_ Buffer declared with BP_VARRAY_BUFFER.
+ */
+#define BP_VARRAY_INIT(buffer_)                                                 \
+    {                                                                           \
+        ._entries = (buffer_).entries, ._heap = (buffer_).heap,                 \
+        ._capacity = sizeof((buffer_).entries) / sizeof((buffer_).entries[0]),  \
+        ._heap_size = sizeof((buffer_).heap),                                   \
+    }
+
+/*!
+ * Struct with metadata about the variable-length array.
+ */
+typedef struct {
+    bp_varray_entry_t *_entries; /*!< Offset table. */
+    uint8_t *_heap;              /*!< Heap, where the bytes of the elements are stored. */
+    size_t _capacity;            /*!< Maximum number of elements. */
+    size_t _heap_size;           /*!< Size of the heap, in bytes. */
+    size_t _size;                /*!< Current number of elements. */
+    size_t _used;                /*!< Bytes of the heap in use, including the holes. */
+    size_t _garbage;             /*!< Bytes of the heap left by deleted elements. */
+} bp_varray_t;
+
+/*!
+ * Append an element.
+ * @param varray Reference to bp_varray.
+ * @param data Reference to the bytes of the element.
+ * @param length Length of the element, in bytes. It can be zero.
+ * @return 0 on success.
+ * @return -ENODEV if the 'varray' argument is NULL.
+ * @return -EINVAL if the 'data' argument is NULL and the length isn't zero.
+ * @return -ENOMEM if the offset table or the heap is full. The heap may have room after
+ * bp_varray_compact.
+ */
+int bp_varray_push(bp_varray_t *varray, const void *data, size_t length);
+
+/*!
+ * Append many elements at once, from their bytes stored back to back.
+ * @param varray Reference to bp_varray.
+ * @param data Reference to the bytes of all the elements.
+ * @param lengths Length of each element, in bytes.
+ * @param count Number of elements.
+ * @return 0 on success.
+ * @return -ENODEV if the 'varray' argument is NULL.
+ * @return -EINVAL if the 'data' or the 'lengths' argument is NULL.
+ * @return -ENOMEM if there isn't room for all the elements. Nothing is appended in this
+ * case.
+ */
+int bp_varray_load(bp_varray_t *varray, const void *data, const uint32_t *lengths,
+                   size_t count);
+
+/*!
+ * Get an element.
+ * @param varray Reference to bp_varray.
+ * @param idx Index of the element.
+ * @param length [out] Length of the element, in bytes. It can be NULL.
+ * @return Reference to the bytes of the element. It's valid until the next
+ * bp_varray_compact.
+ * @return NULL if the 'varray' argument is NULL or if the index is out of the array.
+ */
+void *bp_varray_get(bp_varray_t *varray, size_t idx, size_t *length);
+
+/*!
+ * Delete an element. The next elements are shifted in the offset table, but their bytes
+ * stay in place: the hole in the heap is only reclaimed by bp_varray_compact.
+ * @param varray Reference to bp_varray.
+ * @param idx Index of the element.
+ * @return 0 on success.
+ * @return -ENODEV if the 'varray' argument is NULL.
+ * @return -EINVAL if the index is out of the array.
+ */
+int bp_varray_del(bp_varray_t *varray, size_t idx);
+
+/*!
+ * Move the elements to close the holes left in the heap by deleted elements.
+ * @param varray Reference to bp_varray.
+ * @return 0 on success.
+ * @return -ENODEV if the 'varray' argument is NULL.
+ */
+int bp_varray_compact(bp_varray_t *varray);
+
+/*!
+ * Remove all the elements.
+ * @param varray Reference to bp_varray.
+ * @return 0 on success.
+ * @return -ENODEV if the 'varray' argument is NULL.
+ */
+int bp_varray_clear(bp_varray_t *varray);
+
+/*!
+ * Get the number of elements.
+ * @param varray Reference to bp_varray.
+ * @return The number of elements.
+ * @return 0 if the 'varray' argument is NULL.
+ */
+size_t bp_varray_size(bp_varray_t *varray);
+
+/*!
+ * Get the number of heap bytes left by deleted elements, which bp_varray_compact would
+ * reclaim.
+ * @param varray Reference to bp_varray.
+ * @return The number of bytes.
+ * @return 0 if the 'varray' argument is NULL.
+ */
+size_t bp_varray_garbage(bp_varray_t *varray);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_VARRAY_H
@@ -0,0 +1,196 @@
+/*!
+ * @file bp_vec.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies the vector structure. The vector is an array that grows when it's
+ * full. It starts over an optional inline buffer, like a bp_array, and moves the
+ * elements to a bigger buffer, given by an allocator, when the buffer gets full. Without
+ * an allocator the vector never grows, so it works like a bp_array and doesn't depend
+ * on any dynamic memory.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_VEC_H
+#define BACKPACK_VEC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bp_alloc.h"
+#include "bp_array.h"
+
+/*!
+ * Minimum capacity of the buffers given by the allocator.
+ */
+#define BP_VEC_MIN_CAPACITY 4U
+
+/*!
+ * Macro to initialize a bp_vec, which starts over an inline buffer.
+ * @param buffer_ Inline buffer, where the first elements will be stored.
+ * @param allocator_ Reference to the allocator used to grow the vector, or NULL to
+ * never grow.
+ */
+#define BP_VEC_INIT(buffer_, allocator_)                                             \
+    {                                                                                \
+        ._coll = BP_ARRAY_INIT(buffer_), ._inline = (uint8_t *) (buffer_),           \
+        ._inline_capacity = sizeof(buffer_) / sizeof((buffer_)[0]),                  \
+        ._allocator       = (allocator_),                                            \
+    }
+
+/*!
+ * Macro to initialize an empty bp_vec, without inline buffer.
+ * @param type_ Type of the vector elements.
+ * @param allocator_ Reference to the allocator used to grow the vector.
+ */
+#define BP_VEC_INIT_EMPTY(type_, allocator_)                                         \
+    {                                                                                \
+        ._coll = {._element_size = sizeof(type_), ._capacity = 0, ._size = 0,        \
+                  ._array = NULL},                                                   \
+        ._inline = NULL, ._inline_capacity = 0, ._allocator = (allocator_),          \
+    }
+
+/*!
+ * Struct with metadata about the vector.
+ *
+ * @note The '_coll' field is a regular bp_array, so the bp_array functions that don't
+ * push elements (sort, find, select...) could be used over it.
+ */
+typedef struct {
+    bp_array_t _coll;  /*!< Array with the current buffer of the vector. */
+    uint8_t *_inline;  /*!< Reference to the inline buffer, or NULL. */
+    size_t _inline_capacity; /*!< Maximum number of elements in the inline buffer. */
+    const bp_allocator_t *_allocator; /*!< Allocator used to grow the vector, or NULL. */
+} bp_vec_t;
+
+/*!
+ * Push an element at the end of vector. If the vector is full, its capacity is doubled.
+ * @param vec Reference to bp_vec.
+ * @param el Reference to the element to be pushed. It could be an element of the vector
+ * itself.
+ * @return 0 on success.
+ * @return -ENODEV if the 'vec' or the 'el' argument is NULL.
+ * @return -ENOMEM if the vector is full and could not grow.
+ */
+int bp_vec_push(bp_vec_t *vec, void *el);
+
+/*!
+ * Get an element from the vector, based on its position.
+ * @param vec Reference to bp_vec.
+ * @param idx Element index.
+ * @return A reference to the desired element.
+ * @return NULL if the index is out of range or the 'vec' argument is NULL.
+ */
+void *bp_vec_get(bp_vec_t *vec, size_t idx);
+
+/*!
+ * Get the last element from the vector.
+ * @param vec Reference to bp_vec.
+ * @return NULL if the vector is empty or the 'vec' argument is NULL.
+ */
+void *bp_vec_last(bp_vec_t *vec);
+
+/*!
+ * Delete a vector element, based on its position.
+ * @param vec Reference to bp_vec.
+ * @param idx Element idx.
+ * @return 0 on success.
+ * @return -ENODEV if the 'vec' argument is NULL.
+ * @return -EFAULT if the index 'idx' is out of range.
+ */
+int bp_vec_del(bp_vec_t *vec, size_t idx);
+
+/*!
+ * Find the index of an element, based at some parameter related to the element. Works
+ * like bp_array_find_idx.
+ * @param vec Reference to bp_vec.
+ * @param param Reference to the parameter used to compare elements.
+ * @param cmp Function to compare an element with the parameter passed at argument param.
+ * @return The index of found element.
+ * @return BP_ARRAY_INVALID_INDEX if the element wasn't found or if the 'vec' or the
+ * 'param' argument is NULL.
+ */
+size_t bp_vec_find_idx(bp_vec_t *vec, void *param, bool (*cmp)(void *el, void *param));
+
+/*!
+ * Find the element in the vector, based at some parameter related to the element. Works
+ * like bp_array_find.
+ * @param vec Reference to bp_vec.
+ * @param param Reference to the parameter used to compare elements.
+ * @param cmp Function to compare an element with the parameter passed at argument param.
+ * @return A reference to the found element.
+ * @return NULL if the element wasn't found or if the 'vec' or the 'param' argument is
+ * NULL.
+ */
+void *bp_vec_find(bp_vec_t *vec, void *param, bool (*cmp)(void *el, void *param));
+
+/*!
+ * Drop all elements in the vector, keeping its buffer.
+ * @param vec Reference to bp_vec.
+ * @return 0 on success.
+ * @return -ENODEV if the 'vec' argument is NULL.
+ */
+int bp_vec_clear(bp_vec_t *vec);
+
+/*!
+ * Get the vector size.
+ * @param vec Reference to bp_vec.
+ * @return The size of vector.
+ * @return 0 if the 'vec' argument is NULL.
+ */
+size_t bp_vec_size(bp_vec_t *vec);
+
+/*!
+ * Get the vector capacity, the number of elements it holds before growing again.
+ * @param vec Reference to bp_vec.
+ * @return The capacity of vector.
+ * @return 0 if the 'vec' argument is NULL.
+ */
+size_t bp_vec_capacity(bp_vec_t *vec);
+
+/*!
+ * Ensure the vector holds at least 'capacity' elements without growing.
+ * @param vec Reference to bp_vec.
+ * @param capacity Desired capacity.
+ * @return 0 on success.
+ * @return -ENODEV if the 'vec' argument is NULL.
+ * @return -ENOMEM if the vector could not grow.
+ */
+int bp_vec_reserve(bp_vec_t *vec, size_t capacity);
+
+/*!
+ * Reduce the vector capacity to its size. If the elements fit in the inline buffer,
+ * they are moved back to it and the allocated buffer is released.
+ * @param vec Reference to bp_vec.
+ * @return 0 on success.
+ * @return -ENODEV if the 'vec' argument is NULL.
+ * @return -ENOMEM if the allocator could not resize the buffer.
+ */
+int bp_vec_shrink_to_fit(bp_vec_t *vec);
+
+/*!
+ * Release the allocated buffer and drop all elements. The vector goes back to its
+ * inline buffer, and could be used again.
+ * @param vec Reference to bp_vec.
+ * @return 0 on success.
+ * @return -ENODEV if the 'vec' argument is NULL.
+ */
+int bp_vec_deinit(bp_vec_t *vec);
+
+/*!
+ * Get a iterator to walk through the bp_vec.
+ *
+ * @warning The iterator is invalidated when the vector grows or shrinks.
+ *
+ * @param vec Reference to bp_vec.
+ * @return A new iterator instance for the bp_vec.
+ */
+bp_iter_t bp_vec_iter(bp_vec_t *vec);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_VEC_H
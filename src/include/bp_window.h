@@ -0,0 +1,138 @@
+/*!
+ * @file bp_window.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies the sliding window aggregator. It keeps the last N samples in a
+ * bp_ring, and updates the aggregates as each sample enters and leaves the window: a
+ * running sum, a running mean and sum of squared deviations (Welford), and two monotonic
+ * deques for the minimum and the maximum. So each push and each query is O(1),
+ * whatever the window size.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_WINDOW_H
+#define BACKPACK_WINDOW_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bp_ring.h"
+
+/*!
+ * Entry of a monotonic deque: a sample and its sequence number.
+ */
+typedef struct {
+    double value; /*!< The sample. */
+    uint64_t seq; /*!< Sequence number of the sample. */
+} bp_window_entry_t;
+
+/*!
+ * Declare the type of a window buffer.
+ * @param capacity_ Number of samples in a full window.
+ */
+#define BP_WINDOW_BUFFER(capacity_)                                             \
+    struct {                                                                    \
+        double samples[capacity_];                                              \
+        bp_window_entry_t mins[capacity_];                                      \
+        bp_window_entry_t maxs[capacity_];                                      \
+    }
+
+/*!
+ * Macro to initialize an empty window.
+ * @param buffer_ Buffer declared with BP_WINDOW_BUFFER.
+ */
+#define BP_WINDOW_INIT(buffer_)                                                 \
+    {                                                                           \
+        ._samples = BP_RING_INIT((buffer_).samples),                            \
+        ._mins    = BP_RING_INIT((buffer_).mins),                               \
+        ._maxs    = BP_RING_INIT((buffer_).maxs),                               \
+        ._seq = 0, ._evictions = 0, ._sum = 0.0, ._mean = 0.0, ._m2 = 0.0,      \
+    }
+
+/*!
+ * Aggregates of the samples in the window.
+ */
+typedef struct {
+    size_t count;    /*!< Number of samples. */
+    double sum;      /*!< Sum of the samples. */
+    double mean;     /*!< Mean of the samples. */
+    double variance; /*!< Population variance of the samples. */
+    double min;      /*!< Smallest sample. */
+    double max;      /*!< Largest sample. */
+} bp_window_stats_t;
+
+/*!
+ * Struct with metadata about the window.
+ */
+typedef struct {
+    bp_ring_t _samples; /*!< Samples in the window, as double. */
+    bp_ring_t _mins;    /*!< Increasing deque of candidates for the minimum. */
+    bp_ring_t _maxs;    /*!< Decreasing deque of candidates for the maximum. */
+    uint64_t _seq;      /*!< Sequence number of the next sample. */
+    size_t _evictions;  /*!< Evictions since the aggregates were last recomputed. */
+    double _sum;        /*!< Sum of the samples. */
+    double _mean;       /*!< Mean of the samples. */
+    double _m2;         /*!< Sum of the squared deviations from the mean. */
+} bp_window_t;
+
+/*!
+ * Push a sample into the window. If the window is full, its oldest sample leaves it. The
+ * sum, mean and variance are updated in place, and recomputed from the samples once per
+ * 'capacity' evictions, or as soon as an eviction cancels most of the variance, so the
+ * rounding error of a sample doesn't outlive it.
+ * @param window Reference to bp_window.
+ * @param value The sample.
+ * @return 0 on success.
+ * @return -ENODEV if the 'window' argument is NULL.
+ * @return -EINVAL if the sample is NaN or infinite.
+ */
+int bp_window_push(bp_window_t *window, double value);
+
+/*!
+ * Get the aggregates of the samples in the window.
+ * @param window Reference to bp_window.
+ * @param stats [out] Reference to a variable where the aggregates will be put.
+ * @return 0 on success.
+ * @return -ENODEV if the 'window' argument is NULL.
+ * @return -EINVAL if the 'stats' argument is NULL.
+ * @return -ENOENT if the window is empty.
+ */
+int bp_window_stats(bp_window_t *window, bp_window_stats_t *stats);
+
+/*!
+ * Get the ring with the samples of the window, oldest first. It must not be changed.
+ * @param window Reference to bp_window.
+ * @return A reference to the ring.
+ * @return NULL if the 'window' argument is NULL.
+ */
+bp_ring_t *bp_window_samples(bp_window_t *window);
+
+/*!
+ * Drop all samples in the window.
+ * @param window Reference to bp_window.
+ * @return 0 on success.
+ * @return -ENODEV if the 'window' argument is NULL.
+ */
+int bp_window_clear(bp_window_t *window);
+
+/*!
+ * Get the number of samples in the window.
+ * @param window Reference to bp_window.
+ * @return The number of samples.
+ * @return 0 if the 'window' argument is NULL.
+ */
+size_t bp_window_size(bp_window_t *window);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_WINDOW_H
@@ -0,0 +1,148 @@
+/*!
+ * @file bp_ws_pool.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies the work-stealing pool. It runs fork-join tasks on the workers of a
+ * bp_thread_pool. Each worker keeps the tasks it spawns in its own bp_wsdeque, and an
+ * idle worker steals the oldest task of another one, so the big pieces of work are the
+ * ones moved between threads. The tasks are never allocated: the caller keeps them, as
+ * in a recursion the spawner keeps them in its stack frame.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_WS_POOL_H
+#define BACKPACK_WS_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bp_thread_pool.h"
+#include "bp_wsdeque.h"
+
+/*!
+ * Number of tasks each worker can keep in its deque. A task spawned into a full deque
+ * runs right away, in the spawner thread.
+ */
+#define BP_WS_POOL_DEQUE_SIZE 128U
+
+/*!
+ * Macro to initialize an empty group of tasks.
+ */
+#define BP_WS_GROUP_INIT \
+    {                    \
+        ._pending = 0,   \
+    }
+
+struct bp_ws_worker;
+
+/*!
+ * Type for the function of a task.
+ * @param worker Reference to the worker running the task. New tasks are spawned on it.
+ * @param arg Argument of the task.
+ */
+typedef void (*bp_ws_task_fn_t)(struct bp_ws_worker *worker, void *arg);
+
+/*!
+ * Group of tasks waited together.
+ */
+typedef struct {
+    size_t _pending; /*!< Number of tasks spawned and not finished yet. */
+} bp_ws_group_t;
+
+/*!
+ * Task of the pool. It must stay valid until its group is waited.
+ */
+typedef struct {
+    bp_ws_task_fn_t fn;    /*!< Function of the task. */
+    void *arg;             /*!< Argument of the task. */
+    bp_ws_group_t *_group; /*!< Group of the task. Set by bp_ws_spawn. */
+} bp_ws_task_t;
+
+/*!
+ * Struct with the state of a worker.
+ */
+typedef struct bp_ws_worker {
+    bp_wsdeque_t _deque;                   /*!< Tasks spawned by the worker. */
+    void *_tasks[BP_WS_POOL_DEQUE_SIZE];   /*!< Buffer of the deque. */
+    struct bp_ws_pool *_pool;              /*!< Reference to the pool of the worker. */
+    size_t _idx;                           /*!< Index of the worker in the pool. */
+    uint64_t _seed;                        /*!< State used to pick the steal victims. */
+} bp_ws_worker_t;
+
+/*!
+ * Struct with metadata about the work-stealing pool.
+ */
+typedef struct bp_ws_pool {
+    bp_thread_pool_t *_threads; /*!< Threads running the workers. */
+    bp_ws_worker_t _workers[BP_THREAD_POOL_MAX_THREADS]; /*!< State of each worker. */
+    bp_ws_task_fn_t _root;      /*!< Function of the current root task. */
+    void *_root_arg;            /*!< Argument of the current root task. */
+    bool _done;                 /*!< Set when the root task returns. */
+} bp_ws_pool_t;
+
+/*!
+ * Initialize the work-stealing pool, on top of a started bp_thread_pool.
+ * @param ws Reference to bp_ws_pool.
+ * @param pool Reference to the thread pool. It must outlive the work-stealing pool.
+ * @return 0 on success.
+ * @return -ENODEV if the 'ws' or the 'pool' argument is NULL.
+ */
+int bp_ws_pool_init(bp_ws_pool_t *ws, bp_thread_pool_t *pool);
+
+/*!
+ * Run a root task and wait for it to finish. The caller thread runs it as the worker 0,
+ * while the other workers steal the tasks it spawns.
+ *
+ * @warning Every spawned task must be waited, with bp_ws_wait, before its spawner
+ * returns. So when the root task returns all the work is done.
+ *
+ * @param ws Reference to bp_ws_pool.
+ * @param fn Function of the root task.
+ * @param arg Argument of the root task.
+ * @return 0 on success.
+ * @return -ENODEV if the 'ws' or the 'fn' argument is NULL.
+ */
+int bp_ws_pool_run(bp_ws_pool_t *ws, bp_ws_task_fn_t fn, void *arg);
+
+/*!
+ * Spawn a task, adding it to a group. The task may run in any worker.
+ * @param worker Reference to the worker running the caller task.
+ * @param group Reference to the group of the task.
+ * @param task Reference to the task. It must stay valid until the group is waited.
+ * @return 0 on success.
+ * @return -ENODEV if any argument is NULL.
+ * @return -EINVAL if the function of the task is NULL.
+ */
+int bp_ws_spawn(bp_ws_worker_t *worker, bp_ws_group_t *group, bp_ws_task_t *task);
+
+/*!
+ * Wait for all the tasks of a group. Meanwhile, the worker runs other tasks, its own or
+ * stolen ones, instead of blocking.
+ * @param worker Reference to the worker running the caller task.
+ * @param group Reference to the group.
+ * @return 0 on success.
+ * @return -ENODEV if any argument is NULL.
+ */
+int bp_ws_wait(bp_ws_worker_t *worker, bp_ws_group_t *group);
+
+/*!
+ * Get the index of a worker.
+ * @param worker Reference to the worker.
+ * @return The index of the worker, from 0 up to the number of threads - 1.
+ * @return 0 if the 'worker' argument is NULL.
+ */
+size_t bp_ws_worker_index(bp_ws_worker_t *worker);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_WS_POOL_H
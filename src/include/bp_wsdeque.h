@@ -0,0 +1,98 @@
+/*!
+ * @file bp_wsdeque.h
+ * @author Matheus T. dos Santos (tenoriomatheus0@gmail.com)
+ * @brief Specifies the work-stealing deque (Chase-Lev). It holds references to tasks in
+ * a fixed circular buffer. Its owner thread pushes and pops at the bottom, like a stack,
+ * while other threads steal the oldest task from the top. The owner only needs an atomic
+ * operation when it races a thief for the last task, so it's used as the per-worker
+ * queue of a task scheduler.
+ * @version 0.1.0
+ * @date 19/10/2026
+ *
+ * @copyright Matheus T. dos Santos all rights reserved (c) 2026
+ *
+ */
+#ifndef BACKPACK_WSDEQUE_H
+#define BACKPACK_WSDEQUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bp_cpu.h"
+
+/*!
+ * Macro to initialize an empty work-stealing deque.
+ * @param buffer_ Array of void pointers where the tasks will be stored. Its length must
+ * be a power of two.
+ */
+#define BP_WSDEQUE_INIT(buffer_)                                                   \
+    {                                                                              \
+        ._top = 0, ._bottom = 0, ._buffer = (void **) (buffer_),                   \
+        ._mask = sizeof(buffer_) / sizeof((buffer_)[0]) - 1U,                      \
+    }
+
+/*!
+ * Struct with metadata about the work-stealing deque. The top, written by the thieves,
+ * and the bottom, written by the owner, are kept in different cache lines.
+ */
+typedef struct {
+    int64_t _top; /*!< Position of the oldest task. The thieves take it. */
+    uint8_t _pad[BP_CACHE_LINE_SIZE - sizeof(int64_t)]; /*!< Padding. */
+    int64_t _bottom; /*!< Position after the newest task. Only the owner writes it. */
+    void **_buffer;  /*!< Reference to the buffer itself. */
+    size_t _mask;    /*!< Capacity of the buffer minus one. */
+} bp_wsdeque_t;
+
+/*!
+ * Push a task at the bottom of the deque. It must only be called by the owner thread.
+ * @param deque Reference to bp_wsdeque.
+ * @param task Reference to the task.
+ * @return 0 on success.
+ * @return -ENODEV if the 'deque' argument is NULL.
+ * @return -EINVAL if the capacity isn't a power of two.
+ * @return -ENOMEM if the deque is full.
+ */
+int bp_wsdeque_push(bp_wsdeque_t *deque, void *task);
+
+/*!
+ * Pop the newest task, at the bottom of the deque. It must only be called by the owner
+ * thread.
+ * @param deque Reference to bp_wsdeque.
+ * @param task [out] Reference to a variable where the task will be put.
+ * @return 0 on success.
+ * @return -ENODEV if the 'deque' or the 'task' argument is NULL.
+ * @return -ENOENT if the deque is empty, or if a thief took its last task.
+ */
+int bp_wsdeque_pop(bp_wsdeque_t *deque, void **task);
+
+/*!
+ * Steal the oldest task, at the top of the deque. It can be called by any thread.
+ * @param deque Reference to bp_wsdeque.
+ * @param task [out] Reference to a variable where the task will be put.
+ * @return 0 on success.
+ * @return -ENODEV if the 'deque' or the 'task' argument is NULL.
+ * @return -ENOENT if the deque is empty.
+ * @return -EAGAIN if another thread took the task first. The deque may still have tasks.
+ */
+int bp_wsdeque_steal(bp_wsdeque_t *deque, void **task);
+
+/*!
+ * Get the number of tasks in the deque. It's only exact when no other thread is using
+ * the deque.
+ * @param deque Reference to bp_wsdeque.
+ * @return The number of tasks.
+ * @return 0 if the 'deque' argument is NULL.
+ */
+size_t bp_wsdeque_size(bp_wsdeque_t *deque);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // BACKPACK_WSDEQUE_H
@@ -0,0 +1,163 @@
+/**
+ * @file arena.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include "bp_arena.h"
+#include "bp_vec.h"
+
+TEST(Arena, NullArguments)
+{
+    bp_array_t array;
+    bp_stack_t stack;
+    bp_ring_t ring;
+    alignas(16) uint8_t buffer[64];
+    bp_arena_t arena = BP_ARENA_INIT(buffer);
+
+    EXPECT_EQ(bp_arena_alloc(nullptr, 8, 8), nullptr);
+    EXPECT_EQ(bp_arena_mark(nullptr), 0);
+    EXPECT_EQ(bp_arena_reset(nullptr, 0), -ENODEV);
+    EXPECT_EQ(bp_arena_used(nullptr), 0);
+    EXPECT_EQ(bp_arena_map(nullptr, 4096), -ENODEV);
+    EXPECT_EQ(bp_arena_unmap(nullptr), -ENODEV);
+    EXPECT_EQ(bp_arena_array_init(nullptr, &array, 4, 4), -ENODEV);
+    EXPECT_EQ(bp_arena_array_init(&arena, nullptr, 4, 4), -ENODEV);
+    EXPECT_EQ(bp_arena_stack_init(nullptr, &stack, 4, 4), -ENODEV);
+    EXPECT_EQ(bp_arena_stack_init(&arena, nullptr, 4, 4), -ENODEV);
+    EXPECT_EQ(bp_arena_ring_init(nullptr, &ring, 4, 4), -ENODEV);
+    EXPECT_EQ(bp_arena_ring_init(&arena, nullptr, 4, 4), -ENODEV);
+}
+
+TEST(Arena, AllocAligned)
+{
+    alignas(16) uint8_t buffer[64];
+    bp_arena_t arena = BP_ARENA_INIT(buffer);
+
+    uint8_t *a = (uint8_t *) bp_arena_alloc(&arena, 3, 1);
+    EXPECT_EQ(a, buffer);
+    uint8_t *b = (uint8_t *) bp_arena_alloc(&arena, 8, 8);
+    EXPECT_EQ(b, buffer + 8);
+    uint8_t *c = (uint8_t *) bp_arena_alloc(&arena, 1, 16);
+    EXPECT_EQ(c, buffer + 16);
+    EXPECT_EQ(bp_arena_used(&arena), 17);
+
+    EXPECT_EQ(bp_arena_alloc(&arena, 4, 3), nullptr);
+    EXPECT_EQ(bp_arena_alloc(&arena, 4, 0), nullptr);
+}
+
+TEST(Arena, AllocFull)
+{
+    alignas(16) uint8_t buffer[32];
+    bp_arena_t arena = BP_ARENA_INIT(buffer);
+
+    EXPECT_NE(bp_arena_alloc(&arena, 30, 1), nullptr);
+    EXPECT_EQ(bp_arena_alloc(&arena, 4, 4), nullptr);
+    EXPECT_EQ(bp_arena_alloc(&arena, SIZE_MAX, 1), nullptr);
+    EXPECT_NE(bp_arena_alloc(&arena, 2, 1), nullptr);
+    EXPECT_EQ(bp_arena_alloc(&arena, 1, 1), nullptr);
+    EXPECT_EQ(bp_arena_used(&arena), 32);
+}
+
+TEST(Arena, MarkReset)
+{
+    alignas(16) uint8_t buffer[64];
+    bp_arena_t arena = BP_ARENA_INIT(buffer);
+
+    bp_arena_alloc(&arena, 10, 1);
+    size_t mark = bp_arena_mark(&arena);
+    EXPECT_EQ(mark, 10);
+
+    void *a = bp_arena_alloc(&arena, 20, 1);
+    EXPECT_EQ(bp_arena_used(&arena), 30);
+    EXPECT_EQ(bp_arena_reset(&arena, 40), -EINVAL);
+
+    EXPECT_EQ(bp_arena_reset(&arena, mark), 0);
+    EXPECT_EQ(bp_arena_used(&arena), 10);
+    EXPECT_EQ(bp_arena_alloc(&arena, 20, 1), a);
+
+    EXPECT_EQ(bp_arena_reset(&arena, 0), 0);
+    EXPECT_EQ(bp_arena_used(&arena), 0);
+}
+
+TEST(Arena, ContainersFromArena)
+{
+    alignas(16) uint8_t buffer[256];
+    bp_arena_t arena = BP_ARENA_INIT(buffer);
+    bp_array_t array;
+    bp_stack_t stack;
+    bp_ring_t ring;
+
+    EXPECT_EQ(bp_arena_array_init(&arena, &array, sizeof(uint32_t), 8), 0);
+    EXPECT_EQ(bp_arena_stack_init(&arena, &stack, sizeof(uint16_t), 8), 0);
+    EXPECT_EQ(bp_arena_ring_init(&arena, &ring, sizeof(uint64_t), 4), 0);
+    EXPECT_EQ(bp_arena_array_init(&arena, &array, sizeof(uint64_t), 64), -ENOMEM);
+    EXPECT_EQ(bp_arena_array_init(&arena, &array, 2, SIZE_MAX), -ENOMEM);
+
+    for (uint32_t i = 0; i < 8; ++i) {
+        EXPECT_EQ(bp_array_push(&array, &i), 0);
+        uint16_t s = (uint16_t) i;
+        EXPECT_EQ(bp_stack_push(&stack, &s), 0);
+    }
+    uint32_t el = 8;
+    EXPECT_EQ(bp_array_push(&array, &el), -ENOMEM);
+
+    for (uint64_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(bp_ring_push(&ring, &i), 0);
+    }
+    uint64_t out;
+    EXPECT_EQ(bp_ring_pop(&ring, &out), 0);
+    EXPECT_EQ(out, 0);
+
+    EXPECT_EQ(*(uint32_t *) bp_array_get(&array, 7), 7);
+    EXPECT_EQ(*(uint16_t *) bp_stack_peek(&stack), 7);
+    EXPECT_EQ(*(uint64_t *) bp_ring_peek(&ring), 1);
+}
+
+TEST(Arena, Allocator)
+{
+    alignas(16) uint8_t buffer[1024];
+    bp_arena_t arena         = BP_ARENA_INIT(buffer);
+    bp_allocator_t allocator = bp_arena_allocator(&arena);
+    bp_vec_t vec             = BP_VEC_INIT_EMPTY(uint32_t, &allocator);
+
+    for (uint32_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(bp_vec_push(&vec, &i), 0);
+    }
+    /* The only block is the vector's, so it grows in place. */
+    EXPECT_EQ(bp_arena_used(&arena), bp_vec_capacity(&vec) * sizeof(uint32_t));
+    for (uint32_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(*(uint32_t *) bp_vec_get(&vec, i), i);
+    }
+
+    EXPECT_EQ(bp_vec_deinit(&vec), 0);
+    EXPECT_EQ(bp_arena_used(&arena), 0);
+}
+
+TEST(Arena, Map)
+{
+    bp_arena_t arena = {};
+    int err          = bp_arena_map(&arena, 4 * BP_ARENA_HUGE_PAGE_SIZE);
+    if (err == -ENOTSUP) {
+        GTEST_SKIP();
+    }
+    ASSERT_EQ(err, 0);
+    EXPECT_EQ(bp_arena_map(&arena, 4096), -EBUSY);
+
+    uint64_t *data = (uint64_t *) bp_arena_alloc(&arena, BP_ARENA_HUGE_PAGE_SIZE, 64);
+    ASSERT_NE(data, nullptr);
+    data[0]                                           = 1;
+    data[BP_ARENA_HUGE_PAGE_SIZE / sizeof(uint64_t) - 1] = 2;
+
+    EXPECT_EQ(bp_arena_unmap(&arena), 0);
+    EXPECT_EQ(bp_arena_unmap(&arena), -EINVAL);
+
+    alignas(16) uint8_t buffer[16];
+    bp_arena_t static_arena = BP_ARENA_INIT(buffer);
+    EXPECT_EQ(bp_arena_unmap(&static_arena), -EINVAL);
+}
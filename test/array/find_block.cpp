@@ -0,0 +1,96 @@
+/**
+ * @file find_block.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include "bp_array.h"
+
+extern "C" {
+static size_t block_calls = 0;
+
+uint64_t block_cmp_uint16(void *els, size_t count, void *param)
+{
+    uint16_t *els_ptr   = (uint16_t *) els;
+    uint16_t *param_ptr = (uint16_t *) param;
+    uint64_t mask       = 0;
+
+    block_calls += 1;
+    for (size_t i = 0; i < count; ++i) {
+        mask |= (uint64_t) (els_ptr[i] == *param_ptr) << i;
+    }
+
+    return mask;
+}
+}
+
+TEST(FindBlock, OnNullArray)
+{
+    uint16_t param = 0;
+
+    EXPECT_EQ(bp_array_find_block(nullptr, &param, block_cmp_uint16),
+              BP_ARRAY_INVALID_INDEX);
+}
+
+TEST(FindBlock, OnEmptyArray)
+{
+    uint16_t buffer[10] = {0};
+    bp_array_t array    = BP_ARRAY_INIT(buffer);
+    uint16_t param      = 0;
+
+    EXPECT_EQ(bp_array_find_block(&array, &param, block_cmp_uint16),
+              BP_ARRAY_INVALID_INDEX);
+    EXPECT_EQ(bp_array_find_block(&array, nullptr, block_cmp_uint16),
+              BP_ARRAY_INVALID_INDEX);
+}
+
+TEST(FindBlock, OnManyBlocks)
+{
+    uint16_t buffer[200] = {0};
+    for (int i = 0; i < 200; ++i) {
+        buffer[i] = i + 1;
+    }
+    bp_array_t array = BP_ARRAY_START(buffer, 200);
+    uint16_t param;
+
+    for (uint16_t i = 0; i < 200; ++i) {
+        param       = i + 1;
+        block_calls = 0;
+        EXPECT_EQ(bp_array_find_block(&array, &param, block_cmp_uint16), i);
+        EXPECT_EQ(bp_array_find_block(&array, &param, nullptr), i);
+        EXPECT_EQ(block_calls, i / BP_BLOCK_SIZE + 1);
+    }
+
+    param = 201;
+    EXPECT_EQ(bp_array_find_block(&array, &param, block_cmp_uint16),
+              BP_ARRAY_INVALID_INDEX);
+}
+
+TEST(FindBlock, ReturnsFirstMatch)
+{
+    uint16_t buffer[100] = {0};
+    bp_array_t array     = BP_ARRAY_START(buffer, 100);
+    uint16_t param       = 7;
+
+    buffer[70] = 7;
+    buffer[90] = 7;
+    EXPECT_EQ(bp_array_find_block(&array, &param, block_cmp_uint16), 70);
+
+    buffer[3] = 7;
+    EXPECT_EQ(bp_array_find_block(&array, &param, block_cmp_uint16), 3);
+}
+
+TEST(FindBlock, IgnoresElementsAfterSize)
+{
+    uint16_t buffer[10] = {0, 0, 0, 5, 0, 0, 0, 0, 0, 0};
+    bp_array_t array    = BP_ARRAY_START(buffer, 3);
+    uint16_t param      = 5;
+
+    EXPECT_EQ(bp_array_find_block(&array, &param, block_cmp_uint16),
+              BP_ARRAY_INVALID_INDEX);
+}
@@ -0,0 +1,109 @@
+/**
+ * @file find_many.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include <stddef.h>
+#include "bp_array.h"
+
+typedef struct {
+    uint32_t value;
+    uint32_t id;
+} record_t;
+
+TEST(FindMany, OnNullArguments)
+{
+    record_t buffer[10] = {};
+    bp_array_t array    = BP_ARRAY_START(buffer, 10);
+    uint32_t keys[2]    = {0};
+    size_t out_idx[2];
+
+    EXPECT_EQ(bp_array_find_many(nullptr, keys, 0, 4, 2, out_idx), 0);
+    EXPECT_EQ(bp_array_find_many(&array, nullptr, 0, 4, 2, out_idx), 0);
+    EXPECT_EQ(bp_array_find_many(&array, keys, 0, 4, 2, nullptr), 0);
+}
+
+TEST(FindMany, OnInvalidKey)
+{
+    record_t buffer[10] = {};
+    bp_array_t array    = BP_ARRAY_START(buffer, 10);
+    uint32_t keys[2]    = {0};
+    size_t out_idx[2];
+
+    EXPECT_EQ(bp_array_find_many(&array, keys, 0, 0, 2, out_idx), 0);
+    EXPECT_EQ(bp_array_find_many(&array, keys, 6, 4, 2, out_idx), 0);
+}
+
+TEST(FindMany, OnEmptyArray)
+{
+    record_t buffer[10] = {};
+    bp_array_t array    = BP_ARRAY_INIT(buffer);
+    uint32_t keys[2]    = {0, 1};
+    size_t out_idx[2]   = {0, 0};
+
+    EXPECT_EQ(bp_array_find_many(&array, keys, offsetof(record_t, id), 4, 2, out_idx),
+              0);
+    EXPECT_EQ(out_idx[0], BP_ARRAY_INVALID_INDEX);
+    EXPECT_EQ(out_idx[1], BP_ARRAY_INVALID_INDEX);
+}
+
+TEST(FindMany, FirstIndexOfEachKey)
+{
+    record_t buffer[6]  = {{0, 10}, {1, 20}, {2, 30}, {3, 20}, {4, 40}, {5, 10}};
+    bp_array_t array    = BP_ARRAY_START(buffer, 6);
+    uint32_t keys[5]    = {20, 99, 10, 40, 20};
+    size_t out_idx[5];
+
+    EXPECT_EQ(bp_array_find_many(&array, keys, offsetof(record_t, id), 4, 5, out_idx),
+              4);
+    EXPECT_EQ(out_idx[0], 1);
+    EXPECT_EQ(out_idx[1], BP_ARRAY_INVALID_INDEX);
+    EXPECT_EQ(out_idx[2], 0);
+    EXPECT_EQ(out_idx[3], 4);
+    EXPECT_EQ(out_idx[4], 1);
+}
+
+TEST(FindMany, WholeElementAsKey)
+{
+    uint8_t buffer[5][3] = {{1, 2, 3}, {4, 5, 6}, {7, 8, 9}, {4, 5, 6}, {0, 0, 0}};
+    bp_array_t array     = BP_ARRAY_START(buffer, 5);
+    uint8_t keys[3][3]   = {{4, 5, 6}, {0, 0, 0}, {3, 2, 1}};
+    size_t out_idx[3];
+
+    EXPECT_EQ(bp_array_find_many(&array, keys, 0, 3, 3, out_idx), 2);
+    EXPECT_EQ(out_idx[0], 1);
+    EXPECT_EQ(out_idx[1], 4);
+    EXPECT_EQ(out_idx[2], BP_ARRAY_INVALID_INDEX);
+}
+
+TEST(FindMany, MoreKeysThanBatch)
+{
+    static record_t buffer[1000];
+    static uint32_t keys[700];
+    static size_t out_idx[700];
+    bp_array_t array = BP_ARRAY_START(buffer, 1000);
+
+    for (uint32_t i = 0; i < 1000; ++i) {
+        buffer[i].value = i;
+        buffer[i].id    = i * 7U;
+    }
+    for (uint32_t k = 0; k < 700; ++k) {
+        keys[k] = (699U - k) * 14U;
+    }
+
+    EXPECT_EQ(bp_array_find_many(&array, keys, offsetof(record_t, id), 4, 700, out_idx),
+              500);
+    for (uint32_t k = 0; k < 700; ++k) {
+        if ((699U - k) * 2U < 1000U) {
+            EXPECT_EQ(out_idx[k], (699U - k) * 2U);
+        } else {
+            EXPECT_EQ(out_idx[k], BP_ARRAY_INVALID_INDEX);
+        }
+    }
+}
@@ -0,0 +1,187 @@
+/**
+ * @file par_array.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include "bp_array_par.h"
+
+extern "C" {
+bool par_cmp_uint32(void *el, void *param)
+{
+    return *(uint32_t *) el == *(uint32_t *) param;
+}
+
+void par_add(void *el, void *param)
+{
+    *(uint32_t *) el += *(uint32_t *) param;
+}
+
+int par_cmp_order(void *left, void *right)
+{
+    uint32_t l = *(uint32_t *) left;
+    uint32_t r = *(uint32_t *) right;
+
+    return (l > r) - (l < r);
+}
+}
+
+class ParArray : public ::testing::Test {
+   protected:
+    static const size_t N = 300000;
+    static uint32_t buffer[N];
+    bp_thread_pool_t pool;
+
+    void SetUp() override
+    {
+        ASSERT_EQ(bp_thread_pool_init(&pool, 4), 0);
+        for (size_t i = 0; i < N; ++i) {
+            buffer[i] = (uint32_t) (i % 1000U);
+        }
+    }
+
+    void TearDown() override
+    {
+        EXPECT_EQ(bp_thread_pool_deinit(&pool), 0);
+    }
+};
+
+uint32_t ParArray::buffer[ParArray::N];
+
+TEST(ThreadPool, InvalidArguments)
+{
+    bp_thread_pool_t pool;
+
+    EXPECT_EQ(bp_thread_pool_init(nullptr, 2), -ENODEV);
+    EXPECT_EQ(bp_thread_pool_init(&pool, BP_THREAD_POOL_MAX_THREADS + 1), -EINVAL);
+    EXPECT_EQ(bp_thread_pool_run(nullptr, nullptr, nullptr), -ENODEV);
+    EXPECT_EQ(bp_thread_pool_size(nullptr), 0);
+    EXPECT_EQ(bp_thread_pool_deinit(nullptr), -ENODEV);
+}
+
+TEST_F(ParArray, OnNullArguments)
+{
+    bp_array_t array = BP_ARRAY_START(buffer, N);
+    uint32_t param   = 0;
+
+    EXPECT_EQ(bp_array_par_find_idx(nullptr, &array, &param, par_cmp_uint32),
+              BP_ARRAY_INVALID_INDEX);
+    EXPECT_EQ(bp_array_par_find_idx(&pool, nullptr, &param, par_cmp_uint32),
+              BP_ARRAY_INVALID_INDEX);
+    EXPECT_EQ(bp_array_par_find_idx(&pool, &array, nullptr, par_cmp_uint32),
+              BP_ARRAY_INVALID_INDEX);
+    EXPECT_EQ(bp_array_par_count(&pool, nullptr, &param, par_cmp_uint32), 0);
+    EXPECT_EQ(bp_array_par_for_each(&pool, &array, nullptr, &param), -ENODEV);
+}
+
+TEST_F(ParArray, FindLowestIndex)
+{
+    bp_array_t array = BP_ARRAY_START(buffer, N);
+    uint32_t param;
+
+    EXPECT_EQ(bp_thread_pool_size(&pool), 4);
+    for (uint32_t value = 0; value < 1000; value += 37) {
+        param = value;
+        EXPECT_EQ(bp_array_par_find_idx(&pool, &array, &param, par_cmp_uint32), value);
+        EXPECT_EQ(bp_array_par_find_idx(&pool, &array, &param, nullptr), value);
+    }
+
+    buffer[N - 1] = 5000;
+    param         = 5000;
+    EXPECT_EQ(bp_array_par_find_idx(&pool, &array, &param, par_cmp_uint32), N - 1);
+
+    param = 6000;
+    EXPECT_EQ(bp_array_par_find_idx(&pool, &array, &param, par_cmp_uint32),
+              BP_ARRAY_INVALID_INDEX);
+}
+
+TEST_F(ParArray, Count)
+{
+    bp_array_t array = BP_ARRAY_START(buffer, N);
+    uint32_t param   = 999;
+
+    EXPECT_EQ(bp_array_par_count(&pool, &array, &param, par_cmp_uint32), N / 1000);
+    EXPECT_EQ(bp_array_par_count(&pool, &array, &param, nullptr), N / 1000);
+
+    array._size = 0;
+    EXPECT_EQ(bp_array_par_count(&pool, &array, &param, par_cmp_uint32), 0);
+}
+
+TEST_F(ParArray, ForEach)
+{
+    bp_array_t array = BP_ARRAY_START(buffer, N - 3);
+    uint32_t param   = 1;
+
+    EXPECT_EQ(bp_array_par_for_each(&pool, &array, par_add, &param), 0);
+    for (size_t i = 0; i < N - 3; ++i) {
+        ASSERT_EQ(buffer[i], (uint32_t) (i % 1000U) + 1U);
+    }
+    for (size_t i = N - 3; i < N; ++i) {
+        ASSERT_EQ(buffer[i], (uint32_t) (i % 1000U));
+    }
+}
+
+TEST_F(ParArray, SortInvalidArguments)
+{
+    bp_array_t array = BP_ARRAY_START(buffer, N);
+    uint32_t scratch[1];
+
+    EXPECT_EQ(bp_array_par_sort(nullptr, &array, par_cmp_order, scratch), -ENODEV);
+    EXPECT_EQ(bp_array_par_sort(&pool, nullptr, par_cmp_order, scratch), -ENODEV);
+    EXPECT_EQ(bp_array_par_sort(&pool, &array, par_cmp_order, nullptr), -ENODEV);
+    EXPECT_EQ(bp_array_par_sort(&pool, &array, nullptr, scratch), -EINVAL);
+}
+
+TEST_F(ParArray, Sort)
+{
+    static uint32_t scratch[N];
+    const size_t sizes[] = {0, 100, BP_ARRAY_PAR_SORT_MIN, 12345, N};
+    uint32_t state       = 1;
+    uint64_t sum;
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        bp_array_t array = BP_ARRAY_START(buffer, sizes[s]);
+
+        sum = 0;
+        for (size_t i = 0; i < sizes[s]; ++i) {
+            state     = state * 1103515245U + 12345U;
+            buffer[i] = (state >> 8) % 50000U;
+            sum += buffer[i];
+        }
+
+        EXPECT_EQ(bp_array_par_sort(&pool, &array, par_cmp_order, scratch), 0);
+        for (size_t i = 1; i < sizes[s]; ++i) {
+            ASSERT_LE(buffer[i - 1], buffer[i]) << "size " << sizes[s];
+        }
+        for (size_t i = 0; i < sizes[s]; ++i) {
+            sum -= buffer[i];
+        }
+        EXPECT_EQ(sum, 0);
+    }
+}
+
+TEST(ParSort, OddNumberOfWorkers)
+{
+    static uint32_t buffer[50000];
+    static uint32_t scratch[50000];
+    bp_array_t array = BP_ARRAY_START(buffer, 50000);
+    bp_thread_pool_t pool;
+
+    for (size_t workers = 2; workers <= 7; ++workers) {
+        ASSERT_EQ(bp_thread_pool_init(&pool, workers), 0);
+        for (uint32_t i = 0; i < 50000; ++i) {
+            buffer[i] = (i * 7919U) % 50000U;
+        }
+
+        EXPECT_EQ(bp_array_par_sort(&pool, &array, par_cmp_order, scratch), 0);
+        for (uint32_t i = 0; i < 50000; ++i) {
+            ASSERT_EQ(buffer[i], i) << "workers " << workers;
+        }
+        EXPECT_EQ(bp_thread_pool_deinit(&pool), 0);
+    }
+}
@@ -0,0 +1,117 @@
+/**
+ * @file select_array.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include "bp_array.h"
+
+extern "C" {
+int cmp_sample(void *left, void *right)
+{
+    uint32_t l = *(uint32_t *) left;
+    uint32_t r = *(uint32_t *) right;
+
+    return (l > r) - (l < r);
+}
+}
+
+static void fill_samples(uint32_t *buffer, size_t size, uint32_t seed)
+{
+    for (size_t i = 0; i < size; ++i) {
+        seed      = seed * 1103515245U + 12345U;
+        buffer[i] = (seed >> 8) % 1000U;
+    }
+}
+
+TEST(SelectArray, InvalidArguments)
+{
+    uint32_t buffer[10] = {0};
+    bp_array_t array    = BP_ARRAY_START(buffer, 10);
+
+    EXPECT_EQ(bp_array_select(nullptr, 0, cmp_sample), nullptr);
+    EXPECT_EQ(bp_array_select(&array, 0, nullptr), nullptr);
+    EXPECT_EQ(bp_array_select(&array, 10, cmp_sample), nullptr);
+}
+
+TEST(SelectArray, EveryRank)
+{
+    uint32_t buffer[500];
+    uint32_t sorted[500];
+    bp_array_t array        = BP_ARRAY_START(buffer, 500);
+    bp_array_t sorted_array = BP_ARRAY_START(sorted, 500);
+    uint32_t *el;
+
+    fill_samples(sorted, 500, 5);
+    EXPECT_EQ(bp_array_sort(&sorted_array, cmp_sample), 0);
+
+    for (size_t k = 0; k < 500; ++k) {
+        fill_samples(buffer, 500, 5);
+        el = (uint32_t *) bp_array_select(&array, k, cmp_sample);
+        ASSERT_EQ(el, &buffer[k]);
+        ASSERT_EQ(*el, sorted[k]);
+        for (size_t i = 0; i < k; ++i) {
+            ASSERT_LE(buffer[i], *el);
+        }
+        for (size_t i = k + 1; i < 500; ++i) {
+            ASSERT_GE(buffer[i], *el);
+        }
+    }
+}
+
+TEST(Percentiles, InvalidArguments)
+{
+    uint32_t buffer[10] = {0};
+    bp_array_t array    = BP_ARRAY_START(buffer, 10);
+    double unordered[2] = {0.9, 0.5};
+    double outside[1]   = {1.5};
+    void *out[2];
+
+    EXPECT_EQ(bp_array_percentiles(nullptr, cmp_sample, unordered, 2, out), -ENODEV);
+    EXPECT_EQ(bp_array_percentiles(&array, cmp_sample, nullptr, 2, out), -ENODEV);
+    EXPECT_EQ(bp_array_percentiles(&array, cmp_sample, unordered, 2, nullptr), -ENODEV);
+    EXPECT_EQ(bp_array_percentiles(&array, nullptr, unordered, 1, out), -EINVAL);
+    EXPECT_EQ(bp_array_percentiles(&array, cmp_sample, unordered, 2, out), -EINVAL);
+    EXPECT_EQ(bp_array_percentiles(&array, cmp_sample, outside, 1, out), -EINVAL);
+
+    array._size = 0;
+    EXPECT_EQ(bp_array_percentiles(&array, cmp_sample, unordered, 1, out), -ENOENT);
+}
+
+TEST(Percentiles, ManyQuantiles)
+{
+    static uint32_t buffer[10001];
+    static uint32_t sorted[10001];
+    bp_array_t array        = BP_ARRAY_START(buffer, 10001);
+    bp_array_t sorted_array = BP_ARRAY_START(sorted, 10001);
+    const double quantiles[] = {0.0, 0.25, 0.5, 0.5, 0.9, 0.99, 0.999, 1.0};
+    const size_t ranks[]     = {0, 2500, 5000, 5000, 9000, 9900, 9990, 10000};
+    void *out[8];
+
+    fill_samples(buffer, 10001, 9);
+    fill_samples(sorted, 10001, 9);
+    EXPECT_EQ(bp_array_sort(&sorted_array, cmp_sample), 0);
+
+    EXPECT_EQ(bp_array_percentiles(&array, cmp_sample, quantiles, 8, out), 0);
+    for (size_t i = 0; i < 8; ++i) {
+        EXPECT_EQ(out[i], &buffer[ranks[i]]);
+        EXPECT_EQ(*(uint32_t *) out[i], sorted[ranks[i]]);
+    }
+}
+
+TEST(Percentiles, SmallArray)
+{
+    uint32_t buffer[3]      = {30, 10, 20};
+    bp_array_t array        = BP_ARRAY_START(buffer, 3);
+    const double quantiles[] = {0.5, 1.0};
+    void *out[2];
+
+    EXPECT_EQ(bp_array_percentiles(&array, cmp_sample, quantiles, 2, out), 0);
+    EXPECT_EQ(*(uint32_t *) out[0], 20);
+    EXPECT_EQ(*(uint32_t *) out[1], 30);
+}
@@ -0,0 +1,181 @@
+/**
+ * @file sort_array.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include <stddef.h>
+#include "bp_array.h"
+
+typedef struct {
+    uint32_t seq;
+    uint16_t key;
+    uint8_t pad[7];
+} sort_record_t;
+
+extern "C" {
+int cmp_int32(void *left, void *right)
+{
+    int32_t l = *(int32_t *) left;
+    int32_t r = *(int32_t *) right;
+
+    return (l > r) - (l < r);
+}
+
+int cmp_record_key(void *left, void *right)
+{
+    sort_record_t *l = (sort_record_t *) left;
+    sort_record_t *r = (sort_record_t *) right;
+
+    return (int) l->key - (int) r->key;
+}
+}
+
+static uint32_t sort_rand(uint32_t *state)
+{
+    *state = *state * 1103515245U + 12345U;
+    return *state >> 8;
+}
+
+TEST(SortArray, InvalidArguments)
+{
+    int32_t buffer[10] = {0};
+    bp_array_t array   = BP_ARRAY_START(buffer, 10);
+
+    EXPECT_EQ(bp_array_sort(nullptr, cmp_int32), -ENODEV);
+    EXPECT_EQ(bp_array_sort(&array, nullptr), -EINVAL);
+}
+
+TEST(SortArray, EmptyAndOneElement)
+{
+    int32_t buffer[10] = {5, 4};
+    bp_array_t array   = BP_ARRAY_START(buffer, 0);
+
+    EXPECT_EQ(bp_array_sort(&array, cmp_int32), 0);
+    array._size = 1;
+    EXPECT_EQ(bp_array_sort(&array, cmp_int32), 0);
+    EXPECT_EQ(buffer[0], 5);
+    EXPECT_EQ(buffer[1], 4);
+}
+
+TEST(SortArray, ManyPatterns)
+{
+    static int32_t buffer[5000];
+    bp_array_t array = BP_ARRAY_START(buffer, 5000);
+    uint32_t state   = 1;
+
+    for (int pattern = 0; pattern < 5; ++pattern) {
+        for (int32_t i = 0; i < 5000; ++i) {
+            switch (pattern) {
+            case 0:
+                buffer[i] = (int32_t) sort_rand(&state) - (1 << 23);
+                break;
+            case 1:
+                buffer[i] = i;
+                break;
+            case 2:
+                buffer[i] = 5000 - i;
+                break;
+            case 3:
+                buffer[i] = (int32_t) (sort_rand(&state) % 4U);
+                break;
+            default:
+                buffer[i] = (i & 1) ? i : -i;
+                break;
+            }
+        }
+
+        EXPECT_EQ(bp_array_sort(&array, cmp_int32), 0);
+        for (size_t i = 1; i < 5000; ++i) {
+            ASSERT_LE(buffer[i - 1], buffer[i]) << "pattern " << pattern;
+        }
+    }
+}
+
+TEST(SortArray, OddElementSize)
+{
+    sort_record_t buffer[300];
+    bp_array_t array = BP_ARRAY_START(buffer, 300);
+    uint32_t state   = 7;
+    uint32_t sum     = 0;
+
+    for (uint32_t i = 0; i < 300; ++i) {
+        buffer[i].seq = i;
+        buffer[i].key = (uint16_t) (sort_rand(&state) % 50U);
+        sum += i;
+    }
+
+    EXPECT_EQ(bp_array_sort(&array, cmp_record_key), 0);
+    for (size_t i = 1; i < 300; ++i) {
+        ASSERT_LE(buffer[i - 1].key, buffer[i].key);
+    }
+    for (size_t i = 0; i < 300; ++i) {
+        sum -= buffer[i].seq;
+    }
+    EXPECT_EQ(sum, 0);
+}
+
+TEST(RadixSort, InvalidArguments)
+{
+    sort_record_t buffer[10] = {};
+    sort_record_t scratch[10];
+    bp_array_t array = BP_ARRAY_START(buffer, 10);
+
+    EXPECT_EQ(bp_array_radix_sort_key(nullptr, 0, 4, scratch), -ENODEV);
+    EXPECT_EQ(bp_array_radix_sort_key(&array, 0, 4, nullptr), -ENODEV);
+    EXPECT_EQ(bp_array_radix_sort_key(&array, 0, 3, scratch), -EINVAL);
+    EXPECT_EQ(bp_array_radix_sort_key(&array, 12, 8, scratch), -EINVAL);
+}
+
+TEST(RadixSort, StableByKey)
+{
+    sort_record_t buffer[1000];
+    sort_record_t scratch[1000];
+    bp_array_t array = BP_ARRAY_START(buffer, 1000);
+    uint32_t state   = 3;
+
+    for (uint32_t i = 0; i < 1000; ++i) {
+        buffer[i].seq = i;
+        buffer[i].key = (uint16_t) sort_rand(&state);
+    }
+
+    EXPECT_EQ(bp_array_radix_sort_key(&array, offsetof(sort_record_t, key), 2, scratch),
+              0);
+    for (size_t i = 1; i < 1000; ++i) {
+        ASSERT_LE(buffer[i - 1].key, buffer[i].key);
+        if (buffer[i - 1].key == buffer[i].key) {
+            ASSERT_LT(buffer[i - 1].seq, buffer[i].seq);
+        }
+    }
+}
+
+TEST(RadixSort, WideKeys)
+{
+    uint64_t buffer[2000];
+    uint64_t scratch[2000];
+    bp_array_t array = BP_ARRAY_START(buffer, 2000);
+    uint32_t state   = 11;
+
+    for (size_t i = 0; i < 2000; ++i) {
+        buffer[i] = ((uint64_t) sort_rand(&state) << 40) ^ sort_rand(&state);
+    }
+
+    EXPECT_EQ(bp_array_radix_sort_key(&array, 0, 8, scratch), 0);
+    for (size_t i = 1; i < 2000; ++i) {
+        ASSERT_LE(buffer[i - 1], buffer[i]);
+    }
+
+    /* Only the lowest byte differs, so only one pass moves the elements. */
+    for (size_t i = 0; i < 2000; ++i) {
+        buffer[i] = UINT64_C(0xAB00000000000000) | (uint8_t) sort_rand(&state);
+    }
+    EXPECT_EQ(bp_array_radix_sort_key(&array, 0, 8, scratch), 0);
+    for (size_t i = 1; i < 2000; ++i) {
+        ASSERT_LE(buffer[i - 1], buffer[i]);
+    }
+}
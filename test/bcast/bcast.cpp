@@ -0,0 +1,286 @@
+/**
+ * @file bcast.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "bp_bcast.h"
+
+class Bcast : public ::testing::Test
+{
+   protected:
+    BP_BCAST_BUFFER(int, 8, 2) buffer = {};
+    bp_bcast_t bcast                  = BP_BCAST_INIT(buffer, false);
+};
+
+TEST_F(Bcast, NullArguments)
+{
+    bp_bcast_batch_t batch;
+    int el = 1;
+
+    EXPECT_EQ(bp_bcast_publish(nullptr, &el, 1), -ENODEV);
+    EXPECT_EQ(bp_bcast_publish(&bcast, nullptr, 1), -ENODEV);
+    EXPECT_EQ(bp_bcast_claim(nullptr, 0, 0, &batch), -ENODEV);
+    EXPECT_EQ(bp_bcast_claim(&bcast, 0, 0, nullptr), -ENODEV);
+    EXPECT_EQ(bp_bcast_release(nullptr, 0, &batch), -ENODEV);
+    EXPECT_EQ(bp_bcast_release(&bcast, 0, nullptr), -ENODEV);
+    EXPECT_EQ(bp_bcast_pending(nullptr, 0), 0);
+    EXPECT_EQ(bp_bcast_published(nullptr), 0);
+}
+
+TEST_F(Bcast, InvalidArguments)
+{
+    BP_BCAST_BUFFER(int, 6, 1) odd = {};
+    bp_bcast_t odd_bcast           = BP_BCAST_INIT(odd, false);
+    bp_bcast_batch_t batch         = {};
+    int els[9]                     = {};
+
+    EXPECT_EQ(bp_bcast_publish(&odd_bcast, els, 1), -EINVAL);
+    EXPECT_EQ(bp_bcast_publish(&bcast, els, 9), -EINVAL);
+    EXPECT_EQ(bp_bcast_claim(&bcast, 2, 0, &batch), -EINVAL);
+    EXPECT_EQ(bp_bcast_release(&bcast, 2, &batch), -EINVAL);
+    EXPECT_EQ(bp_bcast_pending(&bcast, 2), 0);
+    EXPECT_EQ(bp_bcast_claim(&bcast, 0, 0, &batch), -ENOENT);
+}
+
+TEST_F(Bcast, EveryReaderSeesEveryRecord)
+{
+    int els[] = {10, 11, 12, 13, 14};
+    bp_bcast_batch_t batch;
+
+    EXPECT_EQ(bp_bcast_publish(&bcast, els, 5), 0);
+    EXPECT_EQ(bp_bcast_published(&bcast), 5);
+
+    for (size_t reader = 0; reader < 2; ++reader) {
+        EXPECT_EQ(bp_bcast_pending(&bcast, reader), 5);
+        ASSERT_EQ(bp_bcast_claim(&bcast, reader, 0, &batch), 0);
+        EXPECT_EQ(batch.count, 5);
+        EXPECT_EQ(batch.seq, 0);
+        EXPECT_EQ(batch.missed, 0);
+        for (size_t i = 0; i < batch.count; ++i) {
+            EXPECT_EQ(((int *) batch.els)[i], els[i]);
+        }
+        EXPECT_EQ(bp_bcast_release(&bcast, reader, &batch), 0);
+        EXPECT_EQ(bp_bcast_pending(&bcast, reader), 0);
+        EXPECT_EQ(bp_bcast_claim(&bcast, reader, 0, &batch), -ENOENT);
+    }
+}
+
+TEST_F(Bcast, GatedBySlowestReader)
+{
+    int els[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    bp_bcast_batch_t batch;
+
+    EXPECT_EQ(bp_bcast_publish(&bcast, els, 8), 0);
+    EXPECT_EQ(bp_bcast_publish(&bcast, els, 1), -EAGAIN);
+
+    /* Only the reader 0 moves, so the reader 1 still holds the whole buffer. */
+    ASSERT_EQ(bp_bcast_claim(&bcast, 0, 3, &batch), 0);
+    EXPECT_EQ(batch.count, 3);
+    EXPECT_EQ(bp_bcast_release(&bcast, 0, &batch), 0);
+    EXPECT_EQ(bp_bcast_publish(&bcast, els, 1), -EAGAIN);
+
+    ASSERT_EQ(bp_bcast_claim(&bcast, 1, 2, &batch), 0);
+    EXPECT_EQ(bp_bcast_release(&bcast, 1, &batch), 0);
+    EXPECT_EQ(bp_bcast_publish(&bcast, els, 3), -EAGAIN);
+    EXPECT_EQ(bp_bcast_publish(&bcast, els, 2), 0);
+    EXPECT_EQ(bp_bcast_published(&bcast), 10);
+}
+
+TEST_F(Bcast, BatchStopsAtTheEnd)
+{
+    int els[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    bp_bcast_batch_t batch;
+
+    EXPECT_EQ(bp_bcast_publish(&bcast, els, 6), 0);
+    for (size_t reader = 0; reader < 2; ++reader) {
+        ASSERT_EQ(bp_bcast_claim(&bcast, reader, 0, &batch), 0);
+        EXPECT_EQ(bp_bcast_release(&bcast, reader, &batch), 0);
+    }
+
+    /* The records 6..11 take the slots 6, 7, 0, 1, 2, 3. */
+    int more[] = {6, 7, 8, 9, 10, 11};
+    EXPECT_EQ(bp_bcast_publish(&bcast, more, 6), 0);
+
+    ASSERT_EQ(bp_bcast_claim(&bcast, 0, 0, &batch), 0);
+    EXPECT_EQ(batch.seq, 6);
+    EXPECT_EQ(batch.count, 2);
+    EXPECT_EQ(((int *) batch.els)[0], 6);
+    EXPECT_EQ(((int *) batch.els)[1], 7);
+    EXPECT_EQ(bp_bcast_release(&bcast, 0, &batch), 0);
+
+    ASSERT_EQ(bp_bcast_claim(&bcast, 0, 0, &batch), 0);
+    EXPECT_EQ(batch.seq, 8);
+    EXPECT_EQ(batch.count, 4);
+    EXPECT_EQ(batch.els, (void *) buffer.slots);
+    for (size_t i = 0; i < batch.count; ++i) {
+        EXPECT_EQ(((int *) batch.els)[i], 8 + (int) i);
+    }
+    EXPECT_EQ(bp_bcast_release(&bcast, 0, &batch), 0);
+    EXPECT_EQ(bp_bcast_pending(&bcast, 1), 6);
+}
+
+TEST_F(Bcast, LossyReportsMissed)
+{
+    BP_BCAST_BUFFER(int, 4, 1) small = {};
+    bp_bcast_t lossy                 = BP_BCAST_INIT(small, true);
+    bp_bcast_batch_t batch;
+
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(bp_bcast_publish(&lossy, &i, 1), 0);
+    }
+    EXPECT_EQ(bp_bcast_pending(&lossy, 0), 4);
+
+    ASSERT_EQ(bp_bcast_claim(&lossy, 0, 1, &batch), 0);
+    EXPECT_EQ(batch.missed, 6);
+    EXPECT_EQ(batch.seq, 6);
+    EXPECT_EQ(batch.count, 1);
+    EXPECT_EQ(*(int *) batch.els, 6);
+    EXPECT_EQ(bp_bcast_release(&lossy, 0, &batch), 0);
+
+    ASSERT_EQ(bp_bcast_claim(&lossy, 0, 0, &batch), 0);
+    EXPECT_EQ(batch.missed, 0);
+    EXPECT_EQ(batch.seq, 7);
+    EXPECT_EQ(batch.count, 1);
+
+    /* The writer passes the reader while it holds the batch. */
+    for (int i = 10; i < 13; ++i) {
+        EXPECT_EQ(bp_bcast_publish(&lossy, &i, 1), 0);
+    }
+    EXPECT_EQ(bp_bcast_release(&lossy, 0, &batch), -ESTALE);
+
+    ASSERT_EQ(bp_bcast_claim(&lossy, 0, 0, &batch), 0);
+    EXPECT_EQ(batch.missed, 1);
+    EXPECT_EQ(batch.seq, 9);
+    EXPECT_EQ(*(int *) batch.els, 9);
+    EXPECT_EQ(bp_bcast_release(&lossy, 0, &batch), 0);
+}
+
+TEST(BcastLayout, CursorsDontShareLines)
+{
+    struct record {
+        uint8_t bytes[3];
+    };
+    BP_BCAST_BUFFER(struct record, 8, 3) buffer = {};
+    bp_bcast_t bcast                            = BP_BCAST_INIT(buffer, false);
+    auto line = [](const void *ptr) { return (uintptr_t) ptr / BP_CACHE_LINE_SIZE; };
+
+    /* The records take 24 bytes, so nothing after them is aligned to a line. */
+    uintptr_t records_end = line((uint8_t *) buffer.slots + sizeof(buffer.slots) - 1);
+
+    for (size_t r = 0; r < 3; ++r) {
+        const uint64_t *seq = &buffer.cursors[r]._seq;
+
+        EXPECT_GT(line(seq), records_end);
+        EXPECT_EQ(line(seq), line((const uint8_t *) seq + sizeof(uint64_t) - 1));
+        if (r > 0) {
+            EXPECT_GT(line(seq), line(&buffer.cursors[r - 1]._seq) + 1);
+        }
+    }
+
+    uintptr_t hot_first = line(&bcast._published);
+    uintptr_t hot_last  = line(&bcast._gate);
+    EXPECT_LT(line(&bcast._lpad[0]), hot_first);
+    EXPECT_GT(line(&bcast._array), hot_last);
+}
+
+TEST(BcastThreads, GatedReadersSeeTheWholeSequence)
+{
+    static BP_BCAST_BUFFER(uint64_t, 64, 3) buffer;
+    static bp_bcast_t bcast = BP_BCAST_INIT(buffer, false);
+    const uint64_t total    = 100000;
+    std::vector<std::thread> readers;
+    uint64_t sums[3] = {};
+
+    for (size_t r = 0; r < 3; ++r) {
+        readers.emplace_back([&, r]() {
+            uint64_t expected = 0;
+            bp_bcast_batch_t batch;
+
+            while (expected < total) {
+                if (bp_bcast_claim(&bcast, r, 1 + r * 7, &batch) != 0) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                EXPECT_EQ(batch.seq, expected);
+                EXPECT_EQ(batch.missed, 0);
+                for (size_t i = 0; i < batch.count; ++i) {
+                    uint64_t value = ((uint64_t *) batch.els)[i];
+                    EXPECT_EQ(value, expected + i);
+                    sums[r] += value;
+                }
+                expected += batch.count;
+                EXPECT_EQ(bp_bcast_release(&bcast, r, &batch), 0);
+            }
+        });
+    }
+
+    uint64_t next = 0;
+    while (next < total) {
+        uint64_t els[5];
+        size_t count = (total - next < 5) ? (size_t) (total - next) : 5;
+
+        for (size_t i = 0; i < count; ++i) {
+            els[i] = next + i;
+        }
+        if (bp_bcast_publish(&bcast, els, count) == 0) {
+            next += count;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    for (size_t r = 0; r < 3; ++r) {
+        EXPECT_EQ(sums[r], total * (total - 1) / 2);
+    }
+}
+
+TEST(BcastThreads, LossyReaderAccountsForEveryRecord)
+{
+    static BP_BCAST_BUFFER(uint64_t, 16, 1) buffer;
+    static bp_bcast_t bcast = BP_BCAST_INIT(buffer, true);
+    const uint64_t total    = 200000;
+    uint64_t seen           = 0;
+
+    std::thread reader([&]() {
+        uint64_t expected = 0;
+        bp_bcast_batch_t batch;
+
+        while (expected < total) {
+            if (bp_bcast_claim(&bcast, 0, 4, &batch) != 0) {
+                std::this_thread::yield();
+                continue;
+            }
+            EXPECT_EQ(batch.seq, expected + batch.missed);
+
+            uint64_t copy[4];
+            memcpy(copy, batch.els, batch.count * sizeof(uint64_t));
+            if (bp_bcast_release(&bcast, 0, &batch) == 0) {
+                /* A batch that wasn't overwritten holds its own sequence numbers. */
+                for (size_t i = 0; i < batch.count; ++i) {
+                    EXPECT_EQ(copy[i], batch.seq + i);
+                }
+            }
+            seen += batch.missed + batch.count;
+            expected = batch.seq + batch.count;
+        }
+    });
+
+    for (uint64_t i = 0; i < total; ++i) {
+        EXPECT_EQ(bp_bcast_publish(&bcast, &i, 1), 0);
+    }
+    reader.join();
+
+    EXPECT_EQ(seen, total);
+    EXPECT_EQ(bp_bcast_published(&bcast), total);
+}
@@ -0,0 +1,178 @@
+/**
+ * @file bitset.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include <vector>
+#include "bp_bitset.h"
+
+#define BITS 300U
+
+class Bitset : public ::testing::Test
+{
+   protected:
+    uint64_t a_words[BP_BITSET_WORDS(BITS)] = {};
+    uint64_t b_words[BP_BITSET_WORDS(BITS)] = {};
+    bp_bitset_t a                           = BP_BITSET_INIT(a_words, BITS);
+    bp_bitset_t b                           = BP_BITSET_INIT(b_words, BITS);
+    std::vector<bool> model_a               = std::vector<bool>(BITS);
+    std::vector<bool> model_b               = std::vector<bool>(BITS);
+
+    void randomize(unsigned seed)
+    {
+        srand(seed);
+        for (size_t i = 0; i < BITS; ++i) {
+            model_a[i] = rand() % 3 == 0;
+            model_b[i] = rand() % 2 == 0;
+            if (model_a[i]) {
+                bp_bitset_set(&a, i);
+            }
+            if (model_b[i]) {
+                bp_bitset_set(&b, i);
+            }
+        }
+    }
+
+    void expect_a(const std::vector<bool> &model)
+    {
+        for (size_t i = 0; i < BITS; ++i) {
+            EXPECT_EQ(bp_bitset_test(&a, i), model[i]) << "bit " << i;
+        }
+    }
+};
+
+TEST_F(Bitset, NullArguments)
+{
+    EXPECT_EQ(bp_bitset_set(nullptr, 0), -ENODEV);
+    EXPECT_EQ(bp_bitset_unset(nullptr, 0), -ENODEV);
+    EXPECT_FALSE(bp_bitset_test(nullptr, 0));
+    EXPECT_EQ(bp_bitset_fill(nullptr), -ENODEV);
+    EXPECT_EQ(bp_bitset_clear(nullptr), -ENODEV);
+    EXPECT_EQ(bp_bitset_find_first(nullptr), 0);
+    EXPECT_EQ(bp_bitset_find_next(nullptr, 0), 0);
+    EXPECT_EQ(bp_bitset_count(nullptr), 0);
+    EXPECT_EQ(bp_bitset_rank(nullptr, 0), 0);
+    EXPECT_EQ(bp_bitset_select(nullptr, 0), 0);
+    EXPECT_EQ(bp_bitset_and(nullptr, &b), -ENODEV);
+    EXPECT_EQ(bp_bitset_or(&a, nullptr), -ENODEV);
+}
+
+TEST_F(Bitset, SetUnsetTest)
+{
+    EXPECT_EQ(bp_bitset_set(&a, 0), 0);
+    EXPECT_EQ(bp_bitset_set(&a, 63), 0);
+    EXPECT_EQ(bp_bitset_set(&a, 64), 0);
+    EXPECT_EQ(bp_bitset_set(&a, BITS - 1), 0);
+    EXPECT_EQ(bp_bitset_set(&a, BITS), -EINVAL);
+    EXPECT_EQ(bp_bitset_unset(&a, BITS), -EINVAL);
+
+    EXPECT_TRUE(bp_bitset_test(&a, 0));
+    EXPECT_TRUE(bp_bitset_test(&a, 63));
+    EXPECT_TRUE(bp_bitset_test(&a, 64));
+    EXPECT_TRUE(bp_bitset_test(&a, BITS - 1));
+    EXPECT_FALSE(bp_bitset_test(&a, 1));
+    EXPECT_FALSE(bp_bitset_test(&a, BITS));
+    EXPECT_EQ(bp_bitset_count(&a), 4);
+
+    EXPECT_EQ(bp_bitset_unset(&a, 63), 0);
+    EXPECT_FALSE(bp_bitset_test(&a, 63));
+    EXPECT_EQ(bp_bitset_count(&a), 3);
+}
+
+TEST_F(Bitset, FillAndClear)
+{
+    EXPECT_EQ(bp_bitset_fill(&a), 0);
+    EXPECT_EQ(bp_bitset_count(&a), BITS);
+    EXPECT_EQ(a_words[BP_BITSET_WORDS(BITS) - 1] >> (BITS % 64), 0);
+
+    EXPECT_EQ(bp_bitset_clear(&a), 0);
+    EXPECT_EQ(bp_bitset_count(&a), 0);
+    EXPECT_EQ(bp_bitset_find_first(&a), BITS);
+}
+
+TEST_F(Bitset, FindNext)
+{
+    randomize(41);
+
+    std::vector<size_t> expected, found;
+    for (size_t i = 0; i < BITS; ++i) {
+        if (model_a[i]) {
+            expected.push_back(i);
+        }
+    }
+    for (size_t i = bp_bitset_find_first(&a); i < BITS; i = bp_bitset_find_next(&a, i + 1)) {
+        found.push_back(i);
+    }
+
+    EXPECT_EQ(found, expected);
+    EXPECT_EQ(bp_bitset_find_next(&a, BITS), BITS);
+    EXPECT_EQ(bp_bitset_find_next(&a, BITS + 10), BITS);
+}
+
+TEST_F(Bitset, RankSelect)
+{
+    randomize(42);
+
+    size_t count = 0;
+    for (size_t i = 0; i <= BITS; ++i) {
+        EXPECT_EQ(bp_bitset_rank(&a, i), count) << "rank " << i;
+        if (i < BITS && model_a[i]) {
+            EXPECT_EQ(bp_bitset_select(&a, count), i);
+            count += 1;
+        }
+    }
+
+    EXPECT_EQ(bp_bitset_count(&a), count);
+    EXPECT_EQ(bp_bitset_rank(&a, BITS + 100), count);
+    EXPECT_EQ(bp_bitset_select(&a, count), BITS);
+}
+
+TEST_F(Bitset, BulkOperations)
+{
+    std::vector<bool> expected(BITS);
+
+    randomize(43);
+    for (size_t i = 0; i < BITS; ++i) {
+        expected[i] = model_a[i] && model_b[i];
+    }
+    EXPECT_EQ(bp_bitset_and(&a, &b), 0);
+    expect_a(expected);
+
+    for (size_t i = 0; i < BITS; ++i) {
+        expected[i] = expected[i] || model_b[i];
+    }
+    EXPECT_EQ(bp_bitset_or(&a, &b), 0);
+    expect_a(expected);
+
+    bp_bitset_clear(&a);
+    bp_bitset_clear(&b);
+    randomize(44);
+    for (size_t i = 0; i < BITS; ++i) {
+        expected[i] = model_a[i] != model_b[i];
+    }
+    EXPECT_EQ(bp_bitset_xor(&a, &b), 0);
+    expect_a(expected);
+
+    for (size_t i = 0; i < BITS; ++i) {
+        expected[i] = expected[i] && !model_b[i];
+    }
+    EXPECT_EQ(bp_bitset_andnot(&a, &b), 0);
+    expect_a(expected);
+}
+
+TEST_F(Bitset, BulkSizeMismatch)
+{
+    uint64_t words[BP_BITSET_WORDS(BITS)] = {};
+    bp_bitset_t c                         = BP_BITSET_INIT(words, BITS - 1);
+
+    EXPECT_EQ(bp_bitset_and(&a, &c), -EINVAL);
+    EXPECT_EQ(bp_bitset_or(&a, &c), -EINVAL);
+    EXPECT_EQ(bp_bitset_xor(&a, &c), -EINVAL);
+    EXPECT_EQ(bp_bitset_andnot(&a, &c), -EINVAL);
+}
@@ -0,0 +1,180 @@
+/**
+ * @file bloom.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include "bp_bloom.h"
+
+extern "C" {
+typedef struct {
+    uint32_t value;
+    uint64_t key;
+} bloom_record_t;
+}
+
+TEST(Bloom, NullArguments)
+{
+    bp_bloom_block_t blocks[4] = {};
+    bp_bloom_t bloom           = BP_BLOOM_INIT(blocks);
+    bloom_record_t records[4];
+    bp_array_t array = BP_ARRAY_INIT(records);
+    uint64_t key     = 0;
+
+    EXPECT_EQ(bp_bloom_add(nullptr, &key, sizeof(key)), -ENODEV);
+    EXPECT_EQ(bp_bloom_add(&bloom, nullptr, sizeof(key)), -EINVAL);
+    EXPECT_TRUE(bp_bloom_contains(nullptr, &key, sizeof(key)));
+    EXPECT_TRUE(bp_bloom_contains(&bloom, nullptr, sizeof(key)));
+    EXPECT_EQ(bp_bloom_clear(nullptr), -ENODEV);
+    EXPECT_EQ(bp_bloom_array_push(nullptr, &array, &records[0], 8, 8), -ENODEV);
+    EXPECT_EQ(bp_bloom_array_push(&bloom, nullptr, &records[0], 8, 8), -ENODEV);
+    EXPECT_EQ(bp_bloom_array_find(nullptr, &array, &key, 8, 8), nullptr);
+    EXPECT_EQ(bp_bloom_array_find(&bloom, nullptr, &key, 8, 8), nullptr);
+    EXPECT_EQ(bp_bloom_array_find(&bloom, &array, nullptr, 8, 8), nullptr);
+    EXPECT_EQ(bp_bloom_array_rebuild(nullptr, &array, 8, 8), -ENODEV);
+    EXPECT_EQ(bp_bloom_array_rebuild(&bloom, nullptr, 8, 8), -ENODEV);
+}
+
+TEST(Bloom, PushWithoutBlocks)
+{
+    bp_bloom_block_t blocks[4] = {};
+    bp_bloom_t bloom           = BP_BLOOM_INIT(blocks);
+    bp_bloom_t no_blocks       = {nullptr, 0};
+    bloom_record_t records[4];
+    bp_array_t array = BP_ARRAY_INIT(records);
+    bloom_record_t r = {1, 42};
+    size_t offset    = offsetof(bloom_record_t, key);
+
+    /* The element must not be stored if its key can't be added to the filter. */
+    EXPECT_EQ(bp_bloom_array_push(&no_blocks, &array, &r, offset, 8), -EINVAL);
+    EXPECT_EQ(bp_bloom_array_push(&bloom, &array, nullptr, offset, 8), -EINVAL);
+    EXPECT_EQ(array._size, 0);
+}
+
+TEST(Bloom, BlocksDontStraddleLines)
+{
+    bp_bloom_block_t blocks[4];
+
+    EXPECT_EQ(alignof(bp_bloom_block_t), 32);
+    for (size_t i = 0; i < 4; ++i) {
+        uintptr_t first = (uintptr_t) &blocks[i];
+        uintptr_t last  = first + sizeof(blocks[i]) - 1U;
+        EXPECT_EQ(first / BP_CACHE_LINE_SIZE, last / BP_CACHE_LINE_SIZE);
+    }
+}
+
+TEST(Bloom, Empty)
+{
+    bp_bloom_block_t blocks[4] = {};
+    bp_bloom_t bloom           = BP_BLOOM_INIT(blocks);
+
+    for (uint64_t key = 0; key < 100; ++key) {
+        EXPECT_FALSE(bp_bloom_contains(&bloom, &key, sizeof(key)));
+    }
+
+    bp_bloom_t no_blocks = {nullptr, 0};
+    uint64_t key         = 1;
+    EXPECT_EQ(bp_bloom_add(&no_blocks, &key, sizeof(key)), -EINVAL);
+    EXPECT_TRUE(bp_bloom_contains(&no_blocks, &key, sizeof(key)));
+}
+
+TEST(Bloom, NoFalseNegatives)
+{
+    static bp_bloom_block_t blocks[64];
+    bp_bloom_t bloom = BP_BLOOM_INIT(blocks);
+
+    for (uint64_t key = 0; key < 1024; ++key) {
+        uint64_t k = key * 0x9E3779B97F4A7C15U;
+        EXPECT_EQ(bp_bloom_add(&bloom, &k, sizeof(k)), 0);
+    }
+    for (uint64_t key = 0; key < 1024; ++key) {
+        uint64_t k = key * 0x9E3779B97F4A7C15U;
+        EXPECT_TRUE(bp_bloom_contains(&bloom, &k, sizeof(k)));
+    }
+
+    char name[] = "some-name";
+    EXPECT_EQ(bp_bloom_add(&bloom, name, sizeof(name)), 0);
+    EXPECT_TRUE(bp_bloom_contains(&bloom, name, sizeof(name)));
+
+    EXPECT_EQ(bp_bloom_clear(&bloom), 0);
+    EXPECT_FALSE(bp_bloom_contains(&bloom, name, sizeof(name)));
+}
+
+TEST(Bloom, FalsePositiveRate)
+{
+    static bp_bloom_block_t blocks[64];
+    bp_bloom_t bloom = BP_BLOOM_INIT(blocks);
+    size_t false_positives = 0;
+
+    /* 16 bits per key. */
+    for (uint64_t key = 0; key < 1024; ++key) {
+        bp_bloom_add(&bloom, &key, sizeof(key));
+    }
+    for (uint64_t key = 1024; key < 1024 + 100000; ++key) {
+        false_positives += bp_bloom_contains(&bloom, &key, sizeof(key));
+    }
+
+    EXPECT_LT(false_positives, 1000U);
+}
+
+TEST(Bloom, ArrayPushFind)
+{
+    bp_bloom_block_t blocks[4] = {};
+    bp_bloom_t bloom           = BP_BLOOM_INIT(blocks);
+    bloom_record_t records[8];
+    bp_array_t array = BP_ARRAY_INIT(records);
+    size_t offset    = offsetof(bloom_record_t, key);
+
+    for (uint32_t i = 0; i < 8; ++i) {
+        bloom_record_t r = {i, 1000U + i};
+        EXPECT_EQ(bp_bloom_array_push(&bloom, &array, &r, offset, sizeof(uint64_t)), 0);
+    }
+    bloom_record_t r = {8, 1008};
+    EXPECT_EQ(bp_bloom_array_push(&bloom, &array, &r, offset, sizeof(uint64_t)), -ENOMEM);
+    EXPECT_EQ(bp_bloom_array_push(&bloom, &array, &r, offset, 16), -EINVAL);
+    EXPECT_FALSE(bp_bloom_contains(&bloom, &r.key, sizeof(r.key)) &&
+                 bp_bloom_array_find(&bloom, &array, &r.key, offset, sizeof(uint64_t)) != nullptr);
+
+    for (uint32_t i = 0; i < 8; ++i) {
+        uint64_t key     = 1000U + i;
+        bloom_record_t *found = (bloom_record_t *) bp_bloom_array_find(&bloom, &array, &key,
+                                                                      offset, sizeof(key));
+        ASSERT_NE(found, nullptr);
+        EXPECT_EQ(found->value, i);
+    }
+    uint64_t key = 5;
+    EXPECT_EQ(bp_bloom_array_find(&bloom, &array, &key, offset, sizeof(key)), nullptr);
+    EXPECT_EQ(bp_bloom_array_find(&bloom, &array, &key, offset, 16), nullptr);
+}
+
+TEST(Bloom, ArrayRebuild)
+{
+    bp_bloom_block_t blocks[4] = {};
+    bp_bloom_t bloom           = BP_BLOOM_INIT(blocks);
+    bloom_record_t records[8];
+    bp_array_t array = BP_ARRAY_INIT(records);
+    size_t offset    = offsetof(bloom_record_t, key);
+
+    for (uint32_t i = 0; i < 8; ++i) {
+        bloom_record_t r = {i, 1000U + i};
+        bp_bloom_array_push(&bloom, &array, &r, offset, sizeof(uint64_t));
+    }
+    bp_array_del(&array, 3);
+
+    uint64_t key = 1003;
+    EXPECT_TRUE(bp_bloom_contains(&bloom, &key, sizeof(key)));
+    EXPECT_EQ(bp_bloom_array_find(&bloom, &array, &key, offset, sizeof(key)), nullptr);
+
+    EXPECT_EQ(bp_bloom_array_rebuild(&bloom, &array, offset, 16), -EINVAL);
+    EXPECT_EQ(bp_bloom_array_rebuild(&bloom, &array, offset, sizeof(key)), 0);
+    for (uint32_t i = 0; i < 8; ++i) {
+        key = 1000U + i;
+        EXPECT_EQ(bp_bloom_array_find(&bloom, &array, &key, offset, sizeof(key)) != nullptr,
+                  i != 3);
+    }
+}
@@ -0,0 +1,315 @@
+/**
+ * @file btree.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include <map>
+#include <vector>
+#include "bp_btree.h"
+
+static_assert(sizeof(bp_btree_node_t) % 64 == 0, "nodes must fill whole cache lines");
+
+class Btree : public ::testing::Test
+{
+   protected:
+    bp_btree_node_t nodes[512] = {};
+    bp_btree_t tree            = BP_BTREE_INIT(nodes);
+    std::map<uint64_t, uint64_t> model;
+
+    /* Check the ordering, the fill of each node and the leaf links. */
+    size_t check_node(uint32_t link, uint64_t lo, uint64_t hi, bool has_hi, size_t level,
+                      std::vector<uint32_t> &leaves)
+    {
+        bp_btree_node_t *node = &nodes[link - 1];
+
+        if (link != tree._root) {
+            EXPECT_GE(node->count, BP_BTREE_KEYS / 2);
+        }
+        for (size_t i = 0; i < node->count; ++i) {
+            EXPECT_GE(node->keys[i], lo);
+            if (has_hi) {
+                EXPECT_LT(node->keys[i], hi);
+            }
+            if (i > 0) {
+                EXPECT_LT(node->keys[i - 1], node->keys[i]);
+            }
+        }
+        for (size_t i = node->count; i < BP_BTREE_KEYS; ++i) {
+            EXPECT_EQ(node->keys[i], UINT64_MAX);
+        }
+
+        if (node->leaf) {
+            EXPECT_EQ(level + 1, tree._height);
+            leaves.push_back(link);
+            return node->count;
+        }
+
+        size_t total = 0;
+        for (size_t i = 0; i <= node->count; ++i) {
+            uint64_t child_lo = i == 0 ? lo : node->keys[i - 1];
+            bool child_has_hi = i < node->count || has_hi;
+            uint64_t child_hi = i < node->count ? node->keys[i] : hi;
+            total += check_node(node->u.children[i], child_lo, child_hi, child_has_hi, level + 1,
+                                leaves);
+        }
+        return total;
+    }
+
+    void check_tree()
+    {
+        ASSERT_EQ(bp_btree_size(&tree), model.size());
+        if (tree._root == 0) {
+            EXPECT_EQ(model.size(), 0);
+            EXPECT_EQ(tree._live, 0);
+            return;
+        }
+
+        std::vector<uint32_t> leaves;
+        EXPECT_EQ(check_node(tree._root, 0, 0, false, 0, leaves), model.size());
+        for (size_t i = 0; i < leaves.size(); ++i) {
+            EXPECT_EQ(nodes[leaves[i] - 1].prev, i == 0 ? 0 : leaves[i - 1]);
+            EXPECT_EQ(nodes[leaves[i] - 1].next, i + 1 == leaves.size() ? 0 : leaves[i + 1]);
+        }
+    }
+};
+
+TEST_F(Btree, NullArguments)
+{
+    bp_btree_range_t range = {nullptr, 0, 1};
+    bp_iterator_t it       = bp_btree_range_iterator(&range);
+    bp_iterator_t null_it  = bp_btree_iterator(nullptr);
+
+    EXPECT_EQ(bp_btree_insert(nullptr, 1, 1), -ENODEV);
+    EXPECT_EQ(bp_btree_find(nullptr, 1), nullptr);
+    EXPECT_EQ(bp_btree_lower_bound(nullptr, 1, nullptr), nullptr);
+    EXPECT_EQ(bp_btree_erase(nullptr, 1), -ENODEV);
+    EXPECT_EQ(bp_btree_clear(nullptr), -ENODEV);
+    EXPECT_EQ(bp_btree_size(nullptr), 0);
+    EXPECT_EQ(bp_btree_iterator_key(nullptr), 0);
+    EXPECT_EQ(bp_iterator_first(&null_it), nullptr);
+    EXPECT_EQ(bp_iterator_last(&null_it), nullptr);
+
+    range.tree = &tree;
+    EXPECT_EQ(bp_iterator_first(&it), nullptr);
+    EXPECT_EQ(bp_iterator_last(&it), nullptr);
+    EXPECT_EQ(bp_iterator_next(&it), nullptr);
+    EXPECT_EQ(bp_btree_erase(&tree, 1), -ENOENT);
+    EXPECT_EQ(bp_btree_find(&tree, 1), nullptr);
+}
+
+TEST_F(Btree, InsertAndFind)
+{
+    for (uint64_t i = 0; i < 2000; ++i) {
+        uint64_t key = (i * 7919) % 2000;
+        ASSERT_EQ(bp_btree_insert(&tree, key, key * 10), 0);
+        model[key] = key * 10;
+    }
+    EXPECT_EQ(bp_btree_insert(&tree, 5, 0), -EEXIST);
+    check_tree();
+    EXPECT_GE(tree._height, 3);
+
+    for (uint64_t key = 0; key < 2000; ++key) {
+        uint64_t *value = bp_btree_find(&tree, key);
+        ASSERT_NE(value, nullptr);
+        EXPECT_EQ(*value, key * 10);
+    }
+    EXPECT_EQ(bp_btree_find(&tree, 2000), nullptr);
+
+    *bp_btree_find(&tree, 42) = 7;
+    EXPECT_EQ(*bp_btree_find(&tree, 42), 7);
+}
+
+TEST_F(Btree, ExtremeKeys)
+{
+    EXPECT_EQ(bp_btree_insert(&tree, UINT64_MAX, 1), 0);
+    EXPECT_EQ(bp_btree_insert(&tree, 0, 2), 0);
+    for (uint64_t i = 1; i < 100; ++i) {
+        EXPECT_EQ(bp_btree_insert(&tree, UINT64_MAX - i, 3), 0);
+    }
+
+    EXPECT_EQ(*bp_btree_find(&tree, UINT64_MAX), 1);
+    EXPECT_EQ(*bp_btree_find(&tree, 0), 2);
+    EXPECT_EQ(bp_btree_insert(&tree, UINT64_MAX, 1), -EEXIST);
+    EXPECT_EQ(bp_btree_erase(&tree, UINT64_MAX), 0);
+    EXPECT_EQ(bp_btree_find(&tree, UINT64_MAX), nullptr);
+    EXPECT_NE(bp_btree_find(&tree, UINT64_MAX - 1), nullptr);
+}
+
+TEST_F(Btree, LowerBound)
+{
+    uint64_t found = 0;
+
+    for (uint64_t key = 10; key <= 1000; key += 10) {
+        bp_btree_insert(&tree, key, key + 1);
+    }
+
+    EXPECT_EQ(*bp_btree_lower_bound(&tree, 0, &found), 11);
+    EXPECT_EQ(found, 10);
+    EXPECT_EQ(*bp_btree_lower_bound(&tree, 10, &found), 11);
+    EXPECT_EQ(*bp_btree_lower_bound(&tree, 11, &found), 21);
+    EXPECT_EQ(found, 20);
+    EXPECT_EQ(*bp_btree_lower_bound(&tree, 995, nullptr), 1001);
+    EXPECT_EQ(bp_btree_lower_bound(&tree, 1001, &found), nullptr);
+
+    /* Every key of some leaf is less than the searched key. */
+    for (uint64_t key = 1; key < 1000; ++key) {
+        ASSERT_NE(bp_btree_lower_bound(&tree, key, &found), nullptr);
+        EXPECT_EQ(found, (key + 9) / 10 * 10);
+    }
+}
+
+TEST_F(Btree, OutOfNodes)
+{
+    BP_BTREE_POOL(small, 3) = {};
+    bp_btree_t small_tree   = BP_BTREE_INIT(small);
+    int ret                 = 0;
+    uint64_t key            = 0;
+
+    EXPECT_EQ((uintptr_t) small % BP_CACHE_LINE_SIZE, 0);
+
+    while ((ret = bp_btree_insert(&small_tree, key, key)) == 0) {
+        key += 1;
+    }
+
+    EXPECT_EQ(ret, -ENOMEM);
+    EXPECT_EQ(bp_btree_size(&small_tree), key);
+    for (uint64_t k = 0; k < key; ++k) {
+        EXPECT_NE(bp_btree_find(&small_tree, k), nullptr);
+    }
+}
+
+TEST_F(Btree, EraseAll)
+{
+    for (uint64_t key = 0; key < 3000; ++key) {
+        bp_btree_insert(&tree, key, key);
+        model[key] = key;
+    }
+
+    for (uint64_t i = 0; i < 3000; ++i) {
+        uint64_t key = (i * 1237) % 3000;
+        ASSERT_EQ(bp_btree_erase(&tree, key), 0);
+        EXPECT_EQ(bp_btree_erase(&tree, key), -ENOENT);
+        model.erase(key);
+        if (i % 97 == 0) {
+            check_tree();
+        }
+    }
+
+    check_tree();
+    EXPECT_EQ(tree._root, 0);
+    EXPECT_EQ(tree._height, 0);
+}
+
+TEST_F(Btree, RandomOperations)
+{
+    srand(44);
+    for (int i = 0; i < 40000; ++i) {
+        uint64_t key = (uint64_t) rand() % 4000;
+        if (rand() % 3 != 0) {
+            int ret = bp_btree_insert(&tree, key, key ^ 0xABCD);
+            ASSERT_EQ(ret, model.count(key) ? -EEXIST : 0);
+            model[key] = key ^ 0xABCD;
+        } else {
+            ASSERT_EQ(bp_btree_erase(&tree, key), model.erase(key) ? 0 : -ENOENT);
+        }
+        if (i % 1000 == 0) {
+            check_tree();
+        }
+    }
+
+    check_tree();
+    for (auto &kv : model) {
+        ASSERT_NE(bp_btree_find(&tree, kv.first), nullptr);
+        EXPECT_EQ(*bp_btree_find(&tree, kv.first), kv.second);
+    }
+}
+
+TEST_F(Btree, IterateAll)
+{
+    srand(45);
+    for (int i = 0; i < 1000; ++i) {
+        uint64_t key = (uint64_t) rand();
+        if (bp_btree_insert(&tree, key, key + 1) == 0) {
+            model[key] = key + 1;
+        }
+    }
+
+    bp_iterator_t it = bp_btree_iterator(&tree);
+    auto expected    = model.begin();
+
+    BP_FOREACH_FOWARD(uint64_t, value, &it)
+    {
+        ASSERT_NE(expected, model.end());
+        EXPECT_EQ(bp_btree_iterator_key(&it), expected->first);
+        EXPECT_EQ(*value, expected->second);
+        EXPECT_EQ(bp_iterator_get(&it), value);
+        ++expected;
+    }
+    EXPECT_EQ(expected, model.end());
+
+    auto rexpected = model.rbegin();
+    for (auto *value = (uint64_t *) bp_iterator_last(&it); value != nullptr;
+         value       = (uint64_t *) bp_iterator_prev(&it)) {
+        ASSERT_NE(rexpected, model.rend());
+        EXPECT_EQ(*value, rexpected->second);
+        ++rexpected;
+    }
+    EXPECT_EQ(rexpected, model.rend());
+}
+
+TEST_F(Btree, IterateRange)
+{
+    for (uint64_t key = 0; key < 1000; key += 3) {
+        bp_btree_insert(&tree, key, key);
+        model[key] = key;
+    }
+
+    std::vector<std::pair<uint64_t, uint64_t>> ranges = {
+        {0, 1000}, {100, 200}, {101, 102}, {99, 100}, {500, 500}, {990, 5000}, {2000, 3000},
+    };
+
+    for (auto &r : ranges) {
+        bp_btree_range_t range = {&tree, r.first, r.second};
+        bp_iterator_t it       = bp_btree_range_iterator(&range);
+        std::vector<uint64_t> found, expected, rfound;
+
+        for (auto kv = model.lower_bound(r.first); kv != model.end() && kv->first < r.second;
+             ++kv) {
+            expected.push_back(kv->first);
+        }
+        BP_FOREACH_FOWARD(uint64_t, value, &it)
+        {
+            found.push_back(*value);
+        }
+        for (auto *value = (uint64_t *) bp_iterator_last(&it); value != nullptr;
+             value       = (uint64_t *) bp_iterator_prev(&it)) {
+            rfound.insert(rfound.begin(), *value);
+        }
+
+        EXPECT_EQ(found, expected) << "[" << r.first << ", " << r.second << ")";
+        EXPECT_EQ(rfound, expected) << "[" << r.first << ", " << r.second << ")";
+    }
+}
+
+TEST_F(Btree, Clear)
+{
+    for (uint64_t key = 0; key < 500; ++key) {
+        bp_btree_insert(&tree, key, key);
+    }
+
+    EXPECT_EQ(bp_btree_clear(&tree), 0);
+    check_tree();
+    EXPECT_EQ(bp_btree_find(&tree, 1), nullptr);
+
+    for (uint64_t key = 0; key < 500; ++key) {
+        model[key] = key;
+        ASSERT_EQ(bp_btree_insert(&tree, key, key), 0);
+    }
+    check_tree();
+}
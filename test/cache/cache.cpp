@@ -0,0 +1,211 @@
+/**
+ * @file cache.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <list>
+#include "bp_cache.h"
+
+extern "C" {
+typedef struct {
+    uint32_t key;
+    uint32_t value;
+} cache_kv_t;
+}
+
+typedef BP_CACHE_BUFFER(cache_kv_t, 4, 4) cache_buffer_t;
+
+TEST(Cache, NullArguments)
+{
+    cache_buffer_t buffer = {};
+    bp_cache_t cache      = BP_LRU_CACHE_INIT(buffer, sizeof(uint32_t));
+    cache_kv_t kv         = {};
+
+    EXPECT_EQ(bp_cache_put(nullptr, &kv, nullptr), -ENODEV);
+    EXPECT_EQ(bp_cache_put(&cache, nullptr, nullptr), -EINVAL);
+    EXPECT_EQ(bp_cache_get(nullptr, &kv.key), nullptr);
+    EXPECT_EQ(bp_cache_get(&cache, nullptr), nullptr);
+    EXPECT_EQ(bp_cache_del(nullptr, &kv.key), -ENODEV);
+    EXPECT_EQ(bp_cache_del(&cache, nullptr), -EINVAL);
+    EXPECT_EQ(bp_cache_clear(nullptr), -ENODEV);
+    EXPECT_EQ(bp_cache_size(nullptr), 0);
+}
+
+TEST(Cache, InvalidBuckets)
+{
+    BP_CACHE_BUFFER(cache_kv_t, 4, 3) buffer = {};
+    bp_cache_t cache                         = BP_LRU_CACHE_INIT(buffer, sizeof(uint32_t));
+    cache_kv_t kv                            = {1, 1};
+
+    EXPECT_EQ(bp_cache_put(&cache, &kv, nullptr), -EINVAL);
+    EXPECT_EQ(bp_cache_get(&cache, &kv.key), nullptr);
+    EXPECT_EQ(bp_cache_del(&cache, &kv.key), -EINVAL);
+}
+
+TEST(Cache, LruEvictsLeastRecentlyUsed)
+{
+    cache_buffer_t buffer = {};
+    bp_cache_t cache      = BP_LRU_CACHE_INIT(buffer, sizeof(uint32_t));
+    cache_kv_t evicted;
+
+    for (uint32_t i = 0; i < 4; ++i) {
+        cache_kv_t kv = {i, i * 10};
+        EXPECT_EQ(bp_cache_put(&cache, &kv, &evicted), 0);
+    }
+    EXPECT_EQ(bp_cache_size(&cache), 4);
+
+    /* 0 becomes the most recently used, so 1 is the next to go. */
+    uint32_t key = 0;
+    ASSERT_NE(bp_cache_get(&cache, &key), nullptr);
+
+    cache_kv_t kv = {4, 40};
+    EXPECT_EQ(bp_cache_put(&cache, &kv, &evicted), 1);
+    EXPECT_EQ(evicted.key, 1);
+    EXPECT_EQ(evicted.value, 10);
+    EXPECT_EQ(bp_cache_size(&cache), 4);
+
+    key = 1;
+    EXPECT_EQ(bp_cache_get(&cache, &key), nullptr);
+    key = 4;
+    EXPECT_EQ(((cache_kv_t *) bp_cache_get(&cache, &key))->value, 40);
+
+    kv = {5, 50};
+    EXPECT_EQ(bp_cache_put(&cache, &kv, nullptr), 1);
+    key = 2;
+    EXPECT_EQ(bp_cache_get(&cache, &key), nullptr);
+}
+
+TEST(Cache, PutReplaces)
+{
+    cache_buffer_t buffer = {};
+    bp_cache_t cache      = BP_LRU_CACHE_INIT(buffer, sizeof(uint32_t));
+
+    for (uint32_t i = 0; i < 4; ++i) {
+        cache_kv_t kv = {i, i};
+        bp_cache_put(&cache, &kv, nullptr);
+    }
+    cache_kv_t kv = {0, 100};
+    EXPECT_EQ(bp_cache_put(&cache, &kv, nullptr), 0);
+    EXPECT_EQ(bp_cache_size(&cache), 4);
+
+    uint32_t key = 0;
+    EXPECT_EQ(((cache_kv_t *) bp_cache_get(&cache, &key))->value, 100);
+
+    /* The replaced element is the most recently used. */
+    cache_kv_t evicted;
+    kv = {9, 9};
+    EXPECT_EQ(bp_cache_put(&cache, &kv, &evicted), 1);
+    EXPECT_EQ(evicted.key, 1);
+}
+
+TEST(Cache, DelReusesSlot)
+{
+    cache_buffer_t buffer = {};
+    bp_cache_t cache      = BP_LRU_CACHE_INIT(buffer, sizeof(uint32_t));
+
+    for (uint32_t i = 0; i < 4; ++i) {
+        cache_kv_t kv = {i, i};
+        bp_cache_put(&cache, &kv, nullptr);
+    }
+    uint32_t key = 2;
+    EXPECT_EQ(bp_cache_del(&cache, &key), 0);
+    EXPECT_EQ(bp_cache_del(&cache, &key), -ENOENT);
+    EXPECT_EQ(bp_cache_size(&cache), 3);
+
+    cache_kv_t kv = {7, 7};
+    EXPECT_EQ(bp_cache_put(&cache, &kv, nullptr), 0);
+    EXPECT_EQ(bp_cache_size(&cache), 4);
+    for (uint32_t k : {0U, 1U, 3U, 7U}) {
+        EXPECT_NE(bp_cache_get(&cache, &k), nullptr);
+    }
+
+    EXPECT_EQ(bp_cache_clear(&cache), 0);
+    EXPECT_EQ(bp_cache_size(&cache), 0);
+    EXPECT_EQ(bp_cache_get(&cache, &kv.key), nullptr);
+    EXPECT_EQ(bp_cache_put(&cache, &kv, nullptr), 0);
+}
+
+TEST(Cache, ClockGivesSecondChance)
+{
+    cache_buffer_t buffer = {};
+    bp_cache_t cache      = BP_CLOCK_CACHE_INIT(buffer, sizeof(uint32_t));
+    cache_kv_t evicted;
+
+    for (uint32_t i = 0; i < 4; ++i) {
+        cache_kv_t kv = {i, i};
+        EXPECT_EQ(bp_cache_put(&cache, &kv, nullptr), 0);
+    }
+
+    /* All are referenced: the hand clears every flag and evicts the first slot. */
+    cache_kv_t kv = {4, 4};
+    EXPECT_EQ(bp_cache_put(&cache, &kv, &evicted), 1);
+    EXPECT_EQ(evicted.key, 0);
+
+    /* 1 is used again, so 2 is evicted instead. */
+    uint32_t key = 1;
+    ASSERT_NE(bp_cache_get(&cache, &key), nullptr);
+    kv = {5, 5};
+    EXPECT_EQ(bp_cache_put(&cache, &kv, &evicted), 1);
+    EXPECT_EQ(evicted.key, 2);
+    EXPECT_EQ(bp_cache_size(&cache), 4);
+}
+
+TEST(Cache, LruAgainstReference)
+{
+    BP_CACHE_BUFFER(cache_kv_t, 32, 16) buffer = {};
+    bp_cache_t cache = BP_LRU_CACHE_INIT(buffer, sizeof(uint32_t));
+    std::list<uint32_t> reference;
+    uint64_t state = 7;
+
+    for (uint32_t round = 0; round < 10000; ++round) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        uint32_t key = (uint32_t) (state % 64U);
+        auto pos     = std::find(reference.begin(), reference.end(), key);
+
+        switch ((state >> 32) % 3U) {
+            case 0: {
+                cache_kv_t *kv = (cache_kv_t *) bp_cache_get(&cache, &key);
+                ASSERT_EQ(kv != nullptr, pos != reference.end());
+                if (kv != nullptr) {
+                    EXPECT_EQ(kv->value, key + 1);
+                    reference.erase(pos);
+                    reference.push_front(key);
+                }
+                break;
+            }
+            case 1: {
+                cache_kv_t kv = {key, key + 1};
+                cache_kv_t evicted;
+                int ret = bp_cache_put(&cache, &kv, &evicted);
+                if (pos != reference.end()) {
+                    EXPECT_EQ(ret, 0);
+                    reference.erase(pos);
+                } else if (reference.size() == 32) {
+                    EXPECT_EQ(ret, 1);
+                    EXPECT_EQ(evicted.key, reference.back());
+                    reference.pop_back();
+                } else {
+                    EXPECT_EQ(ret, 0);
+                }
+                reference.push_front(key);
+                break;
+            }
+            default:
+                EXPECT_EQ(bp_cache_del(&cache, &key), pos != reference.end() ? 0 : -ENOENT);
+                if (pos != reference.end()) {
+                    reference.erase(pos);
+                }
+                break;
+        }
+        ASSERT_EQ(bp_cache_size(&cache), reference.size());
+    }
+}
@@ -0,0 +1,160 @@
+/**
+ * @file chashmap.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include "bp_chashmap.h"
+#include "bp_thread_pool.h"
+
+extern "C" {
+typedef struct {
+    uint64_t key;
+    uint64_t value;
+    uint64_t check;
+} chashmap_el_t;
+
+typedef struct {
+    bp_chashmap_t *map;
+    size_t rounds;
+    size_t torn;
+    size_t found;
+} chashmap_stress_t;
+
+static void chashmap_stress(void *arg, size_t worker, size_t nworkers)
+{
+    chashmap_stress_t *stress = (chashmap_stress_t *) arg;
+    size_t torn               = 0;
+    size_t found              = 0;
+
+    (void) nworkers;
+    for (size_t i = 0; i < stress->rounds; ++i) {
+        uint64_t key = i % 512U;
+
+        if (worker == 0) {
+            /* The writer keeps changing the value, and the check always matches it. */
+            chashmap_el_t el = {key, i, ~i};
+            if (i % 3U == 0) {
+                bp_chashmap_erase(stress->map, &key);
+            } else {
+                bp_chashmap_put(stress->map, &el);
+            }
+        } else {
+            chashmap_el_t el;
+            if (bp_chashmap_find(stress->map, &key, &el) == 0) {
+                found += 1;
+                torn += (el.key != key || el.check != ~el.value);
+            }
+        }
+    }
+
+    __atomic_fetch_add(&stress->torn, torn, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&stress->found, found, __ATOMIC_RELAXED);
+}
+}
+
+static BP_CHASHMAP_BUFFER(chashmap_el_t, 8, 256) chashmap_buffer;
+
+TEST(ConcurrentHashmap, NullArguments)
+{
+    BP_CHASHMAP_BUFFER(chashmap_el_t, 2, 16) buffer = {};
+    bp_chashmap_t map = BP_CHASHMAP_INIT(buffer, sizeof(uint64_t));
+    chashmap_el_t el  = {};
+
+    EXPECT_EQ(bp_chashmap_insert(nullptr, &el), -ENODEV);
+    EXPECT_EQ(bp_chashmap_insert(&map, nullptr), -EINVAL);
+    EXPECT_EQ(bp_chashmap_put(nullptr, &el), -ENODEV);
+    EXPECT_EQ(bp_chashmap_put(&map, nullptr), -EINVAL);
+    EXPECT_EQ(bp_chashmap_find(nullptr, &el.key, &el), -ENODEV);
+    EXPECT_EQ(bp_chashmap_find(&map, nullptr, &el), -EINVAL);
+    EXPECT_EQ(bp_chashmap_find(&map, &el.key, nullptr), -EINVAL);
+    EXPECT_EQ(bp_chashmap_erase(nullptr, &el.key), -ENODEV);
+    EXPECT_EQ(bp_chashmap_erase(&map, nullptr), -EINVAL);
+    EXPECT_EQ(bp_chashmap_clear(nullptr), -ENODEV);
+    EXPECT_EQ(bp_chashmap_size(nullptr), 0);
+}
+
+TEST(ConcurrentHashmap, InsertFindErase)
+{
+    bp_chashmap_t map = BP_CHASHMAP_INIT(chashmap_buffer, sizeof(uint64_t));
+
+    EXPECT_EQ(sizeof(bp_chashmap_stripe_t), BP_CACHE_LINE_SIZE);
+    for (uint64_t i = 0; i < 1000; ++i) {
+        chashmap_el_t el = {i, i * 3, 0};
+        EXPECT_EQ(bp_chashmap_insert(&map, &el), 0);
+    }
+    EXPECT_EQ(bp_chashmap_size(&map), 1000);
+
+    chashmap_el_t el = {5, 0, 0};
+    EXPECT_EQ(bp_chashmap_insert(&map, &el), -EEXIST);
+
+    for (uint64_t i = 0; i < 1000; ++i) {
+        EXPECT_EQ(bp_chashmap_find(&map, &i, &el), 0);
+        EXPECT_EQ(el.value, i * 3);
+    }
+    uint64_t key = 1000;
+    EXPECT_EQ(bp_chashmap_find(&map, &key, &el), -ENOENT);
+
+    for (uint64_t i = 0; i < 1000; i += 2) {
+        EXPECT_EQ(bp_chashmap_erase(&map, &i), 0);
+    }
+    key = 0;
+    EXPECT_EQ(bp_chashmap_erase(&map, &key), -ENOENT);
+    EXPECT_EQ(bp_chashmap_size(&map), 500);
+    key = 1;
+    EXPECT_EQ(bp_chashmap_find(&map, &key, &el), 0);
+
+    EXPECT_EQ(bp_chashmap_clear(&map), 0);
+    EXPECT_EQ(bp_chashmap_size(&map), 0);
+    EXPECT_EQ(bp_chashmap_find(&map, &key, &el), -ENOENT);
+}
+
+TEST(ConcurrentHashmap, Put)
+{
+    BP_CHASHMAP_BUFFER(chashmap_el_t, 4, 16) buffer = {};
+    bp_chashmap_t map = BP_CHASHMAP_INIT(buffer, sizeof(uint64_t));
+    chashmap_el_t el  = {7, 1, 0};
+
+    EXPECT_EQ(bp_chashmap_put(&map, &el), 0);
+    el.value = 2;
+    EXPECT_EQ(bp_chashmap_put(&map, &el), 0);
+    EXPECT_EQ(bp_chashmap_size(&map), 1);
+
+    chashmap_el_t out;
+    EXPECT_EQ(bp_chashmap_find(&map, &el.key, &out), 0);
+    EXPECT_EQ(out.value, 2);
+}
+
+TEST(ConcurrentHashmap, StripeFull)
+{
+    BP_CHASHMAP_BUFFER(chashmap_el_t, 1, 16) buffer = {};
+    bp_chashmap_t map = BP_CHASHMAP_INIT(buffer, sizeof(uint64_t));
+
+    for (uint64_t i = 0; i < 14; ++i) {
+        chashmap_el_t el = {i, i, 0};
+        EXPECT_EQ(bp_chashmap_insert(&map, &el), 0);
+    }
+    chashmap_el_t el = {14, 14, 0};
+    EXPECT_EQ(bp_chashmap_insert(&map, &el), -ENOMEM);
+    EXPECT_EQ(bp_chashmap_put(&map, &el), -ENOMEM);
+}
+
+TEST(ConcurrentHashmap, ReadersNeverSeeTornElements)
+{
+    BP_CHASHMAP_BUFFER(chashmap_el_t, 4, 256) buffer = {};
+    bp_chashmap_t map                                 = BP_CHASHMAP_INIT(buffer, sizeof(uint64_t));
+    chashmap_stress_t stress                          = {&map, 200000, 0, 0};
+    bp_thread_pool_t pool;
+
+    ASSERT_EQ(bp_thread_pool_init(&pool, 4), 0);
+    EXPECT_EQ(bp_thread_pool_run(&pool, chashmap_stress, &stress), 0);
+    EXPECT_EQ(bp_thread_pool_deinit(&pool), 0);
+
+    EXPECT_EQ(stress.torn, 0);
+    EXPECT_GT(stress.found, 0);
+}
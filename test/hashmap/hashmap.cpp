@@ -0,0 +1,200 @@
+/**
+ * @file hashmap.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include <map>
+#include "bp_hashmap.h"
+
+extern "C" {
+typedef struct {
+    uint32_t key;
+    uint32_t value;
+} hashmap_kv_t;
+
+typedef struct {
+    char key[12];
+    uint16_t value;
+} hashmap_str_t;
+}
+
+static BP_HASHMAP_BUFFER(hashmap_kv_t, 64) static_buffer;
+
+TEST(Hashmap, NullArguments)
+{
+    uint8_t ctrl[32];
+    hashmap_kv_t slots[16];
+    uint32_t key = 0;
+
+    EXPECT_EQ(bp_hashmap_init(nullptr, ctrl, slots, sizeof(hashmap_kv_t), 16, 4), -ENODEV);
+    EXPECT_EQ(bp_hashmap_insert(nullptr, &key), -ENODEV);
+    EXPECT_EQ(bp_hashmap_find(nullptr, &key), nullptr);
+    EXPECT_EQ(bp_hashmap_erase(nullptr, &key), -ENODEV);
+    EXPECT_EQ(bp_hashmap_clear(nullptr), -ENODEV);
+    EXPECT_EQ(bp_hashmap_size(nullptr), 0);
+    EXPECT_EQ(bp_hashmap_capacity(nullptr), 0);
+
+    bp_hashmap_t map;
+    EXPECT_EQ(bp_hashmap_init(&map, ctrl, slots, sizeof(hashmap_kv_t), 16, 4), 0);
+    EXPECT_EQ(bp_hashmap_insert(&map, nullptr), -EINVAL);
+    EXPECT_EQ(bp_hashmap_find(&map, nullptr), nullptr);
+    EXPECT_EQ(bp_hashmap_erase(&map, nullptr), -EINVAL);
+}
+
+TEST(Hashmap, InitInvalid)
+{
+    uint8_t ctrl[64];
+    hashmap_kv_t slots[48];
+    bp_hashmap_t map;
+
+    EXPECT_EQ(bp_hashmap_init(&map, nullptr, slots, sizeof(hashmap_kv_t), 16, 4), -EINVAL);
+    EXPECT_EQ(bp_hashmap_init(&map, ctrl, nullptr, sizeof(hashmap_kv_t), 16, 4), -EINVAL);
+    EXPECT_EQ(bp_hashmap_init(&map, ctrl, slots, sizeof(hashmap_kv_t), 8, 4), -EINVAL);
+    EXPECT_EQ(bp_hashmap_init(&map, ctrl, slots, sizeof(hashmap_kv_t), 48, 4), -EINVAL);
+    EXPECT_EQ(bp_hashmap_init(&map, ctrl, slots, sizeof(hashmap_kv_t), 16, 0), -EINVAL);
+    EXPECT_EQ(bp_hashmap_init(&map, ctrl, slots, sizeof(hashmap_kv_t), 16, 12), -EINVAL);
+
+    /* A map with an invalid capacity, from the static initializer, is rejected. */
+    BP_HASHMAP_BUFFER(hashmap_kv_t, 8) small = {};
+    bp_hashmap_t small_map                   = BP_HASHMAP_INIT(small, sizeof(uint32_t));
+    hashmap_kv_t kv                          = {1, 1};
+    EXPECT_EQ(bp_hashmap_insert(&small_map, &kv), -EINVAL);
+    EXPECT_EQ(bp_hashmap_find(&small_map, &kv.key), nullptr);
+}
+
+TEST(Hashmap, StaticBuffer)
+{
+    bp_hashmap_t map = BP_HASHMAP_INIT(static_buffer, sizeof(uint32_t));
+
+    EXPECT_EQ(bp_hashmap_capacity(&map), 64);
+    for (uint32_t i = 0; i < 20; ++i) {
+        hashmap_kv_t kv = {i * 7, i};
+        EXPECT_EQ(bp_hashmap_insert(&map, &kv), 0);
+    }
+    EXPECT_EQ(bp_hashmap_size(&map), 20);
+
+    for (uint32_t i = 0; i < 20; ++i) {
+        uint32_t key     = i * 7;
+        hashmap_kv_t *kv = (hashmap_kv_t *) bp_hashmap_find(&map, &key);
+        ASSERT_NE(kv, nullptr);
+        EXPECT_EQ(kv->key, key);
+        EXPECT_EQ(kv->value, i);
+    }
+    uint32_t key = 1;
+    EXPECT_EQ(bp_hashmap_find(&map, &key), nullptr);
+
+    EXPECT_EQ(bp_hashmap_clear(&map), 0);
+    EXPECT_EQ(bp_hashmap_size(&map), 0);
+    key = 7;
+    EXPECT_EQ(bp_hashmap_find(&map, &key), nullptr);
+}
+
+TEST(Hashmap, InsertExisting)
+{
+    BP_HASHMAP_BUFFER(hashmap_kv_t, 16) buffer = {};
+    bp_hashmap_t map                            = BP_HASHMAP_INIT(buffer, sizeof(uint32_t));
+    hashmap_kv_t kv                             = {42, 1};
+
+    EXPECT_EQ(bp_hashmap_insert(&map, &kv), 0);
+    kv.value = 2;
+    EXPECT_EQ(bp_hashmap_insert(&map, &kv), -EEXIST);
+
+    hashmap_kv_t *found = (hashmap_kv_t *) bp_hashmap_find(&map, &kv.key);
+    ASSERT_NE(found, nullptr);
+    EXPECT_EQ(found->value, 1);
+    found->value = 3;
+    EXPECT_EQ(((hashmap_kv_t *) bp_hashmap_find(&map, &kv.key))->value, 3);
+}
+
+TEST(Hashmap, Full)
+{
+    BP_HASHMAP_BUFFER(hashmap_kv_t, 16) buffer = {};
+    bp_hashmap_t map                            = BP_HASHMAP_INIT(buffer, sizeof(uint32_t));
+
+    for (uint32_t i = 0; i < 14; ++i) {
+        hashmap_kv_t kv = {i, i};
+        EXPECT_EQ(bp_hashmap_insert(&map, &kv), 0);
+    }
+    hashmap_kv_t kv = {100, 100};
+    EXPECT_EQ(bp_hashmap_insert(&map, &kv), -ENOMEM);
+
+    uint32_t key = 3;
+    EXPECT_EQ(bp_hashmap_erase(&map, &key), 0);
+    EXPECT_EQ(bp_hashmap_erase(&map, &key), -ENOENT);
+    EXPECT_EQ(bp_hashmap_insert(&map, &kv), 0);
+    EXPECT_NE(bp_hashmap_find(&map, &kv.key), nullptr);
+}
+
+TEST(Hashmap, StringKeys)
+{
+    BP_HASHMAP_BUFFER(hashmap_str_t, 32) buffer = {};
+    bp_hashmap_t map = BP_HASHMAP_INIT(buffer, sizeof(((hashmap_str_t *) 0)->key));
+    const char *names[] = {"alpha", "beta", "gamma", "delta", "epsilon"};
+
+    for (uint16_t i = 0; i < 5; ++i) {
+        hashmap_str_t el = {};
+        strncpy(el.key, names[i], sizeof(el.key) - 1);
+        el.value = i;
+        EXPECT_EQ(bp_hashmap_insert(&map, &el), 0);
+    }
+
+    char key[12] = "gamma";
+    hashmap_str_t *el = (hashmap_str_t *) bp_hashmap_find(&map, key);
+    ASSERT_NE(el, nullptr);
+    EXPECT_EQ(el->value, 2);
+
+    char missing[12] = "zeta";
+    EXPECT_EQ(bp_hashmap_find(&map, missing), nullptr);
+}
+
+TEST(Hashmap, ChurnAgainstReference)
+{
+    BP_HASHMAP_BUFFER(hashmap_kv_t, 64) buffer = {};
+    bp_hashmap_t map                            = BP_HASHMAP_INIT(buffer, sizeof(uint32_t));
+    std::map<uint32_t, uint32_t> reference;
+    uint64_t state     = 12345;
+    bool saw_tombstone = false;
+
+    for (uint32_t round = 0; round < 20000; ++round) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        uint32_t key = (uint32_t) (state % 200U);
+
+        if ((state >> 32) % 2 == 0) {
+            hashmap_kv_t kv = {key, round};
+            int err         = bp_hashmap_insert(&map, &kv);
+            if (reference.count(key)) {
+                EXPECT_EQ(err, -EEXIST);
+            } else if (reference.size() >= 56) {
+                EXPECT_EQ(err, -ENOMEM);
+            } else {
+                EXPECT_EQ(err, 0);
+                reference[key] = round;
+            }
+        } else {
+            EXPECT_EQ(bp_hashmap_erase(&map, &key), reference.erase(key) ? 0 : -ENOENT);
+        }
+
+        saw_tombstone = saw_tombstone || map._deleted > 0;
+        ASSERT_EQ(bp_hashmap_size(&map), reference.size());
+        ASSERT_LE(map._size + map._deleted, 56U);
+    }
+
+    EXPECT_TRUE(saw_tombstone);
+    for (uint32_t key = 0; key < 200; ++key) {
+        hashmap_kv_t *kv = (hashmap_kv_t *) bp_hashmap_find(&map, &key);
+        if (reference.count(key)) {
+            ASSERT_NE(kv, nullptr);
+            EXPECT_EQ(kv->value, reference[key]);
+        } else {
+            EXPECT_EQ(kv, nullptr);
+        }
+    }
+}
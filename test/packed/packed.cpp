@@ -0,0 +1,174 @@
+/**
+ * @file packed.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include "bp_packed.h"
+
+static uint64_t random_value(size_t bits)
+{
+    uint64_t value = ((uint64_t) rand() << 42) ^ ((uint64_t) rand() << 21) ^ (uint64_t) rand();
+
+    return bits == 64 ? value : value & ((UINT64_C(1) << bits) - 1U);
+}
+
+TEST(Packed, NullArguments)
+{
+    uint64_t buffer[BP_PACKED_WORDS(8, 5)] = {};
+    bp_packed_t packed                     = BP_PACKED_INIT(buffer, 5);
+    uint64_t out[1];
+
+    EXPECT_EQ(bp_packed_push(nullptr, 1), -ENODEV);
+    EXPECT_EQ(bp_packed_append(nullptr, out, 1), -ENODEV);
+    EXPECT_EQ(bp_packed_append(&packed, nullptr, 1), -EINVAL);
+    EXPECT_EQ(bp_packed_get(nullptr, 0), 0);
+    EXPECT_EQ(bp_packed_set(nullptr, 0, 1), -ENODEV);
+    EXPECT_EQ(bp_packed_unpack(nullptr, 0, 0, out), -ENODEV);
+    EXPECT_EQ(bp_packed_unpack(&packed, 0, 0, nullptr), -EINVAL);
+    EXPECT_EQ(bp_packed_unpack32(nullptr, 0, 0, nullptr), -ENODEV);
+    EXPECT_EQ(bp_packed_clear(nullptr), -ENODEV);
+    EXPECT_EQ(bp_packed_size(nullptr), 0);
+}
+
+TEST(Packed, Capacity)
+{
+    uint64_t buffer[BP_PACKED_WORDS(100, 12)] = {};
+    bp_packed_t packed                        = BP_PACKED_INIT(buffer, 12);
+    uint64_t zero_buffer[2]                   = {};
+    bp_packed_t invalid                       = BP_PACKED_INIT(zero_buffer, 0);
+
+    EXPECT_GE(packed._capacity, 100);
+    EXPECT_LE(packed._capacity * 12, (BP_PACKED_WORDS(100, 12) - 1) * 64);
+    EXPECT_EQ(bp_packed_push(&invalid, 0), -EINVAL);
+
+    for (size_t i = 0; i < packed._capacity; ++i) {
+        ASSERT_EQ(bp_packed_push(&packed, i), 0);
+    }
+    EXPECT_EQ(bp_packed_push(&packed, 1), -ENOMEM);
+    EXPECT_EQ(bp_packed_size(&packed), packed._capacity);
+
+    std::vector<uint32_t> out(packed._capacity);
+    ASSERT_EQ(bp_packed_unpack32(&packed, 0, out.size(), out.data()), 0);
+    for (size_t i = 0; i < out.size(); ++i) {
+        EXPECT_EQ(out[i], i);
+    }
+}
+
+TEST(Packed, ValueMustFit)
+{
+    uint64_t buffer[BP_PACKED_WORDS(8, 5)] = {};
+    bp_packed_t packed                     = BP_PACKED_INIT(buffer, 5);
+    uint64_t values[]                      = {1, 2, 32};
+
+    EXPECT_EQ(bp_packed_push(&packed, 31), 0);
+    EXPECT_EQ(bp_packed_push(&packed, 32), -EINVAL);
+    EXPECT_EQ(bp_packed_set(&packed, 0, 32), -EINVAL);
+    EXPECT_EQ(bp_packed_set(&packed, 1, 0), -EINVAL);
+    EXPECT_EQ(bp_packed_append(&packed, values, 3), -EINVAL);
+    EXPECT_EQ(bp_packed_size(&packed), 1);
+    EXPECT_EQ(bp_packed_get(&packed, 0), 31);
+    EXPECT_EQ(bp_packed_get(&packed, 1), 0);
+}
+
+TEST(Packed, EveryWidth)
+{
+    srand(42);
+    for (size_t bits = 1; bits <= 64; ++bits) {
+        uint64_t buffer[BP_PACKED_WORDS(200, 64)] = {};
+        bp_packed_t packed                        = BP_PACKED_INIT(buffer, 64);
+        std::vector<uint64_t> model;
+
+        packed._bits     = bits;
+        packed._capacity = 200;
+
+        /* Mix single pushes and bulk appends, starting at odd bit offsets. */
+        for (size_t i = 0; i < 7; ++i) {
+            model.push_back(random_value(bits));
+            ASSERT_EQ(bp_packed_push(&packed, model.back()), 0);
+        }
+        std::vector<uint64_t> bulk;
+        for (size_t i = 0; i < 150; ++i) {
+            bulk.push_back(random_value(bits));
+        }
+        ASSERT_EQ(bp_packed_append(&packed, bulk.data(), bulk.size()), 0);
+        model.insert(model.end(), bulk.begin(), bulk.end());
+        for (size_t i = 0; i < 43; ++i) {
+            model.push_back(random_value(bits));
+            ASSERT_EQ(bp_packed_push(&packed, model.back()), 0);
+        }
+        ASSERT_EQ(bp_packed_append(&packed, bulk.data(), 1), -ENOMEM);
+
+        for (size_t i = 0; i < 200; i += 3) {
+            model[i] = random_value(bits);
+            ASSERT_EQ(bp_packed_set(&packed, i, model[i]), 0);
+        }
+
+        for (size_t i = 0; i < model.size(); ++i) {
+            ASSERT_EQ(bp_packed_get(&packed, i), model[i]) << bits << " bits, index " << i;
+        }
+
+        std::vector<uint64_t> out(model.size() - 5);
+        ASSERT_EQ(bp_packed_unpack(&packed, 5, out.size(), out.data()), 0);
+        ASSERT_TRUE(std::equal(out.begin(), out.end(), model.begin() + 5)) << bits << " bits";
+    }
+}
+
+TEST(Packed, Unpack32)
+{
+    srand(43);
+    for (size_t bits = 1; bits <= 33; ++bits) {
+        uint64_t buffer[BP_PACKED_WORDS(300, 33)] = {};
+        bp_packed_t packed                        = BP_PACKED_INIT(buffer, 33);
+        std::vector<uint64_t> model;
+
+        packed._bits     = bits;
+        packed._capacity = 300;
+        for (size_t i = 0; i < 300; ++i) {
+            model.push_back(random_value(bits));
+        }
+        ASSERT_EQ(bp_packed_append(&packed, model.data(), model.size()), 0);
+
+        std::vector<uint32_t> out(300);
+        if (bits > 32) {
+            EXPECT_EQ(bp_packed_unpack32(&packed, 0, 1, out.data()), -EINVAL);
+            continue;
+        }
+
+        for (size_t start : {0, 1, 7, 13}) {
+            size_t count = 300 - start - (start % 5);
+            ASSERT_EQ(bp_packed_unpack32(&packed, start, count, out.data()), 0);
+            for (size_t i = 0; i < count; ++i) {
+                ASSERT_EQ(out[i], model[start + i]) << bits << " bits, index " << start + i;
+            }
+        }
+        EXPECT_EQ(bp_packed_unpack32(&packed, 290, 11, out.data()), -EINVAL);
+        EXPECT_EQ(bp_packed_unpack32(&packed, 301, 0, out.data()), -EINVAL);
+    }
+}
+
+TEST(Packed, Clear)
+{
+    uint64_t buffer[BP_PACKED_WORDS(64, 7)] = {};
+    bp_packed_t packed                      = BP_PACKED_INIT(buffer, 7);
+
+    for (uint64_t i = 0; i < 64; ++i) {
+        bp_packed_push(&packed, 127 - i);
+    }
+
+    EXPECT_EQ(bp_packed_clear(&packed), 0);
+    EXPECT_EQ(bp_packed_size(&packed), 0);
+
+    uint64_t values[] = {1, 2, 3};
+    EXPECT_EQ(bp_packed_append(&packed, values, 3), 0);
+    EXPECT_EQ(bp_packed_get(&packed, 0), 1);
+    EXPECT_EQ(bp_packed_get(&packed, 1), 2);
+    EXPECT_EQ(bp_packed_get(&packed, 2), 3);
+}
@@ -0,0 +1,168 @@
+/**
+ * @file pool.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include "bp_pool.h"
+
+TEST(Pool, NullArguments)
+{
+    bp_array_t array;
+    bp_stack_t stack;
+    bp_ring_t ring;
+    uint8_t blocks[4][32];
+    uint32_t free_buffer[4];
+    bp_pool_t pool = BP_POOL_INIT(blocks, free_buffer);
+
+    EXPECT_EQ(bp_pool_alloc(nullptr), nullptr);
+    EXPECT_EQ(bp_pool_free(nullptr, blocks[0]), -ENODEV);
+    EXPECT_EQ(bp_pool_reset(nullptr), -ENODEV);
+    EXPECT_EQ(bp_pool_available(nullptr), 0);
+    EXPECT_EQ(bp_pool_block_size(nullptr), 0);
+    EXPECT_EQ(bp_pool_array_init(nullptr, &array, 4), -ENODEV);
+    EXPECT_EQ(bp_pool_array_init(&pool, nullptr, 4), -ENODEV);
+    EXPECT_EQ(bp_pool_stack_init(nullptr, &stack, 4), -ENODEV);
+    EXPECT_EQ(bp_pool_stack_init(&pool, nullptr, 4), -ENODEV);
+    EXPECT_EQ(bp_pool_ring_init(nullptr, &ring, 4), -ENODEV);
+    EXPECT_EQ(bp_pool_ring_init(&pool, nullptr, 4), -ENODEV);
+}
+
+TEST(Pool, AllocUntilEmpty)
+{
+    uint8_t blocks[4][32];
+    uint32_t free_buffer[4];
+    bp_pool_t pool = BP_POOL_INIT(blocks, free_buffer);
+
+    EXPECT_EQ(bp_pool_block_size(&pool), 32);
+    EXPECT_EQ(bp_pool_available(&pool), 4);
+    for (size_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(bp_pool_alloc(&pool), blocks[i]);
+    }
+    EXPECT_EQ(bp_pool_alloc(&pool), nullptr);
+    EXPECT_EQ(bp_pool_available(&pool), 0);
+}
+
+TEST(Pool, FreeReusesLastBlock)
+{
+    uint8_t blocks[4][32];
+    uint32_t free_buffer[4];
+    bp_pool_t pool = BP_POOL_INIT(blocks, free_buffer);
+
+    void *a = bp_pool_alloc(&pool);
+    void *b = bp_pool_alloc(&pool);
+    void *c = bp_pool_alloc(&pool);
+
+    EXPECT_EQ(bp_pool_free(&pool, a), 0);
+    EXPECT_EQ(bp_pool_free(&pool, c), 0);
+    EXPECT_EQ(bp_pool_available(&pool), 3);
+
+    EXPECT_EQ(bp_pool_alloc(&pool), c);
+    EXPECT_EQ(bp_pool_alloc(&pool), a);
+    EXPECT_EQ(bp_pool_alloc(&pool), blocks[3]);
+    EXPECT_EQ(bp_pool_alloc(&pool), nullptr);
+    (void) b;
+}
+
+TEST(Pool, FreeInvalidBlock)
+{
+    uint8_t blocks[4][32];
+    uint32_t free_buffer[4];
+    bp_pool_t pool = BP_POOL_INIT(blocks, free_buffer);
+    uint8_t other[32];
+
+    bp_pool_alloc(&pool);
+    EXPECT_EQ(bp_pool_free(&pool, other), -EFAULT);
+    EXPECT_EQ(bp_pool_free(&pool, &blocks[0][4]), -EFAULT);
+    EXPECT_EQ(bp_pool_free(&pool, blocks[1]), -EFAULT);
+    EXPECT_EQ(bp_pool_free(&pool, blocks[0]), 0);
+}
+
+TEST(Pool, DoubleFreeOfEveryBlock)
+{
+    uint8_t blocks[4][32];
+    uint32_t free_buffer[4];
+    bp_pool_t pool = BP_POOL_INIT(blocks, free_buffer);
+
+    void *a = bp_pool_alloc(&pool);
+    void *b = bp_pool_alloc(&pool);
+
+    EXPECT_EQ(bp_pool_free(&pool, a), 0);
+    EXPECT_EQ(bp_pool_free(&pool, b), 0);
+    EXPECT_EQ(bp_pool_free(&pool, a), -EFAULT);
+    EXPECT_EQ(bp_pool_available(&pool), 4);
+}
+
+TEST(Pool, Reset)
+{
+    uint8_t blocks[4][32];
+    uint32_t free_buffer[4];
+    bp_pool_t pool = BP_POOL_INIT(blocks, free_buffer);
+
+    bp_pool_free(&pool, bp_pool_alloc(&pool));
+    bp_pool_alloc(&pool);
+    bp_pool_alloc(&pool);
+
+    EXPECT_EQ(bp_pool_reset(&pool), 0);
+    EXPECT_EQ(bp_pool_available(&pool), 4);
+    EXPECT_EQ(bp_pool_alloc(&pool), blocks[0]);
+}
+
+TEST(Pool, ContainersFromPool)
+{
+    BP_POOL_BUFFER(blocks, 3, 32);
+    uint32_t free_buffer[3];
+    bp_pool_t pool = BP_POOL_INIT(blocks, free_buffer);
+    bp_array_t array;
+    bp_stack_t stack;
+    bp_ring_t ring;
+
+    EXPECT_EQ(bp_pool_array_init(&pool, &array, 0), -EINVAL);
+    EXPECT_EQ(bp_pool_array_init(&pool, &array, 64), -EINVAL);
+
+    EXPECT_EQ(bp_pool_array_init(&pool, &array, sizeof(uint32_t)), 0);
+    EXPECT_EQ(bp_pool_stack_init(&pool, &stack, 3), 0);
+    EXPECT_EQ(bp_pool_ring_init(&pool, &ring, sizeof(uint64_t)), 0);
+    EXPECT_EQ(bp_pool_array_init(&pool, &array, sizeof(uint32_t)), -ENOMEM);
+
+    EXPECT_EQ(array._capacity, 8);
+    EXPECT_EQ(stack._capacity, 10);
+    EXPECT_EQ(ring._capacity, 4);
+
+    for (uint32_t i = 0; i < 8; ++i) {
+        EXPECT_EQ(bp_array_push(&array, &i), 0);
+    }
+    uint32_t el = 8;
+    EXPECT_EQ(bp_array_push(&array, &el), -ENOMEM);
+
+    EXPECT_EQ(bp_pool_free(&pool, array._array), 0);
+    EXPECT_EQ(bp_pool_array_init(&pool, &array, sizeof(uint16_t)), 0);
+    EXPECT_EQ(array._capacity, 16);
+}
+
+TEST(Pool, MisalignedBlocks)
+{
+    BP_POOL_BUFFER(blocks, 2, 32);
+    uint32_t free_buffer[2];
+    bp_pool_t pool  = BP_POOL_INIT(blocks, free_buffer);
+    bp_pool_t moved = pool;
+    bp_array_t array;
+
+    EXPECT_EQ((uintptr_t) blocks % BP_POOL_ALIGN, 0);
+
+    /* Blocks that start off by one byte only hold bytes. */
+    moved._blocks += 1;
+    moved._capacity = 1;
+    EXPECT_EQ(bp_pool_array_init(&moved, &array, sizeof(uint64_t)), -EINVAL);
+    EXPECT_EQ(bp_pool_array_init(&moved, &array, sizeof(uint8_t)), 0);
+
+    /* Blocks of 12 bytes don't keep the second one aligned to 8. */
+    pool._block_size = 12;
+    EXPECT_EQ(bp_pool_array_init(&pool, &array, sizeof(uint64_t)), -EINVAL);
+    EXPECT_EQ(bp_pool_array_init(&pool, &array, sizeof(uint32_t)), 0);
+}
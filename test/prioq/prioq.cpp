@@ -0,0 +1,169 @@
+/**
+ * @file prioq.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include <deque>
+#include <vector>
+#include "bp_prioq.h"
+
+class Prioq : public ::testing::Test
+{
+   protected:
+    uint32_t buffers[32][8] = {};
+    bp_ring_t levels[32];
+    bp_prioq_t queue = BP_PRIOQ_INIT(levels);
+
+    void SetUp() override
+    {
+        for (size_t i = 0; i < 32; ++i) {
+            bp_ring_t ring = BP_RING_INIT(buffers[i]);
+            levels[i]      = ring;
+        }
+    }
+};
+
+TEST_F(Prioq, NullArguments)
+{
+    uint32_t el = 0;
+
+    EXPECT_EQ(bp_prioq_push(nullptr, 0, &el), -ENODEV);
+    EXPECT_EQ(bp_prioq_push(&queue, 0, nullptr), -ENODEV);
+    EXPECT_EQ(bp_prioq_peek(nullptr, nullptr), nullptr);
+    EXPECT_EQ(bp_prioq_pop(nullptr, &el, nullptr), -ENODEV);
+    EXPECT_EQ(bp_prioq_pop_level(nullptr, 0, &el), -ENODEV);
+    EXPECT_EQ(bp_prioq_clear(nullptr), -ENODEV);
+    EXPECT_EQ(bp_prioq_size(nullptr), 0);
+    EXPECT_EQ(bp_prioq_level_size(nullptr, 0), 0);
+}
+
+TEST_F(Prioq, InvalidLevel)
+{
+    uint32_t el = 0;
+
+    EXPECT_EQ(queue._nlevels, 32);
+    EXPECT_EQ(bp_prioq_push(&queue, 32, &el), -EINVAL);
+    EXPECT_EQ(bp_prioq_pop_level(&queue, 32, &el), -EINVAL);
+    EXPECT_EQ(bp_prioq_level_size(&queue, 32), 0);
+    EXPECT_EQ(bp_prioq_pop_level(&queue, 3, &el), -ENOENT);
+}
+
+TEST_F(Prioq, EmptyQueue)
+{
+    uint32_t el  = 0;
+    size_t level = 99;
+
+    EXPECT_EQ(bp_prioq_peek(&queue, &level), nullptr);
+    EXPECT_EQ(bp_prioq_pop(&queue, &el, &level), -ENOENT);
+    EXPECT_EQ(level, 99);
+    EXPECT_EQ(bp_prioq_size(&queue), 0);
+}
+
+TEST_F(Prioq, HighestLevelFirst)
+{
+    uint32_t el;
+    size_t level;
+
+    for (uint32_t i = 0; i < 3; ++i) {
+        el = 100 + i;
+        EXPECT_EQ(bp_prioq_push(&queue, 20, &el), 0);
+        el = 200 + i;
+        EXPECT_EQ(bp_prioq_push(&queue, 31, &el), 0);
+        el = 300 + i;
+        EXPECT_EQ(bp_prioq_push(&queue, 5, &el), 0);
+    }
+    EXPECT_EQ(bp_prioq_size(&queue), 9);
+    EXPECT_EQ(bp_prioq_level_size(&queue, 20), 3);
+
+    EXPECT_EQ(*(uint32_t *) bp_prioq_peek(&queue, &level), 300);
+    EXPECT_EQ(level, 5);
+
+    std::vector<uint32_t> order;
+    std::vector<size_t> order_levels;
+    while (bp_prioq_pop(&queue, &el, &level) == 0) {
+        order.push_back(el);
+        order_levels.push_back(level);
+    }
+    EXPECT_EQ(order, std::vector<uint32_t>({300, 301, 302, 100, 101, 102, 200, 201, 202}));
+    EXPECT_EQ(order_levels, std::vector<size_t>({5, 5, 5, 20, 20, 20, 31, 31, 31}));
+    EXPECT_EQ(queue._bitmap, 0);
+}
+
+TEST_F(Prioq, FullLevel)
+{
+    uint32_t el = 0;
+
+    for (uint32_t i = 0; i < 8; ++i) {
+        EXPECT_EQ(bp_prioq_push(&queue, 7, &i), 0);
+    }
+    EXPECT_EQ(bp_prioq_push(&queue, 7, &el), -ENOMEM);
+    EXPECT_EQ(bp_prioq_push(&queue, 8, &el), 0);
+    EXPECT_EQ(bp_prioq_size(&queue), 9);
+
+    /* The full level kept its oldest element. */
+    EXPECT_EQ(bp_prioq_pop(&queue, &el, nullptr), 0);
+    EXPECT_EQ(el, 0);
+}
+
+TEST_F(Prioq, PopLevelAndClear)
+{
+    uint32_t el = 1;
+
+    EXPECT_EQ(bp_prioq_push(&queue, 2, &el), 0);
+    el = 2;
+    EXPECT_EQ(bp_prioq_push(&queue, 9, &el), 0);
+    EXPECT_EQ(bp_prioq_pop_level(&queue, 9, &el), 0);
+    EXPECT_EQ(el, 2);
+    EXPECT_EQ(bp_prioq_level_size(&queue, 9), 0);
+    EXPECT_EQ(queue._bitmap, UINT64_C(1) << 2);
+
+    el = 3;
+    EXPECT_EQ(bp_prioq_push(&queue, 30, &el), 0);
+    EXPECT_EQ(bp_prioq_clear(&queue), 0);
+    EXPECT_EQ(bp_prioq_size(&queue), 0);
+    EXPECT_EQ(bp_prioq_level_size(&queue, 2), 0);
+    EXPECT_EQ(bp_prioq_level_size(&queue, 30), 0);
+    EXPECT_EQ(bp_prioq_peek(&queue, nullptr), nullptr);
+}
+
+TEST_F(Prioq, RandomOperations)
+{
+    std::deque<uint32_t> model[32];
+    size_t size = 0;
+
+    srand(47);
+    for (uint32_t i = 0; i < 20000; ++i) {
+        size_t level = (size_t) rand() % 32;
+        uint32_t el;
+
+        if (rand() % 2 == 0) {
+            int ret = bp_prioq_push(&queue, level, &i);
+            ASSERT_EQ(ret, model[level].size() < 8 ? 0 : -ENOMEM);
+            if (ret == 0) {
+                model[level].push_back(i);
+                size += 1;
+            }
+        } else {
+            size_t top = 0;
+            while (top < 32 && model[top].empty()) {
+                top += 1;
+            }
+            size_t got = 0;
+            int ret    = bp_prioq_pop(&queue, &el, &got);
+            ASSERT_EQ(ret, top < 32 ? 0 : -ENOENT);
+            if (ret == 0) {
+                ASSERT_EQ(got, top);
+                ASSERT_EQ(el, model[top].front());
+                model[top].pop_front();
+                size -= 1;
+            }
+        }
+        ASSERT_EQ(bp_prioq_size(&queue), size);
+    }
+}
@@ -0,0 +1,163 @@
+/**
+ * @file ring_deque.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include <deque>
+#include <vector>
+#include "bp_ring.h"
+
+static std::vector<uint32_t> ring_contents(bp_ring_t *ring)
+{
+    std::vector<uint32_t> contents;
+
+    for (size_t i = 0; i < bp_ring_size(ring); ++i) {
+        contents.push_back(*(uint32_t *) bp_ring_get(ring, i));
+    }
+
+    return contents;
+}
+
+TEST(RingDeque, OnNullRing)
+{
+    uint32_t el = 0;
+
+    EXPECT_EQ(bp_ring_push_front(nullptr, &el), -ENODEV);
+    EXPECT_EQ(bp_ring_peek_back(nullptr), nullptr);
+    EXPECT_EQ(bp_ring_pop_back(nullptr, &el), -ENODEV);
+    EXPECT_EQ(bp_ring_push_back_n(nullptr, &el, 1), -ENODEV);
+    EXPECT_EQ(bp_ring_push_front_n(nullptr, &el, 1), -ENODEV);
+    EXPECT_EQ(bp_ring_pop_front_n(nullptr, &el, 1), -ENODEV);
+    EXPECT_EQ(bp_ring_pop_back_n(nullptr, &el, 1), -ENODEV);
+}
+
+TEST(RingDeque, OnEmptyRing)
+{
+    uint32_t buffer[4] = {0};
+    bp_ring_t ring     = BP_RING_INIT(buffer);
+    uint32_t el        = 0;
+
+    EXPECT_EQ(bp_ring_push_front(&ring, nullptr), -ENODEV);
+    EXPECT_EQ(bp_ring_push_back_n(&ring, nullptr, 1), -ENODEV);
+    EXPECT_EQ(bp_ring_peek_back(&ring), nullptr);
+    EXPECT_EQ(bp_ring_pop_back(&ring, &el), -ENOENT);
+    EXPECT_EQ(bp_ring_pop_front_n(&ring, &el, 1), -ENOENT);
+    EXPECT_EQ(bp_ring_pop_back_n(&ring, &el, 1), -ENOENT);
+    EXPECT_EQ(bp_ring_pop_front_n(&ring, nullptr, 0), 0);
+}
+
+TEST(RingDeque, BothEnds)
+{
+    uint32_t buffer[4] = {0};
+    bp_ring_t ring     = BP_RING_INIT(buffer);
+    uint32_t el;
+
+    for (uint32_t i = 1; i <= 2; ++i) {
+        EXPECT_EQ(bp_ring_push(&ring, &i), 0);
+    }
+    for (uint32_t i = 10; i <= 20; i += 10) {
+        EXPECT_EQ(bp_ring_push_front(&ring, &i), 0);
+    }
+    EXPECT_EQ(ring_contents(&ring), std::vector<uint32_t>({20, 10, 1, 2}));
+
+    /* The deque functions never replace an element. */
+    el = 99;
+    EXPECT_EQ(bp_ring_push_front(&ring, &el), -ENOMEM);
+    EXPECT_EQ(bp_ring_push_back_n(&ring, &el, 1), -ENOMEM);
+    EXPECT_EQ(ring_contents(&ring), std::vector<uint32_t>({20, 10, 1, 2}));
+
+    EXPECT_EQ(*(uint32_t *) bp_ring_peek_back(&ring), 2);
+    EXPECT_EQ(*(uint32_t *) bp_ring_peek(&ring), 20);
+    EXPECT_EQ(bp_ring_pop_back(&ring, &el), 0);
+    EXPECT_EQ(el, 2);
+    EXPECT_EQ(bp_ring_pop(&ring, &el), 0);
+    EXPECT_EQ(el, 20);
+    EXPECT_EQ(bp_ring_pop_back(&ring, nullptr), 0);
+    EXPECT_EQ(*(uint32_t *) bp_ring_peek_back(&ring), 10);
+    EXPECT_EQ(bp_ring_pop_back(&ring, &el), 0);
+    EXPECT_EQ(el, 10);
+    EXPECT_EQ(bp_ring_size(&ring), 0);
+}
+
+TEST(RingDeque, BulkAcrossTheEnd)
+{
+    uint32_t buffer[8] = {0};
+    bp_ring_t ring     = BP_RING_INIT(buffer);
+    uint32_t in[]      = {1, 2, 3, 4, 5, 6};
+    uint32_t out[8]    = {0};
+
+    /* Move the ring near the end of the buffer, so the bulk copies have to wrap. */
+    EXPECT_EQ(bp_ring_push_back_n(&ring, in, 6), 0);
+    EXPECT_EQ(bp_ring_pop_front_n(&ring, nullptr, 6), 0);
+    EXPECT_EQ(ring._tail, 6);
+
+    EXPECT_EQ(bp_ring_push_back_n(&ring, in, 5), 0);
+    EXPECT_EQ(ring_contents(&ring), std::vector<uint32_t>({1, 2, 3, 4, 5}));
+    EXPECT_EQ(bp_ring_push_front_n(&ring, in, 4), -ENOMEM);
+    EXPECT_EQ(bp_ring_push_front_n(&ring, in + 3, 3), 0);
+    EXPECT_EQ(ring_contents(&ring), std::vector<uint32_t>({4, 5, 6, 1, 2, 3, 4, 5}));
+
+    EXPECT_EQ(bp_ring_pop_back_n(&ring, out, 9), -ENOENT);
+    EXPECT_EQ(bp_ring_pop_back_n(&ring, out, 3), 0);
+    EXPECT_EQ(std::vector<uint32_t>(out, out + 3), std::vector<uint32_t>({3, 4, 5}));
+    EXPECT_EQ(bp_ring_pop_front_n(&ring, out, 4), 0);
+    EXPECT_EQ(std::vector<uint32_t>(out, out + 4), std::vector<uint32_t>({4, 5, 6, 1}));
+    EXPECT_EQ(ring_contents(&ring), std::vector<uint32_t>({2}));
+}
+
+TEST(RingDeque, RandomOperations)
+{
+    uint32_t buffer[13] = {0};
+    bp_ring_t ring      = BP_RING_INIT(buffer);
+    std::deque<uint32_t> model;
+    uint32_t in[13];
+    uint32_t out[13];
+
+    srand(45);
+    for (int i = 0; i < 20000; ++i) {
+        size_t count = (size_t) rand() % 6;
+        bool fits    = model.size() + count <= 13;
+        bool has     = model.size() >= count;
+
+        for (size_t j = 0; j < count; ++j) {
+            in[j] = (uint32_t) rand();
+        }
+
+        switch (rand() % 4) {
+        case 0:
+            ASSERT_EQ(bp_ring_push_back_n(&ring, in, count), fits ? 0 : -ENOMEM);
+            if (fits) {
+                model.insert(model.end(), in, in + count);
+            }
+            break;
+        case 1:
+            ASSERT_EQ(bp_ring_push_front_n(&ring, in, count), fits ? 0 : -ENOMEM);
+            if (fits) {
+                model.insert(model.begin(), in, in + count);
+            }
+            break;
+        case 2:
+            ASSERT_EQ(bp_ring_pop_front_n(&ring, out, count), has ? 0 : -ENOENT);
+            if (has) {
+                ASSERT_TRUE(std::equal(out, out + count, model.begin()));
+                model.erase(model.begin(), model.begin() + count);
+            }
+            break;
+        default:
+            ASSERT_EQ(bp_ring_pop_back_n(&ring, out, count), has ? 0 : -ENOENT);
+            if (has) {
+                ASSERT_TRUE(std::equal(out, out + count, model.end() - count));
+                model.erase(model.end() - count, model.end());
+            }
+            break;
+        }
+
+        ASSERT_EQ(ring_contents(&ring), std::vector<uint32_t>(model.begin(), model.end()));
+    }
+}
@@ -0,0 +1,84 @@
+/**
+ * @file ring_find_block.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include "bp_ring.h"
+
+extern "C" {
+uint64_t ring_block_cmp_uint32(void *els, size_t count, void *param)
+{
+    uint32_t *els_ptr   = (uint32_t *) els;
+    uint32_t *param_ptr = (uint32_t *) param;
+    uint64_t mask       = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        mask |= (uint64_t) (els_ptr[i] == *param_ptr) << i;
+    }
+
+    return mask;
+}
+}
+
+TEST(RingFindBlock, OnNullRing)
+{
+    uint32_t param = 0;
+
+    EXPECT_EQ(bp_ring_find_block(nullptr, &param, ring_block_cmp_uint32),
+              BP_RING_INVALID_INDEX);
+}
+
+TEST(RingFindBlock, OnEmptyRing)
+{
+    uint32_t buffer[10] = {0};
+    bp_ring_t ring      = BP_RING_INIT(buffer);
+    uint32_t param      = 0;
+
+    EXPECT_EQ(bp_ring_find_block(&ring, &param, ring_block_cmp_uint32),
+              BP_RING_INVALID_INDEX);
+}
+
+TEST(RingFindBlock, NotWrapped)
+{
+    uint32_t buffer[100] = {0};
+    bp_ring_t ring       = BP_RING_INIT(buffer);
+    uint32_t param;
+
+    for (uint32_t i = 1; i <= 80; ++i) {
+        EXPECT_EQ(bp_ring_push(&ring, &i), 0);
+    }
+
+    for (uint32_t i = 1; i <= 80; ++i) {
+        param = i;
+        EXPECT_EQ(bp_ring_find_block(&ring, &param, ring_block_cmp_uint32), i - 1);
+        EXPECT_EQ(bp_ring_find_block(&ring, &param, nullptr), i - 1);
+    }
+}
+
+TEST(RingFindBlock, Wrapped)
+{
+    uint32_t buffer[100] = {0};
+    bp_ring_t ring       = BP_RING_INIT(buffer);
+    uint32_t param;
+
+    /* The oldest element is at the middle of the buffer. */
+    for (uint32_t i = 1; i <= 150; ++i) {
+        EXPECT_EQ(bp_ring_push(&ring, &i), 0);
+    }
+
+    for (uint32_t i = 51; i <= 150; ++i) {
+        param = i;
+        EXPECT_EQ(bp_ring_find_block(&ring, &param, ring_block_cmp_uint32), i - 51);
+        EXPECT_EQ(*(uint32_t *) bp_ring_get(&ring, i - 51), i);
+    }
+
+    param = 50;
+    EXPECT_EQ(bp_ring_find_block(&ring, &param, ring_block_cmp_uint32),
+              BP_RING_INVALID_INDEX);
+}
@@ -0,0 +1,204 @@
+/**
+ * @file slotmap.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include <map>
+#include "bp_slotmap.h"
+
+extern "C" {
+typedef struct {
+    uint32_t id;
+    float x;
+} entity_t;
+}
+
+typedef BP_SLOTMAP_BUFFER(entity_t, 8) slotmap_buffer_t;
+
+TEST(Slotmap, NullArguments)
+{
+    slotmap_buffer_t buffer = {};
+    bp_slotmap_t map        = BP_SLOTMAP_INIT(buffer);
+    entity_t e              = {};
+    bp_slotmap_handle_t h;
+
+    EXPECT_EQ(bp_slotmap_insert(nullptr, &e, &h), -ENODEV);
+    EXPECT_EQ(bp_slotmap_insert(&map, nullptr, &h), -EINVAL);
+    EXPECT_EQ(bp_slotmap_get(nullptr, 1), nullptr);
+    EXPECT_FALSE(bp_slotmap_contains(nullptr, 1));
+    EXPECT_EQ(bp_slotmap_del(nullptr, 1), -ENODEV);
+    EXPECT_EQ(bp_slotmap_handle_of(nullptr, &e), BP_SLOTMAP_INVALID_HANDLE);
+    EXPECT_EQ(bp_slotmap_handle_of(&map, nullptr), BP_SLOTMAP_INVALID_HANDLE);
+    EXPECT_EQ(bp_slotmap_clear(nullptr), -ENODEV);
+    EXPECT_EQ(bp_slotmap_size(nullptr), 0);
+    EXPECT_EQ(bp_slotmap_insert(&map, &e, nullptr), 0);
+}
+
+TEST(Slotmap, InsertAndGet)
+{
+    slotmap_buffer_t buffer = {};
+    bp_slotmap_t map        = BP_SLOTMAP_INIT(buffer);
+    bp_slotmap_handle_t handles[8];
+
+    for (uint32_t i = 0; i < 8; ++i) {
+        entity_t e = {i, i * 0.5f};
+        EXPECT_EQ(bp_slotmap_insert(&map, &e, &handles[i]), 0);
+        EXPECT_NE(handles[i], BP_SLOTMAP_INVALID_HANDLE);
+    }
+
+    entity_t extra = {};
+    EXPECT_EQ(bp_slotmap_insert(&map, &extra, nullptr), -ENOMEM);
+    EXPECT_EQ(bp_slotmap_size(&map), 8);
+
+    for (uint32_t i = 0; i < 8; ++i) {
+        auto *e = (entity_t *) bp_slotmap_get(&map, handles[i]);
+        ASSERT_NE(e, nullptr);
+        EXPECT_EQ(e->id, i);
+        EXPECT_TRUE(bp_slotmap_contains(&map, handles[i]));
+        EXPECT_EQ(bp_slotmap_handle_of(&map, e), handles[i]);
+    }
+
+    EXPECT_EQ(bp_slotmap_get(&map, BP_SLOTMAP_INVALID_HANDLE), nullptr);
+}
+
+TEST(Slotmap, DeleteKeepsOtherHandles)
+{
+    slotmap_buffer_t buffer = {};
+    bp_slotmap_t map        = BP_SLOTMAP_INIT(buffer);
+    bp_slotmap_handle_t handles[5];
+
+    for (uint32_t i = 0; i < 5; ++i) {
+        entity_t e = {i, 0};
+        bp_slotmap_insert(&map, &e, &handles[i]);
+    }
+
+    EXPECT_EQ(bp_slotmap_del(&map, handles[1]), 0);
+    EXPECT_EQ(bp_slotmap_del(&map, handles[1]), -ENOENT);
+    EXPECT_EQ(bp_slotmap_get(&map, handles[1]), nullptr);
+    EXPECT_EQ(bp_slotmap_size(&map), 4);
+
+    for (uint32_t i : {0U, 2U, 3U, 4U}) {
+        auto *e = (entity_t *) bp_slotmap_get(&map, handles[i]);
+        ASSERT_NE(e, nullptr);
+        EXPECT_EQ(e->id, i);
+    }
+
+    EXPECT_EQ(bp_slotmap_del(&map, handles[4]), 0);
+    EXPECT_EQ(bp_slotmap_del(&map, handles[0]), 0);
+    EXPECT_EQ(((entity_t *) bp_slotmap_get(&map, handles[2]))->id, 2);
+    EXPECT_EQ(((entity_t *) bp_slotmap_get(&map, handles[3]))->id, 3);
+}
+
+TEST(Slotmap, StaleHandleAfterReuse)
+{
+    slotmap_buffer_t buffer = {};
+    bp_slotmap_t map        = BP_SLOTMAP_INIT(buffer);
+    entity_t e              = {1, 0};
+    bp_slotmap_handle_t old, reused;
+
+    bp_slotmap_insert(&map, &e, &old);
+    bp_slotmap_del(&map, old);
+
+    e.id = 2;
+    bp_slotmap_insert(&map, &e, &reused);
+
+    EXPECT_EQ((uint32_t) old, (uint32_t) reused);
+    EXPECT_NE(old, reused);
+    EXPECT_EQ(bp_slotmap_get(&map, old), nullptr);
+    EXPECT_EQ(bp_slotmap_del(&map, old), -ENOENT);
+    EXPECT_EQ(((entity_t *) bp_slotmap_get(&map, reused))->id, 2);
+}
+
+TEST(Slotmap, ClearInvalidatesHandles)
+{
+    slotmap_buffer_t buffer = {};
+    bp_slotmap_t map        = BP_SLOTMAP_INIT(buffer);
+    bp_slotmap_handle_t handles[8];
+
+    for (uint32_t i = 0; i < 8; ++i) {
+        entity_t e = {i, 0};
+        bp_slotmap_insert(&map, &e, &handles[i]);
+    }
+
+    EXPECT_EQ(bp_slotmap_clear(&map), 0);
+    EXPECT_EQ(bp_slotmap_size(&map), 0);
+
+    for (auto handle : handles) {
+        EXPECT_FALSE(bp_slotmap_contains(&map, handle));
+    }
+
+    for (uint32_t i = 0; i < 8; ++i) {
+        entity_t e = {i + 10, 0};
+        bp_slotmap_handle_t h;
+        EXPECT_EQ(bp_slotmap_insert(&map, &e, &h), 0);
+        EXPECT_EQ(((entity_t *) bp_slotmap_get(&map, h))->id, i + 10);
+    }
+}
+
+TEST(Slotmap, IterateDense)
+{
+    slotmap_buffer_t buffer = {};
+    bp_slotmap_t map        = BP_SLOTMAP_INIT(buffer);
+    bp_slotmap_handle_t handles[6];
+
+    for (uint32_t i = 0; i < 6; ++i) {
+        entity_t e = {i, 0};
+        bp_slotmap_insert(&map, &e, &handles[i]);
+    }
+    bp_slotmap_del(&map, handles[0]);
+    bp_slotmap_del(&map, handles[3]);
+
+    std::map<uint32_t, bp_slotmap_handle_t> seen;
+    bp_iter_t iter = bp_slotmap_iter(&map);
+
+    BP_FOREACH(entity_t, e, &iter)
+    {
+        seen[e->id] = bp_slotmap_handle_of(&map, e);
+    }
+
+    EXPECT_EQ(seen.size(), 4);
+    for (uint32_t i : {1U, 2U, 4U, 5U}) {
+        EXPECT_EQ(seen[i], handles[i]);
+    }
+}
+
+TEST(Slotmap, RandomOperations)
+{
+    BP_SLOTMAP_BUFFER(entity_t, 64) buffer = {};
+    bp_slotmap_t map                       = BP_SLOTMAP_INIT(buffer);
+    std::map<bp_slotmap_handle_t, uint32_t> model;
+    std::vector<bp_slotmap_handle_t> dead;
+
+    srand(39);
+    for (uint32_t i = 0; i < 4000; ++i) {
+        if (model.size() < 64 && (model.empty() || rand() % 3 != 0)) {
+            entity_t e = {i, 0};
+            bp_slotmap_handle_t h;
+            ASSERT_EQ(bp_slotmap_insert(&map, &e, &h), 0);
+            ASSERT_EQ(model.count(h), 0);
+            model[h] = i;
+        } else {
+            auto it = model.begin();
+            std::advance(it, rand() % model.size());
+            ASSERT_EQ(bp_slotmap_del(&map, it->first), 0);
+            dead.push_back(it->first);
+            model.erase(it);
+        }
+    }
+
+    ASSERT_EQ(bp_slotmap_size(&map), model.size());
+    for (auto &kv : model) {
+        auto *e = (entity_t *) bp_slotmap_get(&map, kv.first);
+        ASSERT_NE(e, nullptr);
+        EXPECT_EQ(e->id, kv.second);
+    }
+    for (auto handle : dead) {
+        EXPECT_FALSE(bp_slotmap_contains(&map, handle));
+    }
+}
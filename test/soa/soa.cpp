@@ -0,0 +1,214 @@
+/**
+ * @file soa.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include "bp_soa.h"
+
+extern "C" {
+typedef struct {
+    uint32_t id;
+    uint64_t ts;
+    double value;
+    uint8_t flags;
+} soa_record_t;
+
+enum { FIELD_ID, FIELD_TS, FIELD_VALUE, FIELD_FLAGS };
+
+static const bp_soa_field_t soa_fields[] = {
+    BP_SOA_FIELD(soa_record_t, id),
+    BP_SOA_FIELD(soa_record_t, ts),
+    BP_SOA_FIELD(soa_record_t, value),
+    BP_SOA_FIELD(soa_record_t, flags),
+};
+
+static bool soa_cmp_ts_ge(void *el, void *param)
+{
+    return *(uint64_t *) el >= *(uint64_t *) param;
+}
+
+static void soa_sum_value(void *acc, void *el)
+{
+    *(double *) acc += *(double *) el;
+}
+
+static uint64_t soa_block_flags_eq(void *els, size_t count, void *param)
+{
+    uint8_t *flags = (uint8_t *) els;
+    uint64_t mask  = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        mask |= (uint64_t) (flags[i] == *(uint8_t *) param) << i;
+    }
+
+    return mask;
+}
+}
+
+class Soa : public ::testing::Test {
+protected:
+    uint32_t ids[8];
+    uint64_t tss[8];
+    double values[8];
+    uint8_t flags[8];
+    void *columns[4] = {ids, tss, values, flags};
+    bp_soa_t soa     = BP_SOA_INIT(soa_record_t, soa_fields, columns, 8);
+
+    void fill(size_t count)
+    {
+        for (size_t i = 0; i < count; ++i) {
+            soa_record_t r = {(uint32_t) i, 100 * i, 0.5 * i, (uint8_t) (i % 3)};
+            ASSERT_EQ(bp_soa_push(&soa, &r), 0);
+        }
+    }
+};
+
+TEST_F(Soa, NullArguments)
+{
+    soa_record_t r = {};
+    bp_array_t view;
+    double acc = 0;
+
+    EXPECT_EQ(bp_soa_check(nullptr), -ENODEV);
+    EXPECT_EQ(bp_soa_push(nullptr, &r), -ENODEV);
+    EXPECT_EQ(bp_soa_push(&soa, nullptr), -EINVAL);
+    EXPECT_EQ(bp_soa_get(nullptr, 0, &r), -ENODEV);
+    EXPECT_EQ(bp_soa_get_field(nullptr, 0, 0), nullptr);
+    EXPECT_EQ(bp_soa_del(nullptr, 0), -ENODEV);
+    EXPECT_EQ(bp_soa_column(nullptr, 0, &view), -ENODEV);
+    EXPECT_EQ(bp_soa_column(&soa, 0, nullptr), -ENODEV);
+    EXPECT_EQ(bp_soa_find_idx(nullptr, 0, &r, nullptr), BP_SOA_INVALID_INDEX);
+    EXPECT_EQ(bp_soa_find_block(nullptr, 0, &r, nullptr), BP_SOA_INVALID_INDEX);
+    EXPECT_EQ(bp_soa_reduce(nullptr, 0, &acc, soa_sum_value), -ENODEV);
+    EXPECT_EQ(bp_soa_clear(nullptr), -ENODEV);
+    EXPECT_EQ(bp_soa_size(nullptr), 0);
+}
+
+TEST_F(Soa, PushGet)
+{
+    fill(8);
+
+    soa_record_t r = {99, 0, 0, 0};
+    EXPECT_EQ(bp_soa_push(&soa, &r), -ENOMEM);
+    EXPECT_EQ(bp_soa_size(&soa), 8);
+
+    for (size_t i = 0; i < 8; ++i) {
+        EXPECT_EQ(bp_soa_get(&soa, i, &r), 0);
+        EXPECT_EQ(r.id, i);
+        EXPECT_EQ(r.ts, 100 * i);
+        EXPECT_EQ(r.value, 0.5 * i);
+        EXPECT_EQ(r.flags, i % 3);
+        EXPECT_EQ(tss[i], 100 * i);
+    }
+    EXPECT_EQ(bp_soa_get(&soa, 8, &r), -EFAULT);
+    EXPECT_EQ(bp_soa_get(&soa, 0, nullptr), -EINVAL);
+}
+
+TEST_F(Soa, FieldsMustFitTheRecord)
+{
+    struct small_record {
+        uint32_t id;
+    };
+    bp_soa_t small_soa = BP_SOA_INIT(struct small_record, soa_fields, columns, 8);
+
+    /* The fields describe soa_record_t, which is larger than the record type given. */
+    EXPECT_EQ(bp_soa_check(&small_soa), -EINVAL);
+    EXPECT_EQ(bp_soa_check(&soa), 0);
+}
+
+TEST_F(Soa, GetField)
+{
+    fill(4);
+
+    EXPECT_EQ(*(uint64_t *) bp_soa_get_field(&soa, 2, FIELD_TS), 200);
+    EXPECT_EQ(*(double *) bp_soa_get_field(&soa, 3, FIELD_VALUE), 1.5);
+    EXPECT_EQ(bp_soa_get_field(&soa, 4, FIELD_TS), nullptr);
+    EXPECT_EQ(bp_soa_get_field(&soa, 0, 4), nullptr);
+}
+
+TEST_F(Soa, DelKeepsColumnsInSync)
+{
+    fill(5);
+
+    EXPECT_EQ(bp_soa_del(&soa, 1), 0);
+    EXPECT_EQ(bp_soa_del(&soa, 3), 0);
+    EXPECT_EQ(bp_soa_del(&soa, 3), -EFAULT);
+    EXPECT_EQ(bp_soa_size(&soa), 3);
+
+    const uint32_t expected[] = {0, 2, 3};
+    for (size_t i = 0; i < 3; ++i) {
+        soa_record_t r;
+        EXPECT_EQ(bp_soa_get(&soa, i, &r), 0);
+        EXPECT_EQ(r.id, expected[i]);
+        EXPECT_EQ(r.ts, 100 * expected[i]);
+        EXPECT_EQ(r.value, 0.5 * expected[i]);
+        EXPECT_EQ(r.flags, expected[i] % 3);
+    }
+    EXPECT_EQ(ids[3], 0);
+    EXPECT_EQ(tss[4], 0);
+}
+
+TEST_F(Soa, Column)
+{
+    bp_array_t view;
+
+    fill(6);
+    EXPECT_EQ(bp_soa_column(&soa, 4, &view), -EINVAL);
+    EXPECT_EQ(bp_soa_column(&soa, FIELD_TS, &view), 0);
+    EXPECT_EQ(bp_array_size(&view), 6);
+    EXPECT_EQ(*(uint64_t *) bp_array_get(&view, 5), 500);
+}
+
+TEST_F(Soa, FindIdx)
+{
+    fill(8);
+
+    uint64_t ts = 250;
+    EXPECT_EQ(bp_soa_find_idx(&soa, FIELD_TS, &ts, soa_cmp_ts_ge), 3);
+    ts = 1000;
+    EXPECT_EQ(bp_soa_find_idx(&soa, FIELD_TS, &ts, soa_cmp_ts_ge), BP_SOA_INVALID_INDEX);
+
+    uint32_t id = 6;
+    EXPECT_EQ(bp_soa_find_idx(&soa, FIELD_ID, &id, nullptr), 6);
+    EXPECT_EQ(bp_soa_find_idx(&soa, 4, &id, nullptr), BP_SOA_INVALID_INDEX);
+}
+
+TEST_F(Soa, FindBlock)
+{
+    fill(8);
+
+    uint8_t flag = 2;
+    EXPECT_EQ(bp_soa_find_block(&soa, FIELD_FLAGS, &flag, soa_block_flags_eq), 2);
+    EXPECT_EQ(bp_soa_find_block(&soa, FIELD_FLAGS, &flag, nullptr), 2);
+    flag = 3;
+    EXPECT_EQ(bp_soa_find_block(&soa, FIELD_FLAGS, &flag, soa_block_flags_eq),
+              BP_SOA_INVALID_INDEX);
+}
+
+TEST_F(Soa, Reduce)
+{
+    double acc = 0;
+
+    fill(8);
+    EXPECT_EQ(bp_soa_reduce(&soa, FIELD_VALUE, &acc, soa_sum_value), 0);
+    EXPECT_EQ(acc, 14.0);
+    EXPECT_EQ(bp_soa_reduce(&soa, 4, &acc, soa_sum_value), -EINVAL);
+    EXPECT_EQ(bp_soa_reduce(&soa, FIELD_VALUE, nullptr, soa_sum_value), -EINVAL);
+    EXPECT_EQ(bp_soa_reduce(&soa, FIELD_VALUE, &acc, nullptr), -EINVAL);
+}
+
+TEST_F(Soa, Clear)
+{
+    fill(4);
+
+    EXPECT_EQ(bp_soa_clear(&soa), 0);
+    EXPECT_EQ(bp_soa_size(&soa), 0);
+    EXPECT_EQ(tss[3], 0);
+    fill(8);
+}
@@ -0,0 +1,154 @@
+/**
+ * @file sparse_set.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include <cstring>
+#include <set>
+#include "bp_sparse_set.h"
+
+typedef BP_SPARSE_SET_BUFFER(8, 64) sparse_set_buffer_t;
+
+TEST(SparseSet, NullArguments)
+{
+    EXPECT_EQ(bp_sparse_set_add(nullptr, 0), -ENODEV);
+    EXPECT_EQ(bp_sparse_set_remove(nullptr, 0), -ENODEV);
+    EXPECT_FALSE(bp_sparse_set_contains(nullptr, 0));
+    EXPECT_EQ(bp_sparse_set_clear(nullptr), -ENODEV);
+    EXPECT_EQ(bp_sparse_set_size(nullptr), 0);
+    EXPECT_EQ(bp_sparse_set_data(nullptr), nullptr);
+}
+
+TEST(SparseSet, AddAndContains)
+{
+    sparse_set_buffer_t buffer;
+    memset(&buffer, 0xA5, sizeof(buffer));
+    bp_sparse_set_t set = BP_SPARSE_SET_INIT(buffer);
+
+    for (uint32_t id = 0; id < 64; ++id) {
+        EXPECT_FALSE(bp_sparse_set_contains(&set, id));
+    }
+
+    EXPECT_EQ(bp_sparse_set_add(&set, 3), 0);
+    EXPECT_EQ(bp_sparse_set_add(&set, 63), 0);
+    EXPECT_EQ(bp_sparse_set_add(&set, 0), 0);
+    EXPECT_EQ(bp_sparse_set_add(&set, 3), -EEXIST);
+    EXPECT_EQ(bp_sparse_set_add(&set, 64), -EINVAL);
+    EXPECT_EQ(bp_sparse_set_size(&set), 3);
+
+    EXPECT_TRUE(bp_sparse_set_contains(&set, 3));
+    EXPECT_TRUE(bp_sparse_set_contains(&set, 63));
+    EXPECT_TRUE(bp_sparse_set_contains(&set, 0));
+    EXPECT_FALSE(bp_sparse_set_contains(&set, 4));
+    EXPECT_FALSE(bp_sparse_set_contains(&set, 1000));
+}
+
+TEST(SparseSet, Full)
+{
+    sparse_set_buffer_t buffer;
+    bp_sparse_set_t set = BP_SPARSE_SET_INIT(buffer);
+
+    for (uint32_t id = 0; id < 8; ++id) {
+        EXPECT_EQ(bp_sparse_set_add(&set, id * 2), 0);
+    }
+    EXPECT_EQ(bp_sparse_set_add(&set, 1), -ENOMEM);
+
+    EXPECT_EQ(bp_sparse_set_remove(&set, 4), 0);
+    EXPECT_EQ(bp_sparse_set_add(&set, 1), 0);
+}
+
+TEST(SparseSet, Remove)
+{
+    sparse_set_buffer_t buffer;
+    bp_sparse_set_t set = BP_SPARSE_SET_INIT(buffer);
+
+    for (uint32_t id : {5U, 9U, 17U, 33U}) {
+        bp_sparse_set_add(&set, id);
+    }
+
+    EXPECT_EQ(bp_sparse_set_remove(&set, 9), 0);
+    EXPECT_EQ(bp_sparse_set_remove(&set, 9), -ENOENT);
+    EXPECT_EQ(bp_sparse_set_remove(&set, 100), -ENOENT);
+    EXPECT_FALSE(bp_sparse_set_contains(&set, 9));
+    EXPECT_EQ(bp_sparse_set_size(&set), 3);
+
+    EXPECT_EQ(bp_sparse_set_remove(&set, 33), 0);
+    EXPECT_EQ(bp_sparse_set_remove(&set, 5), 0);
+    EXPECT_TRUE(bp_sparse_set_contains(&set, 17));
+    EXPECT_EQ(bp_sparse_set_data(&set)[0], 17);
+}
+
+TEST(SparseSet, Clear)
+{
+    sparse_set_buffer_t buffer;
+    bp_sparse_set_t set = BP_SPARSE_SET_INIT(buffer);
+
+    for (uint32_t id = 0; id < 8; ++id) {
+        bp_sparse_set_add(&set, id);
+    }
+
+    EXPECT_EQ(bp_sparse_set_clear(&set), 0);
+    EXPECT_EQ(bp_sparse_set_size(&set), 0);
+    for (uint32_t id = 0; id < 8; ++id) {
+        EXPECT_FALSE(bp_sparse_set_contains(&set, id));
+    }
+
+    EXPECT_EQ(bp_sparse_set_add(&set, 7), 0);
+    EXPECT_TRUE(bp_sparse_set_contains(&set, 7));
+    EXPECT_FALSE(bp_sparse_set_contains(&set, 0));
+}
+
+TEST(SparseSet, Iterate)
+{
+    sparse_set_buffer_t buffer;
+    bp_sparse_set_t set = BP_SPARSE_SET_INIT(buffer);
+    std::set<uint32_t> expected = {2, 11, 40, 59};
+
+    for (uint32_t id : expected) {
+        bp_sparse_set_add(&set, id);
+    }
+    bp_sparse_set_add(&set, 30);
+    bp_sparse_set_remove(&set, 30);
+
+    std::set<uint32_t> seen;
+    bp_iter_t iter = bp_sparse_set_iter(&set);
+
+    BP_FOREACH(uint32_t, id, &iter)
+    {
+        seen.insert(*id);
+    }
+
+    EXPECT_EQ(seen, expected);
+}
+
+TEST(SparseSet, RandomOperations)
+{
+    static BP_SPARSE_SET_BUFFER(256, 65536) buffer;
+    bp_sparse_set_t set = BP_SPARSE_SET_INIT(buffer);
+    std::set<uint32_t> model;
+
+    srand(40);
+    for (int i = 0; i < 10000; ++i) {
+        uint32_t id = (uint32_t) rand() % 300U;
+        if (rand() % 2 == 0) {
+            int expected = model.count(id) ? -EEXIST : model.size() == 256 ? -ENOMEM : 0;
+            ASSERT_EQ(bp_sparse_set_add(&set, id), expected);
+            if (expected == 0) {
+                model.insert(id);
+            }
+        } else {
+            ASSERT_EQ(bp_sparse_set_remove(&set, id), model.erase(id) ? 0 : -ENOENT);
+        }
+    }
+
+    ASSERT_EQ(bp_sparse_set_size(&set), model.size());
+    for (uint32_t id = 0; id < 300; ++id) {
+        EXPECT_EQ(bp_sparse_set_contains(&set, id), model.count(id) == 1);
+    }
+}
@@ -0,0 +1,180 @@
+/**
+ * @file varray.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "bp_varray.h"
+
+typedef BP_VARRAY_BUFFER(8, 64) varray_buffer_t;
+
+static std::string get_string(bp_varray_t *varray, size_t idx)
+{
+    size_t length = 0;
+    auto *data    = (const char *) bp_varray_get(varray, idx, &length);
+
+    return data == nullptr ? std::string("<null>") : std::string(data, length);
+}
+
+TEST(Varray, NullArguments)
+{
+    varray_buffer_t buffer = {};
+    bp_varray_t varray     = BP_VARRAY_INIT(buffer);
+    uint32_t lengths[]     = {1};
+
+    EXPECT_EQ(bp_varray_push(nullptr, "a", 1), -ENODEV);
+    EXPECT_EQ(bp_varray_push(&varray, nullptr, 1), -EINVAL);
+    EXPECT_EQ(bp_varray_push(&varray, nullptr, 0), 0);
+    EXPECT_EQ(bp_varray_load(nullptr, "a", lengths, 1), -ENODEV);
+    EXPECT_EQ(bp_varray_load(&varray, nullptr, lengths, 1), -EINVAL);
+    EXPECT_EQ(bp_varray_load(&varray, "a", nullptr, 1), -EINVAL);
+    EXPECT_EQ(bp_varray_get(nullptr, 0, nullptr), nullptr);
+    EXPECT_EQ(bp_varray_del(nullptr, 0), -ENODEV);
+    EXPECT_EQ(bp_varray_compact(nullptr), -ENODEV);
+    EXPECT_EQ(bp_varray_clear(nullptr), -ENODEV);
+    EXPECT_EQ(bp_varray_size(nullptr), 0);
+    EXPECT_EQ(bp_varray_garbage(nullptr), 0);
+}
+
+TEST(Varray, PushAndGet)
+{
+    varray_buffer_t buffer = {};
+    bp_varray_t varray     = BP_VARRAY_INIT(buffer);
+
+    EXPECT_EQ(bp_varray_push(&varray, "alpha", 5), 0);
+    EXPECT_EQ(bp_varray_push(&varray, "", 0), 0);
+    EXPECT_EQ(bp_varray_push(&varray, "gamma ray", 9), 0);
+
+    EXPECT_EQ(bp_varray_size(&varray), 3);
+    EXPECT_EQ(get_string(&varray, 0), "alpha");
+    EXPECT_EQ(get_string(&varray, 1), "");
+    EXPECT_EQ(get_string(&varray, 2), "gamma ray");
+    EXPECT_EQ(get_string(&varray, 3), "<null>");
+    EXPECT_NE(bp_varray_get(&varray, 0, nullptr), nullptr);
+}
+
+TEST(Varray, Full)
+{
+    varray_buffer_t buffer = {};
+    bp_varray_t varray     = BP_VARRAY_INIT(buffer);
+    char bytes[64]         = {};
+
+    EXPECT_EQ(bp_varray_push(&varray, bytes, 60), 0);
+    EXPECT_EQ(bp_varray_push(&varray, bytes, 5), -ENOMEM);
+    EXPECT_EQ(bp_varray_push(&varray, bytes, 4), 0);
+
+    for (int i = 0; i < 6; ++i) {
+        EXPECT_EQ(bp_varray_push(&varray, bytes, 0), 0);
+    }
+    EXPECT_EQ(bp_varray_push(&varray, bytes, 0), -ENOMEM);
+}
+
+TEST(Varray, Load)
+{
+    varray_buffer_t buffer = {};
+    bp_varray_t varray     = BP_VARRAY_INIT(buffer);
+    const char *data       = "onetwothree";
+    uint32_t lengths[]     = {3, 3, 5};
+
+    EXPECT_EQ(bp_varray_push(&varray, "zero", 4), 0);
+    EXPECT_EQ(bp_varray_load(&varray, data, lengths, 3), 0);
+    EXPECT_EQ(bp_varray_size(&varray), 4);
+    EXPECT_EQ(get_string(&varray, 0), "zero");
+    EXPECT_EQ(get_string(&varray, 1), "one");
+    EXPECT_EQ(get_string(&varray, 2), "two");
+    EXPECT_EQ(get_string(&varray, 3), "three");
+
+    uint32_t too_long[] = {50};
+    char bytes[50]      = {};
+    EXPECT_EQ(bp_varray_load(&varray, bytes, too_long, 1), -ENOMEM);
+    EXPECT_EQ(bp_varray_load(&varray, data, lengths, 5), -ENOMEM);
+    EXPECT_EQ(bp_varray_size(&varray), 4);
+}
+
+TEST(Varray, DeleteAndCompact)
+{
+    varray_buffer_t buffer = {};
+    bp_varray_t varray     = BP_VARRAY_INIT(buffer);
+    char bytes[20]         = {};
+
+    bp_varray_push(&varray, "first", 5);
+    bp_varray_push(&varray, bytes, 20);
+    bp_varray_push(&varray, "third", 5);
+    bp_varray_push(&varray, bytes, 20);
+    bp_varray_push(&varray, "fifth", 5);
+
+    EXPECT_EQ(bp_varray_del(&varray, 5), -EINVAL);
+    EXPECT_EQ(bp_varray_del(&varray, 1), 0);
+    EXPECT_EQ(bp_varray_del(&varray, 2), 0);
+    EXPECT_EQ(bp_varray_garbage(&varray), 40);
+    EXPECT_EQ(bp_varray_size(&varray), 3);
+    EXPECT_EQ(get_string(&varray, 0), "first");
+    EXPECT_EQ(get_string(&varray, 1), "third");
+    EXPECT_EQ(get_string(&varray, 2), "fifth");
+
+    EXPECT_EQ(bp_varray_push(&varray, bytes, 20), -ENOMEM);
+    EXPECT_EQ(bp_varray_compact(&varray), 0);
+    EXPECT_EQ(bp_varray_garbage(&varray), 0);
+    EXPECT_EQ(get_string(&varray, 0), "first");
+    EXPECT_EQ(get_string(&varray, 1), "third");
+    EXPECT_EQ(get_string(&varray, 2), "fifth");
+    EXPECT_EQ(bp_varray_push(&varray, "sixth", 5), 0);
+    EXPECT_EQ(bp_varray_push(&varray, bytes, 20), 0);
+    EXPECT_EQ(get_string(&varray, 3), "sixth");
+}
+
+TEST(Varray, Clear)
+{
+    varray_buffer_t buffer = {};
+    bp_varray_t varray     = BP_VARRAY_INIT(buffer);
+    char bytes[64]         = {};
+
+    bp_varray_push(&varray, bytes, 64);
+    bp_varray_del(&varray, 0);
+
+    EXPECT_EQ(bp_varray_clear(&varray), 0);
+    EXPECT_EQ(bp_varray_size(&varray), 0);
+    EXPECT_EQ(bp_varray_garbage(&varray), 0);
+    EXPECT_EQ(bp_varray_push(&varray, bytes, 64), 0);
+}
+
+TEST(Varray, RandomOperations)
+{
+    BP_VARRAY_BUFFER(64, 1024) buffer = {};
+    bp_varray_t varray                = BP_VARRAY_INIT(buffer);
+    std::vector<std::string> model;
+
+    srand(43);
+    for (int i = 0; i < 3000; ++i) {
+        int op = rand() % 10;
+        if (op < 6) {
+            std::string s(rand() % 40, (char) ('a' + rand() % 26));
+            int ret = bp_varray_push(&varray, s.data(), s.size());
+            if (ret == -ENOMEM) {
+                ASSERT_EQ(bp_varray_compact(&varray), 0);
+                ret = bp_varray_push(&varray, s.data(), s.size());
+            }
+            if (ret == 0) {
+                model.push_back(s);
+            } else {
+                ASSERT_EQ(ret, -ENOMEM);
+            }
+        } else if (!model.empty()) {
+            size_t idx = rand() % model.size();
+            ASSERT_EQ(bp_varray_del(&varray, idx), 0);
+            model.erase(model.begin() + idx);
+        }
+    }
+
+    ASSERT_EQ(bp_varray_size(&varray), model.size());
+    for (size_t i = 0; i < model.size(); ++i) {
+        EXPECT_EQ(get_string(&varray, i), model[i]);
+    }
+}
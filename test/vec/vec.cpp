@@ -0,0 +1,200 @@
+/**
+ * @file vec.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include "bp_vec.h"
+
+extern "C" {
+typedef struct {
+    size_t allocs;
+    size_t frees;
+    size_t live_bytes;
+    size_t fail_after;
+} counting_ctx_t;
+
+static void *counting_alloc(void *ctx, size_t size)
+{
+    counting_ctx_t *c = (counting_ctx_t *) ctx;
+
+    if (c->allocs >= c->fail_after) {
+        return NULL;
+    }
+    c->allocs += 1;
+    c->live_bytes += size;
+
+    return malloc(size);
+}
+
+static void counting_free(void *ctx, void *ptr, size_t size)
+{
+    counting_ctx_t *c = (counting_ctx_t *) ctx;
+
+    c->frees += 1;
+    c->live_bytes -= size;
+    free(ptr);
+}
+
+static bool vec_cmp_uint32(void *el, void *param)
+{
+    return *(uint32_t *) el == *(uint32_t *) param;
+}
+}
+
+TEST(Vec, NullArguments)
+{
+    uint32_t el = 0;
+
+    EXPECT_EQ(bp_vec_push(nullptr, &el), -ENODEV);
+    EXPECT_EQ(bp_vec_get(nullptr, 0), nullptr);
+    EXPECT_EQ(bp_vec_last(nullptr), nullptr);
+    EXPECT_EQ(bp_vec_del(nullptr, 0), -ENODEV);
+    EXPECT_EQ(bp_vec_find_idx(nullptr, &el, nullptr), BP_ARRAY_INVALID_INDEX);
+    EXPECT_EQ(bp_vec_find(nullptr, &el, nullptr), nullptr);
+    EXPECT_EQ(bp_vec_clear(nullptr), -ENODEV);
+    EXPECT_EQ(bp_vec_size(nullptr), 0);
+    EXPECT_EQ(bp_vec_capacity(nullptr), 0);
+    EXPECT_EQ(bp_vec_reserve(nullptr, 10), -ENODEV);
+    EXPECT_EQ(bp_vec_shrink_to_fit(nullptr), -ENODEV);
+    EXPECT_EQ(bp_vec_deinit(nullptr), -ENODEV);
+}
+
+TEST(Vec, StaticModeNeverGrows)
+{
+    uint32_t buffer[4];
+    bp_vec_t vec = BP_VEC_INIT(buffer, nullptr);
+
+    for (uint32_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(bp_vec_push(&vec, &i), 0);
+    }
+    uint32_t el = 4;
+    EXPECT_EQ(bp_vec_push(&vec, &el), -ENOMEM);
+    EXPECT_EQ(bp_vec_reserve(&vec, 8), -ENOMEM);
+    EXPECT_EQ(bp_vec_size(&vec), 4);
+    EXPECT_EQ(vec._coll._array, (uint8_t *) buffer);
+}
+
+TEST(Vec, GrowsFromInlineBuffer)
+{
+    counting_ctx_t ctx     = {0, 0, 0, SIZE_MAX};
+    bp_allocator_t alloc   = {counting_alloc, nullptr, counting_free, &ctx};
+    uint32_t buffer[3];
+    bp_vec_t vec = BP_VEC_INIT(buffer, &alloc);
+
+    for (uint32_t i = 0; i < 100; ++i) {
+        ASSERT_EQ(bp_vec_push(&vec, &i), 0);
+    }
+
+    EXPECT_EQ(bp_vec_size(&vec), 100);
+    EXPECT_EQ(bp_vec_capacity(&vec), 192);
+    EXPECT_EQ(ctx.allocs, 6);
+    EXPECT_EQ(ctx.frees, 5);
+    for (uint32_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(*(uint32_t *) bp_vec_get(&vec, i), i);
+    }
+
+    uint32_t key = 42;
+    EXPECT_EQ(bp_vec_find_idx(&vec, &key, vec_cmp_uint32), 42);
+    EXPECT_EQ(*(uint32_t *) bp_vec_find(&vec, &key, nullptr), 42);
+    EXPECT_EQ(*(uint32_t *) bp_vec_last(&vec), 99);
+    EXPECT_EQ(bp_vec_del(&vec, 0), 0);
+    EXPECT_EQ(*(uint32_t *) bp_vec_get(&vec, 0), 1);
+
+    EXPECT_EQ(bp_vec_deinit(&vec), 0);
+    EXPECT_EQ(ctx.live_bytes, 0);
+    EXPECT_EQ(vec._coll._array, (uint8_t *) buffer);
+    EXPECT_EQ(bp_vec_size(&vec), 0);
+}
+
+TEST(Vec, PushOwnElementWhileGrowing)
+{
+    uint32_t buffer[2];
+    bp_vec_t vec = BP_VEC_INIT(buffer, &bp_libc_allocator);
+
+    for (uint32_t i = 10; i < 12; ++i) {
+        EXPECT_EQ(bp_vec_push(&vec, &i), 0);
+    }
+    EXPECT_EQ(bp_vec_push(&vec, bp_vec_get(&vec, 0)), 0);
+    EXPECT_EQ(*(uint32_t *) bp_vec_get(&vec, 2), 10);
+
+    EXPECT_EQ(bp_vec_deinit(&vec), 0);
+}
+
+TEST(Vec, ReserveAndShrink)
+{
+    counting_ctx_t ctx   = {0, 0, 0, SIZE_MAX};
+    bp_allocator_t alloc = {counting_alloc, nullptr, counting_free, &ctx};
+    uint32_t buffer[8];
+    bp_vec_t vec = BP_VEC_INIT(buffer, &alloc);
+
+    EXPECT_EQ(bp_vec_reserve(&vec, 4), 0);
+    EXPECT_EQ(ctx.allocs, 0);
+    EXPECT_EQ(bp_vec_reserve(&vec, 50), 0);
+    EXPECT_EQ(bp_vec_capacity(&vec), 50);
+    EXPECT_EQ(ctx.allocs, 1);
+
+    for (uint32_t i = 0; i < 20; ++i) {
+        EXPECT_EQ(bp_vec_push(&vec, &i), 0);
+    }
+    EXPECT_EQ(ctx.allocs, 1);
+
+    EXPECT_EQ(bp_vec_shrink_to_fit(&vec), 0);
+    EXPECT_EQ(bp_vec_capacity(&vec), 20);
+
+    /* Fits in the inline buffer again. */
+    for (int i = 0; i < 15; ++i) {
+        EXPECT_EQ(bp_vec_del(&vec, bp_vec_size(&vec) - 1), 0);
+    }
+    EXPECT_EQ(bp_vec_shrink_to_fit(&vec), 0);
+    EXPECT_EQ(vec._coll._array, (uint8_t *) buffer);
+    EXPECT_EQ(bp_vec_capacity(&vec), 8);
+    EXPECT_EQ(ctx.live_bytes, 0);
+    for (uint32_t i = 0; i < 5; ++i) {
+        EXPECT_EQ(*(uint32_t *) bp_vec_get(&vec, i), i);
+    }
+}
+
+TEST(Vec, AllocationFailure)
+{
+    counting_ctx_t ctx   = {0, 0, 0, 1};
+    bp_allocator_t alloc = {counting_alloc, nullptr, counting_free, &ctx};
+    bp_vec_t vec         = BP_VEC_INIT_EMPTY(uint64_t, &alloc);
+    uint64_t el          = 7;
+
+    for (size_t i = 0; i < BP_VEC_MIN_CAPACITY; ++i) {
+        EXPECT_EQ(bp_vec_push(&vec, &el), 0);
+    }
+    EXPECT_EQ(bp_vec_push(&vec, &el), -ENOMEM);
+    EXPECT_EQ(bp_vec_size(&vec), BP_VEC_MIN_CAPACITY);
+
+    EXPECT_EQ(bp_vec_deinit(&vec), 0);
+    EXPECT_EQ(ctx.live_bytes, 0);
+    EXPECT_EQ(vec._coll._array, nullptr);
+}
+
+TEST(Vec, Iterator)
+{
+    uint32_t buffer[2];
+    bp_vec_t vec = BP_VEC_INIT(buffer, &bp_libc_allocator);
+    uint32_t sum = 0;
+
+    for (uint32_t i = 1; i <= 10; ++i) {
+        EXPECT_EQ(bp_vec_push(&vec, &i), 0);
+    }
+
+    bp_iter_t it = bp_vec_iter(&vec);
+    BP_FOREACH(uint32_t, el, &it)
+    {
+        sum += *el;
+    }
+    EXPECT_EQ(sum, 55);
+
+    EXPECT_EQ(bp_vec_deinit(&vec), 0);
+}
@@ -0,0 +1,184 @@
+/**
+ * @file window.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include "bp_window.h"
+
+class Window : public ::testing::Test
+{
+   protected:
+    BP_WINDOW_BUFFER(16) buffer;
+    bp_window_t window = BP_WINDOW_INIT(buffer);
+};
+
+TEST_F(Window, NullArguments)
+{
+    bp_window_stats_t stats;
+
+    EXPECT_EQ(bp_window_push(nullptr, 1.0), -ENODEV);
+    EXPECT_EQ(bp_window_stats(nullptr, &stats), -ENODEV);
+    EXPECT_EQ(bp_window_stats(&window, nullptr), -EINVAL);
+    EXPECT_EQ(bp_window_samples(nullptr), nullptr);
+    EXPECT_EQ(bp_window_clear(nullptr), -ENODEV);
+    EXPECT_EQ(bp_window_size(nullptr), 0);
+}
+
+TEST_F(Window, EmptyAndNan)
+{
+    bp_window_stats_t stats;
+
+    EXPECT_EQ(bp_window_stats(&window, &stats), -ENOENT);
+    EXPECT_EQ(bp_window_push(&window, NAN), -EINVAL);
+    EXPECT_EQ(bp_window_push(&window, INFINITY), -EINVAL);
+    EXPECT_EQ(bp_window_push(&window, -INFINITY), -EINVAL);
+    EXPECT_EQ(bp_window_size(&window), 0);
+
+    EXPECT_EQ(bp_window_push(&window, 1.0), 0);
+    EXPECT_EQ(bp_window_push(&window, INFINITY), -EINVAL);
+    EXPECT_EQ(bp_window_stats(&window, &stats), 0);
+    EXPECT_EQ(stats.count, 1);
+    EXPECT_DOUBLE_EQ(stats.sum, 1.0);
+    EXPECT_DOUBLE_EQ(stats.mean, 1.0);
+}
+
+TEST(WindowPrecision, SpikeLeavesNoError)
+{
+    static BP_WINDOW_BUFFER(100) buffer;
+    bp_window_t window = BP_WINDOW_INIT(buffer);
+    bp_window_stats_t stats;
+
+    /* Alternating 999.5 and 1000.5: mean 1000, variance 0.25. */
+    for (int i = 0; i < 100; ++i) {
+        bp_window_push(&window, 1000.0 + ((i % 2) ? 0.5 : -0.5));
+    }
+    bp_window_push(&window, 1e9);
+    for (int i = 0; i < 100; ++i) {
+        bp_window_push(&window, 1000.0 + ((i % 2) ? 0.5 : -0.5));
+    }
+
+    EXPECT_EQ(bp_window_stats(&window, &stats), 0);
+    EXPECT_NEAR(stats.sum, 100000.0, 1e-9);
+    EXPECT_NEAR(stats.mean, 1000.0, 1e-12);
+    EXPECT_NEAR(stats.variance, 0.25, 1e-12);
+    EXPECT_DOUBLE_EQ(stats.max, 1000.5);
+}
+
+TEST(WindowPrecision, LongRunWithSpikes)
+{
+    static BP_WINDOW_BUFFER(64) buffer;
+    bp_window_t window = BP_WINDOW_INIT(buffer);
+    bp_window_stats_t stats;
+
+    for (int i = 0; i < 2000000; ++i) {
+        double sample = (i % 500000 == 0) ? 1e12 : 5.0 + (double) (i % 2);
+        ASSERT_EQ(bp_window_push(&window, sample), 0);
+    }
+
+    EXPECT_EQ(bp_window_stats(&window, &stats), 0);
+    EXPECT_NEAR(stats.mean, 5.5, 1e-12);
+    EXPECT_NEAR(stats.variance, 0.25, 1e-12);
+}
+
+TEST_F(Window, PartialWindow)
+{
+    bp_window_stats_t stats;
+    double samples[] = {2, 4, 4, 4, 5, 5, 7, 9};
+
+    for (double sample : samples) {
+        EXPECT_EQ(bp_window_push(&window, sample), 0);
+    }
+
+    EXPECT_EQ(bp_window_stats(&window, &stats), 0);
+    EXPECT_EQ(stats.count, 8);
+    EXPECT_DOUBLE_EQ(stats.sum, 40);
+    EXPECT_DOUBLE_EQ(stats.mean, 5);
+    EXPECT_DOUBLE_EQ(stats.variance, 4);
+    EXPECT_DOUBLE_EQ(stats.min, 2);
+    EXPECT_DOUBLE_EQ(stats.max, 9);
+    EXPECT_EQ(bp_ring_size(bp_window_samples(&window)), 8);
+    EXPECT_DOUBLE_EQ(*(double *) bp_ring_peek(bp_window_samples(&window)), 2);
+}
+
+TEST_F(Window, SlidingMinMax)
+{
+    bp_window_stats_t stats;
+
+    /* A decreasing run keeps the maximum at the oldest sample until it leaves. */
+    for (int i = 0; i < 16; ++i) {
+        bp_window_push(&window, 100 - i);
+    }
+    bp_window_stats(&window, &stats);
+    EXPECT_DOUBLE_EQ(stats.max, 100);
+    EXPECT_DOUBLE_EQ(stats.min, 85);
+
+    bp_window_push(&window, 0);
+    bp_window_stats(&window, &stats);
+    EXPECT_EQ(stats.count, 16);
+    EXPECT_DOUBLE_EQ(stats.max, 99);
+    EXPECT_DOUBLE_EQ(stats.min, 0);
+    EXPECT_DOUBLE_EQ(stats.sum, 1480 - 100);
+}
+
+TEST_F(Window, Clear)
+{
+    bp_window_stats_t stats;
+
+    for (int i = 0; i < 40; ++i) {
+        bp_window_push(&window, i);
+    }
+    EXPECT_EQ(bp_window_clear(&window), 0);
+    EXPECT_EQ(bp_window_size(&window), 0);
+    EXPECT_EQ(bp_window_stats(&window, &stats), -ENOENT);
+
+    bp_window_push(&window, -3);
+    EXPECT_EQ(bp_window_stats(&window, &stats), 0);
+    EXPECT_DOUBLE_EQ(stats.min, -3);
+    EXPECT_DOUBLE_EQ(stats.max, -3);
+    EXPECT_DOUBLE_EQ(stats.mean, -3);
+    EXPECT_DOUBLE_EQ(stats.variance, 0);
+}
+
+TEST_F(Window, MatchesRecomputation)
+{
+    std::deque<double> model;
+    bp_window_stats_t stats;
+
+    srand(48);
+    for (int i = 0; i < 5000; ++i) {
+        double sample = (double) (rand() % 2001 - 1000) / 8.0;
+
+        ASSERT_EQ(bp_window_push(&window, sample), 0);
+        model.push_back(sample);
+        if (model.size() > 16) {
+            model.pop_front();
+        }
+
+        double sum = 0;
+        double sq  = 0;
+        for (double x : model) {
+            sum += x;
+        }
+        double mean = sum / model.size();
+        for (double x : model) {
+            sq += (x - mean) * (x - mean);
+        }
+
+        ASSERT_EQ(bp_window_stats(&window, &stats), 0);
+        ASSERT_EQ(stats.count, model.size());
+        ASSERT_NEAR(stats.sum, sum, 1e-6);
+        ASSERT_NEAR(stats.mean, mean, 1e-6);
+        ASSERT_NEAR(stats.variance, sq / model.size(), 1e-6);
+        ASSERT_EQ(stats.min, *std::min_element(model.begin(), model.end()));
+        ASSERT_EQ(stats.max, *std::max_element(model.begin(), model.end()));
+    }
+}
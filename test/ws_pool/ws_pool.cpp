@@ -0,0 +1,133 @@
+/**
+ * @file ws_pool.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include <atomic>
+#include "bp_ws_pool.h"
+
+struct fib {
+    uint64_t n;
+    uint64_t result;
+    std::atomic<uint64_t> *workers;
+};
+
+extern "C" {
+static void fib_task(bp_ws_worker_t *worker, void *arg)
+{
+    struct fib *f = (struct fib *) arg;
+
+    *f->workers |= UINT64_C(1) << bp_ws_worker_index(worker);
+    if (f->n < 2) {
+        f->result = f->n;
+        return;
+    }
+
+    struct fib left      = {f->n - 1, 0, f->workers};
+    struct fib right     = {f->n - 2, 0, f->workers};
+    bp_ws_group_t group  = BP_WS_GROUP_INIT;
+    bp_ws_task_t task    = {fib_task, &left, nullptr};
+
+    EXPECT_EQ(bp_ws_spawn(worker, &group, &task), 0);
+    fib_task(worker, &right);
+    EXPECT_EQ(bp_ws_wait(worker, &group), 0);
+
+    f->result = left.result + right.result;
+}
+
+static void wide_task(bp_ws_worker_t *worker, void *arg)
+{
+    std::atomic<uint64_t> *count = (std::atomic<uint64_t> *) arg;
+    bp_ws_group_t group          = BP_WS_GROUP_INIT;
+    bp_ws_task_t tasks[1000];
+
+    /* More tasks than a deque holds, so some of them run at once. */
+    for (auto &task : tasks) {
+        task.fn  = [](bp_ws_worker_t *, void *arg) { *(std::atomic<uint64_t> *) arg += 1; };
+        task.arg = count;
+        EXPECT_EQ(bp_ws_spawn(worker, &group, &task), 0);
+    }
+    EXPECT_EQ(bp_ws_wait(worker, &group), 0);
+    EXPECT_EQ(count->load(), 1000);
+}
+}
+
+class WsPool : public ::testing::Test
+{
+   protected:
+    bp_thread_pool_t threads;
+    bp_ws_pool_t ws;
+
+    void SetUp() override
+    {
+        ASSERT_EQ(bp_thread_pool_init(&threads, 4), 0);
+        ASSERT_EQ(bp_ws_pool_init(&ws, &threads), 0);
+    }
+
+    void TearDown() override
+    {
+        bp_thread_pool_deinit(&threads);
+    }
+};
+
+TEST_F(WsPool, NullArguments)
+{
+    bp_ws_group_t group = BP_WS_GROUP_INIT;
+    bp_ws_task_t task   = {nullptr, nullptr, nullptr};
+
+    EXPECT_EQ(bp_ws_pool_init(nullptr, &threads), -ENODEV);
+    EXPECT_EQ(bp_ws_pool_init(&ws, nullptr), -ENODEV);
+    EXPECT_EQ(bp_ws_pool_run(nullptr, fib_task, nullptr), -ENODEV);
+    EXPECT_EQ(bp_ws_pool_run(&ws, nullptr, nullptr), -ENODEV);
+    EXPECT_EQ(bp_ws_spawn(nullptr, &group, &task), -ENODEV);
+    EXPECT_EQ(bp_ws_spawn(&ws._workers[0], nullptr, &task), -ENODEV);
+    EXPECT_EQ(bp_ws_spawn(&ws._workers[0], &group, nullptr), -ENODEV);
+    EXPECT_EQ(bp_ws_spawn(&ws._workers[0], &group, &task), -EINVAL);
+    EXPECT_EQ(bp_ws_wait(nullptr, &group), -ENODEV);
+    EXPECT_EQ(bp_ws_wait(&ws._workers[0], nullptr), -ENODEV);
+    EXPECT_EQ(bp_ws_worker_index(nullptr), 0);
+}
+
+TEST_F(WsPool, ForkJoin)
+{
+    std::atomic<uint64_t> workers(0);
+    struct fib f = {25, 0, &workers};
+
+    EXPECT_EQ(bp_ws_pool_run(&ws, fib_task, &f), 0);
+    EXPECT_EQ(f.result, 75025);
+    EXPECT_NE(workers.load() & 1U, 0);
+
+    /* The pool can run another root task. */
+    f = {20, 0, &workers};
+    EXPECT_EQ(bp_ws_pool_run(&ws, fib_task, &f), 0);
+    EXPECT_EQ(f.result, 6765);
+}
+
+TEST_F(WsPool, DequeOverflow)
+{
+    std::atomic<uint64_t> count(0);
+
+    EXPECT_EQ(bp_ws_pool_run(&ws, wide_task, &count), 0);
+    EXPECT_EQ(count.load(), 1000);
+}
+
+TEST(WsPoolSingle, OneWorker)
+{
+    bp_thread_pool_t threads;
+    bp_ws_pool_t ws;
+    std::atomic<uint64_t> workers(0);
+    struct fib f = {15, 0, &workers};
+
+    ASSERT_EQ(bp_thread_pool_init(&threads, 1), 0);
+    ASSERT_EQ(bp_ws_pool_init(&ws, &threads), 0);
+    EXPECT_EQ(bp_ws_pool_run(&ws, fib_task, &f), 0);
+    EXPECT_EQ(f.result, 610);
+    EXPECT_EQ(workers.load(), 1);
+    bp_thread_pool_deinit(&threads);
+}
@@ -0,0 +1,125 @@
+/**
+ * @file wsdeque.cpp
+ * @author Matheus T. dos Santos (tenoriomatheus0@edge.ufal.br)
+ * @brief
+ * @version 0.1
+ * @date 19/10/2026
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "bp_wsdeque.h"
+
+TEST(Wsdeque, NullArguments)
+{
+    void *buffer[4]    = {};
+    bp_wsdeque_t deque = BP_WSDEQUE_INIT(buffer);
+    void *task         = nullptr;
+
+    EXPECT_EQ(bp_wsdeque_push(nullptr, &task), -ENODEV);
+    EXPECT_EQ(bp_wsdeque_pop(nullptr, &task), -ENODEV);
+    EXPECT_EQ(bp_wsdeque_pop(&deque, nullptr), -ENODEV);
+    EXPECT_EQ(bp_wsdeque_steal(nullptr, &task), -ENODEV);
+    EXPECT_EQ(bp_wsdeque_steal(&deque, nullptr), -ENODEV);
+    EXPECT_EQ(bp_wsdeque_size(nullptr), 0);
+}
+
+TEST(Wsdeque, InvalidCapacity)
+{
+    void *buffer[6]    = {};
+    bp_wsdeque_t deque = BP_WSDEQUE_INIT(buffer);
+
+    EXPECT_EQ(bp_wsdeque_push(&deque, buffer), -EINVAL);
+}
+
+TEST(Wsdeque, OwnerIsLifoThiefIsFifo)
+{
+    void *buffer[8]    = {};
+    bp_wsdeque_t deque = BP_WSDEQUE_INIT(buffer);
+    int tasks[8]       = {};
+    void *task         = nullptr;
+
+    EXPECT_EQ(bp_wsdeque_pop(&deque, &task), -ENOENT);
+    EXPECT_EQ(bp_wsdeque_steal(&deque, &task), -ENOENT);
+
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_EQ(bp_wsdeque_push(&deque, &tasks[i]), 0);
+    }
+    EXPECT_EQ(bp_wsdeque_push(&deque, &tasks[0]), -ENOMEM);
+    EXPECT_EQ(bp_wsdeque_size(&deque), 8);
+
+    EXPECT_EQ(bp_wsdeque_pop(&deque, &task), 0);
+    EXPECT_EQ(task, &tasks[7]);
+    EXPECT_EQ(bp_wsdeque_steal(&deque, &task), 0);
+    EXPECT_EQ(task, &tasks[0]);
+    EXPECT_EQ(bp_wsdeque_steal(&deque, &task), 0);
+    EXPECT_EQ(task, &tasks[1]);
+
+    /* The slots freed by the thieves are reused. */
+    EXPECT_EQ(bp_wsdeque_push(&deque, &tasks[1]), 0);
+    EXPECT_EQ(bp_wsdeque_push(&deque, &tasks[0]), 0);
+    EXPECT_EQ(bp_wsdeque_push(&deque, &tasks[7]), 0);
+    EXPECT_EQ(bp_wsdeque_push(&deque, &tasks[7]), -ENOMEM);
+
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_EQ(bp_wsdeque_pop(&deque, &task), 0);
+    }
+    EXPECT_EQ(task, &tasks[2]);
+    EXPECT_EQ(bp_wsdeque_pop(&deque, &task), -ENOENT);
+    EXPECT_EQ(bp_wsdeque_size(&deque), 0);
+}
+
+TEST(Wsdeque, ConcurrentSteals)
+{
+    static void *buffer[64] = {};
+    static uintptr_t values[100000];
+    bp_wsdeque_t deque = BP_WSDEQUE_INIT(buffer);
+    std::vector<std::atomic<int>> taken(100000);
+    std::atomic<bool> done(false);
+    std::vector<std::thread> thieves;
+
+    for (size_t i = 0; i < 100000; ++i) {
+        values[i] = i;
+    }
+
+    for (int t = 0; t < 3; ++t) {
+        thieves.emplace_back([&]() {
+            void *task = nullptr;
+            while (!done.load()) {
+                if (bp_wsdeque_steal(&deque, &task) == 0) {
+                    taken[*(uintptr_t *) task] += 1;
+                }
+            }
+        });
+    }
+
+    /* The owner pushes everything and pops some, while the thieves steal the rest. */
+    void *task = nullptr;
+    for (size_t i = 0; i < 100000;) {
+        if (bp_wsdeque_push(&deque, &values[i]) == 0) {
+            i += 1;
+        } else if (bp_wsdeque_pop(&deque, &task) == 0) {
+            taken[*(uintptr_t *) task] += 1;
+        }
+        if (i % 3 == 0 && bp_wsdeque_pop(&deque, &task) == 0) {
+            taken[*(uintptr_t *) task] += 1;
+        }
+    }
+    while (bp_wsdeque_size(&deque) > 0) {
+        if (bp_wsdeque_pop(&deque, &task) == 0) {
+            taken[*(uintptr_t *) task] += 1;
+        }
+    }
+    done = true;
+    for (auto &thief : thieves) {
+        thief.join();
+    }
+
+    for (size_t i = 0; i < 100000; ++i) {
+        ASSERT_EQ(taken[i].load(), 1) << i;
+    }
+}